@@ -338,11 +338,70 @@ static void compress_test_heatshrink_tar() {
     furi_record_close(RECORD_STORAGE);
 }
 
+static void compress_test_icon_cache_fill(uint8_t* buffer, size_t size, uint8_t seed) {
+    for(size_t i = 0; i < size; i++) {
+        buffer[i] = seed + (i / 16);
+    }
+}
+
+static void compress_test_icon_cache(void) {
+    static const size_t icon_size = 128 * 64 / 8;
+
+    Compress* comp = compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+    CompressIcon* compress_icon = compress_icon_alloc(icon_size);
+    compress_icon_set_cache_size(compress_icon, icon_size * 4);
+
+    uint8_t* src_buff = malloc(icon_size);
+    uint8_t* encoded_buff = malloc(icon_size * 2);
+    uint8_t* decoded_buff = NULL;
+    size_t encoded_size = 0;
+
+    compress_test_icon_cache_fill(src_buff, icon_size, 0);
+    mu_assert(
+        compress_encode(comp, src_buff, icon_size, encoded_buff, icon_size * 2, &encoded_size),
+        "Compress failed");
+    mu_assert(encoded_buff[0], "Icon is not compressed");
+
+    for(size_t i = 0; i < 3; i++) {
+        compress_icon_decode(compress_icon, encoded_buff, &decoded_buff);
+        mu_assert(memcmp(src_buff, decoded_buff, icon_size) == 0, "Decoded icon mismatch");
+    }
+
+    CompressIconCacheStats stats;
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(1, stats.misses);
+    mu_assert_int_eq(2, stats.hits);
+    mu_assert_int_eq(1, stats.entries);
+
+    // Same memory reused by a different icon must not be served from cache
+    compress_test_icon_cache_fill(src_buff, icon_size, 0x55);
+    mu_assert(
+        compress_encode(comp, src_buff, icon_size, encoded_buff, icon_size * 2, &encoded_size),
+        "Compress failed");
+    compress_icon_decode(compress_icon, encoded_buff, &decoded_buff);
+    mu_assert(memcmp(src_buff, decoded_buff, icon_size) == 0, "Stale icon served from cache");
+
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(2, stats.misses);
+    mu_assert_int_eq(1, stats.entries);
+
+    compress_icon_set_cache_size(compress_icon, 0);
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(0, stats.entries);
+    mu_assert_int_eq(0, stats.size);
+
+    free(src_buff);
+    free(encoded_buff);
+    compress_icon_free(compress_icon);
+    compress_free(comp);
+}
+
 MU_TEST_SUITE(test_compress) {
     MU_RUN_TEST(compress_test_random_comp_decomp);
     MU_RUN_TEST(compress_test_reference_comp_decomp);
     MU_RUN_TEST(compress_test_heatshrink_stream);
     MU_RUN_TEST(compress_test_heatshrink_tar);
+    MU_RUN_TEST(compress_test_icon_cache);
 }
 
 int run_minunit_test_compress(void) {
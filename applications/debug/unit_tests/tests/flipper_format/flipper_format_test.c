@@ -456,6 +456,93 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+#define INDEX_TEST_BLOCKS (256U)
+#define INDEX_TEST_FILE   TEST_DIR "ff_index.test"
+
+static bool test_write_index_dump(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    FuriString* key = furi_string_alloc();
+    uint8_t block[16];
+
+    do {
+        if(!flipper_format_buffered_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_header_cstr(file, test_filetype, test_version)) break;
+        if(!flipper_format_write_string_cstr(file, "Mifare Classic type", "4K")) break;
+
+        bool error = false;
+        for(size_t index = 0; index < INDEX_TEST_BLOCKS; index++) {
+            memset(block, index, sizeof(block));
+            furi_string_printf(key, "Block %zu", index);
+            if(!flipper_format_write_hex(file, furi_string_get_cstr(key), block, sizeof(block))) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(key);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+// Reads every block after a rewind, like lookups of keys in no particular order
+static bool test_read_index_dump(const char* file_name, bool key_index, uint32_t* time) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    FuriString* key = furi_string_alloc();
+    uint8_t block[16];
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+        flipper_format_set_key_index(file, key_index);
+
+        const uint32_t start = furi_get_tick();
+        bool error = false;
+        for(size_t i = 0; i < INDEX_TEST_BLOCKS; i++) {
+            // Backwards, the worst case for a sequential lookup
+            const size_t index = INDEX_TEST_BLOCKS - 1 - i;
+            furi_string_printf(key, "Block %zu", index);
+            if(!flipper_format_rewind(file) ||
+               !flipper_format_read_hex(file, furi_string_get_cstr(key), block, sizeof(block)) ||
+               block[0] != index || block[sizeof(block) - 1] != index) {
+                error = true;
+                break;
+            }
+        }
+        *time = furi_get_tick() - start;
+        if(error) break;
+
+        // Keys that are not there must not be found
+        if(flipper_format_key_exist(file, "Block 256")) break;
+
+        // Update moves the following keys, the index must follow
+        const uint8_t updated[] = {0xDE, 0xAD};
+        if(!flipper_format_update_hex(file, "Block 10", updated, sizeof(updated))) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_hex(file, "Block 200", block, sizeof(block))) break;
+        if(block[0] != 200) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_hex(file, "Block 10", block, sizeof(updated))) break;
+        if(memcmp(block, updated, sizeof(updated)) != 0) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(key);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -528,6 +615,23 @@ MU_TEST(flipper_format_oddities_test) {
     mu_assert(test_read(test_file_linux), "Read test error [Oddities]");
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    uint32_t time_scan = 0;
+    uint32_t time_index = 0;
+
+    mu_assert(test_write_index_dump(INDEX_TEST_FILE), "Index dump write error");
+    mu_assert(test_read_index_dump(INDEX_TEST_FILE, false, &time_scan), "Scan read error");
+    mu_assert(test_write_index_dump(INDEX_TEST_FILE), "Index dump write error");
+    mu_assert(test_read_index_dump(INDEX_TEST_FILE, true, &time_index), "Index read error");
+
+    // Tick timing is too coarse and noisy to assert on, it is for information only
+    printf(
+        "%u keys: scan %lums, index %lums\r\n",
+        (unsigned)INDEX_TEST_BLOCKS,
+        time_scan,
+        time_index);
+}
+
 MU_TEST_SUITE(flipper_format) {
     tests_setup();
     MU_RUN_TEST(flipper_format_write_test);
@@ -542,6 +646,7 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
     MU_RUN_TEST(flipper_format_oddities_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
     tests_teardown();
 }
 
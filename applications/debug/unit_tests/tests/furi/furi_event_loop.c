@@ -203,3 +203,130 @@ void test_furi_event_loop(void) {
     furi_thread_free(producer_thread);
     furi_message_queue_free(data.mq);
 }
+
+#define EVENT_LOOP_TIMER_COUNT       (512u)
+#define EVENT_LOOP_TIMER_SHORT_COUNT (64u)
+#define EVENT_LOOP_TIMER_TIMEOUT     (1000u)
+// Timers with the allocator overhead, demanded in one block to leave room for fragmentation
+#define EVENT_LOOP_TIMER_HEAP_SIZE   (EVENT_LOOP_TIMER_COUNT * 128u)
+
+typedef struct {
+    FuriEventLoop* event_loop;
+    FuriEventLoopTimer* timers[EVENT_LOOP_TIMER_COUNT];
+    // Zero interval timer, fires once all previous timer requests are processed
+    FuriEventLoopTimer* step;
+    FuriEventLoopTimer* timeout;
+
+    bool cancelled;
+    uint32_t bench_start;
+    uint32_t arm_cycles;
+    uint32_t cancel_cycles;
+    uint32_t fired;
+} TestFuriEventLoopTimerData;
+
+static void test_furi_event_loop_timer_callback(void* context) {
+    TestFuriEventLoopTimerData* data = context;
+
+    data->fired++;
+    if(data->fired == EVENT_LOOP_TIMER_SHORT_COUNT) {
+        furi_event_loop_stop(data->event_loop);
+    }
+}
+
+static void test_furi_event_loop_timer_timeout_callback(void* context) {
+    TestFuriEventLoopTimerData* data = context;
+    furi_event_loop_stop(data->event_loop);
+}
+
+static void test_furi_event_loop_timer_step_callback(void* context) {
+    TestFuriEventLoopTimerData* data = context;
+
+    if(!data->cancelled) {
+        data->arm_cycles = DWT->CYCCNT - data->bench_start;
+
+        data->bench_start = DWT->CYCCNT;
+        for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+            furi_event_loop_timer_stop(data->timers[i]);
+        }
+
+        data->cancelled = true;
+        furi_event_loop_timer_start(data->step, 0);
+
+    } else {
+        data->cancel_cycles = DWT->CYCCNT - data->bench_start;
+
+        // Short timers must fire exactly once, half of them are allowed to coalesce
+        for(size_t i = 0; i < EVENT_LOOP_TIMER_SHORT_COUNT; i++) {
+            furi_event_loop_timer_set_slack(data->timers[i], (i & 1) ? 8 : 0);
+            furi_event_loop_timer_start(data->timers[i], 1 + i % 32);
+        }
+
+        furi_event_loop_timer_start(data->timeout, EVENT_LOOP_TIMER_TIMEOUT);
+    }
+}
+
+static void test_furi_event_loop_timer_arm(void* context) {
+    TestFuriEventLoopTimerData* data = context;
+
+    // Intervals spread over all levels of the timer wheel, none of them expires during the test
+    data->bench_start = DWT->CYCCNT;
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        const uint32_t interval = EVENT_LOOP_TIMER_TIMEOUT * 2 + furi_hal_random_get() % 2000000;
+        furi_event_loop_timer_start(data->timers[i], interval);
+    }
+
+    furi_event_loop_timer_start(data->step, 0);
+}
+
+void test_furi_event_loop_timer_benchmark(void) {
+    if(memmgr_heap_get_max_free_block() < EVENT_LOOP_TIMER_HEAP_SIZE) {
+        mu_warn("Not enough RAM for timer benchmark");
+        return;
+    }
+
+    TestFuriEventLoopTimerData* data = malloc(sizeof(TestFuriEventLoopTimerData));
+
+    data->event_loop = furi_event_loop_alloc();
+
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        data->timers[i] = furi_event_loop_timer_alloc(
+            data->event_loop,
+            test_furi_event_loop_timer_callback,
+            FuriEventLoopTimerTypeOnce,
+            data);
+    }
+
+    data->step = furi_event_loop_timer_alloc(
+        data->event_loop,
+        test_furi_event_loop_timer_step_callback,
+        FuriEventLoopTimerTypeOnce,
+        data);
+
+    data->timeout = furi_event_loop_timer_alloc(
+        data->event_loop,
+        test_furi_event_loop_timer_timeout_callback,
+        FuriEventLoopTimerTypeOnce,
+        data);
+
+    furi_event_loop_pend_callback(data->event_loop, test_furi_event_loop_timer_arm, data);
+    furi_event_loop_run(data->event_loop);
+
+    const uint32_t fired = data->fired;
+
+    for(size_t i = 0; i < EVENT_LOOP_TIMER_COUNT; i++) {
+        furi_event_loop_timer_free(data->timers[i]);
+    }
+
+    furi_event_loop_timer_free(data->step);
+    furi_event_loop_timer_free(data->timeout);
+    furi_event_loop_free(data->event_loop);
+
+    printf(
+        "Event loop timers: %lu cycles per arm, %lu cycles per cancel\r\n",
+        data->arm_cycles / EVENT_LOOP_TIMER_COUNT,
+        data->cancel_cycles / EVENT_LOOP_TIMER_COUNT);
+
+    free(data);
+
+    mu_assert_int_eq(EVENT_LOOP_TIMER_SHORT_COUNT, fired);
+}
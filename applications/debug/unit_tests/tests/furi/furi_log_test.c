@@ -0,0 +1,114 @@
+#include "../test.h" // IWYU pragma: keep
+#include <furi.h>
+#include <furi_hal.h>
+#include <core/log_i.h>
+#include <string.h>
+
+#define TAG "LogTest"
+
+#define LOG_TEST_BUFFER_SIZE (1024U)
+
+static void test_furi_log_tx_callback(const uint8_t* data, size_t size, void* context) {
+    furi_stream_buffer_send(context, data, size, 0);
+}
+
+void test_furi_log_deferred(void) {
+    FuriStreamBuffer* stream = furi_stream_buffer_alloc(LOG_TEST_BUFFER_SIZE, 1);
+    FuriLogHandler handler = {
+        .callback = test_furi_log_tx_callback,
+        .context = stream,
+    };
+
+    const FuriLogLevel previous_level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+    mu_assert(furi_log_add_handler(handler), "handler not added");
+
+    furi_log_set_mode(FuriLogModeDeferred);
+    mu_assert(furi_log_get_mode() == FuriLogModeDeferred, "mode not set");
+
+    // Test strings live in the plugin memory, so this is the formatted text path
+    char text[] = "deferred";
+    FURI_LOG_I(TAG, "value %d %s %.*s", -42, text, 3, "abcdef");
+    // The message must not depend on the caller's memory
+    memset(text, 'x', strlen(text));
+    FURI_LOG_D(TAG, "filtered");
+    FURI_LOG_RAW_I("raw %lu\r\n", 7UL);
+
+    // Waits until queued messages are out
+    furi_log_set_mode(FuriLogModeImmediate);
+    furi_log_remove_handler(handler);
+    furi_log_set_level(previous_level);
+
+    char* buffer = malloc(LOG_TEST_BUFFER_SIZE + 1);
+    size_t size = furi_stream_buffer_receive(stream, buffer, LOG_TEST_BUFFER_SIZE, 0);
+    buffer[size] = '\0';
+
+    const char* message = strstr(buffer, "[I][" TAG "] ");
+    mu_assert(message != NULL, "header not found");
+    mu_assert(strstr(message, "value -42 deferred abc\r\n") != NULL, "message mismatch");
+    mu_assert(strstr(message, "raw 7\r\n") != NULL, "raw message mismatch");
+    mu_assert(strstr(buffer, "filtered") == NULL, "filtered message printed");
+
+    free(buffer);
+    furi_stream_buffer_free(stream);
+}
+
+static bool test_furi_log_pack_args(
+    uint8_t* buffer,
+    size_t size,
+    size_t* packed,
+    const char* format,
+    ...) {
+    va_list args;
+    va_start(args, format);
+    bool result = furi_log_pack(buffer, size, packed, format, args);
+    va_end(args);
+    return result;
+}
+
+// Firmware messages and binary mode records carry arguments packed this way
+void test_furi_log_pack(void) {
+    uint8_t buffer[64];
+    size_t packed = 0;
+    char text[] = "packed";
+    const char* format = "%d %5u %llx %s %.*s %-3c|%08lX %.2f %%";
+
+    mu_assert(
+        test_furi_log_pack_args(
+            buffer,
+            sizeof(buffer),
+            &packed,
+            format,
+            -42,
+            7U,
+            0x123456789ABCDEFULL,
+            text,
+            3,
+            "abcdef",
+            'z',
+            0xBEEFUL,
+            3.14159),
+        "pack failed");
+    mu_assert_int_eq(4 + 4 + 8 + 7 + 4 + 4 + 4 + 4 + 8, packed);
+
+    // Strings are copied
+    memset(text, 'x', strlen(text));
+
+    FuriString* string = furi_string_alloc();
+    furi_log_unpack(string, format, buffer, packed);
+    mu_assert_string_eq(
+        "-42     7 123456789abcdef packed abc z  |0000BEEF 3.14 %", furi_string_get_cstr(string));
+
+    // Truncated arguments are not read past the end
+    furi_string_reset(string);
+    furi_log_unpack(string, "%d %d", buffer, sizeof(int32_t));
+    mu_assert_string_eq("-42 ", furi_string_get_cstr(string));
+    furi_string_free(string);
+
+    mu_assert(
+        !test_furi_log_pack_args(buffer, 8, &packed, "%s", "does not fit"),
+        "oversized arguments packed");
+    mu_assert(
+        !test_furi_log_pack_args(buffer, sizeof(buffer), &packed, "%Lf", 1.0L),
+        "unsupported argument packed");
+}
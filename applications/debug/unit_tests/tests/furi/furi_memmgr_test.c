@@ -1,4 +1,5 @@
 #include "../test.h" // IWYU pragma: keep
+#include <furi.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
@@ -37,3 +38,123 @@ void test_furi_memmgr(void) {
     }
     free(ptr);
 }
+
+#define MEMMGR_BENCH_SLOTS  (256)
+#define MEMMGR_BENCH_ROUNDS (16)
+
+static uint32_t memmgr_bench_random(uint32_t* seed) {
+    *seed = *seed * 1664525UL + 1013904223UL;
+    return *seed >> 8;
+}
+
+// Fragmentation in percents: how much of the free heap is not in the largest block
+static uint32_t memmgr_bench_fragmentation(void) {
+    size_t free_heap = memmgr_get_free_heap();
+    size_t max_block = memmgr_heap_get_max_free_block();
+    return free_heap ? (uint32_t)(100 - (uint64_t)max_block * 100 / free_heap) : 0;
+}
+
+static void memmgr_bench_run(const char* name, size_t size_min, size_t size_max) {
+    void** slots = malloc(sizeof(void*) * MEMMGR_BENCH_SLOTS);
+    uint16_t* sizes = malloc(sizeof(uint16_t) * MEMMGR_BENCH_SLOTS);
+    uint32_t seed = 0x1234;
+    uint32_t operations = 0;
+
+    uint32_t fragmentation_before = memmgr_bench_fragmentation();
+
+    uint32_t bench_start = DWT->CYCCNT;
+    for(size_t round = 0; round < MEMMGR_BENCH_ROUNDS; round++) {
+        // Fill every slot, then free a random half: short-lived blocks mixed with live ones
+        for(size_t i = 0; i < MEMMGR_BENCH_SLOTS; i++) {
+            if(slots[i]) continue;
+            sizes[i] = size_min + memmgr_bench_random(&seed) % (size_max - size_min + 1);
+            slots[i] = malloc(sizes[i]);
+            memset(slots[i], (uint8_t)i, sizes[i]);
+            operations++;
+        }
+        for(size_t i = 0; i < MEMMGR_BENCH_SLOTS; i++) {
+            if(memmgr_bench_random(&seed) & 1) continue;
+            free(slots[i]);
+            slots[i] = NULL;
+            operations++;
+        }
+    }
+    uint32_t bench_cycles = DWT->CYCCNT - bench_start;
+
+    uint32_t fragmentation_live = memmgr_bench_fragmentation();
+
+    // Live blocks must not overlap
+    bool data_valid = true;
+    for(size_t i = 0; i < MEMMGR_BENCH_SLOTS; i++) {
+        if(!slots[i]) continue;
+        for(size_t j = 0; j < sizes[i]; j++) {
+            data_valid &= ((uint8_t*)slots[i])[j] == (uint8_t)i;
+        }
+        free(slots[i]);
+    }
+
+    uint32_t fragmentation_after = memmgr_bench_fragmentation();
+
+    free(sizes);
+    free(slots);
+
+    printf(
+        "Heap %s: %lu cycles per malloc/free, fragmentation %lu%% -> %lu%% -> %lu%%\r\n",
+        name,
+        bench_cycles / operations,
+        fragmentation_before,
+        fragmentation_live,
+        fragmentation_after);
+    mu_assert(data_valid, "Heap blocks overlap");
+}
+
+void test_furi_memmgr_benchmark(void) {
+    // Served by the size-class slabs
+    memmgr_bench_run("small", 8, 256);
+    // Served by the first-fit free list
+    memmgr_bench_run("large", 300, 1024);
+    // Mixed workload, small blocks must not get in the way of large ones
+    memmgr_bench_run("mixed", 8, 1024);
+}
+
+#define MEMMGR_SITES_TEST_BLOCKS (8U)
+#define MEMMGR_SITES_TEST_SIZE   (200U)
+
+static bool memmgr_sites_find(const MemmgrHeapSitesSnapshot* snapshot, uint32_t blocks) {
+    for(size_t i = 0; i < snapshot->sites_count; i++) {
+        if(snapshot->sites[i].address && snapshot->sites[i].live_blocks >= blocks &&
+           snapshot->sites[i].live_bytes >= blocks * MEMMGR_SITES_TEST_SIZE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void test_furi_memmgr_sites(void) {
+    MemmgrHeapSitesSnapshot* snapshot = malloc(sizeof(MemmgrHeapSitesSnapshot));
+    void* blocks[MEMMGR_SITES_TEST_BLOCKS];
+
+    memmgr_heap_enable_site_trace();
+
+    // Same call site for every block
+    for(size_t i = 0; i < MEMMGR_SITES_TEST_BLOCKS; i++) {
+        blocks[i] = malloc(MEMMGR_SITES_TEST_SIZE);
+        memset(blocks[i], 0xA5, MEMMGR_SITES_TEST_SIZE);
+    }
+
+    memmgr_heap_get_sites_snapshot(snapshot);
+    mu_check(snapshot->enabled);
+    mu_check(snapshot->samples_count > 0);
+    mu_check(snapshot->fragmentation <= 1000);
+    mu_check(memmgr_sites_find(snapshot, MEMMGR_SITES_TEST_BLOCKS));
+
+    for(size_t i = 0; i < MEMMGR_SITES_TEST_BLOCKS; i++) {
+        free(blocks[i]);
+    }
+
+    memmgr_heap_get_sites_snapshot(snapshot);
+    mu_check(!memmgr_sites_find(snapshot, MEMMGR_SITES_TEST_BLOCKS));
+
+    memmgr_heap_disable_site_trace();
+    free(snapshot);
+}
@@ -43,3 +43,79 @@ void test_furi_pubsub(void) {
     // delete pubsub case
     furi_pubsub_free(test_pubsub);
 }
+
+#define PUBSUB_QUEUED_QUEUE_SIZE    (4U)
+#define PUBSUB_QUEUED_MESSAGE_COUNT (6U)
+
+typedef struct {
+    uint32_t values[PUBSUB_QUEUED_MESSAGE_COUNT];
+    size_t count;
+} TestPubSubQueuedData;
+
+static void test_pubsub_queued_handler(const void* arg, void* ctx) {
+    TestPubSubQueuedData* data = ctx;
+    if(data->count < PUBSUB_QUEUED_MESSAGE_COUNT) {
+        data->values[data->count] = *(const uint32_t*)arg;
+    }
+    data->count++;
+}
+
+static void test_pubsub_queued_stop_callback(void* ctx) {
+    furi_event_loop_stop(ctx);
+}
+
+void test_furi_pubsub_queued(void) {
+    FuriPubSub* test_pubsub = furi_pubsub_alloc();
+    FuriEventLoop* event_loop = furi_event_loop_alloc();
+    TestPubSubQueuedData fifo = {};
+    TestPubSubQueuedData latest = {};
+
+    FuriPubSubSubscription* fifo_subscription = furi_pubsub_subscribe_queued(
+        test_pubsub,
+        event_loop,
+        sizeof(uint32_t),
+        PUBSUB_QUEUED_QUEUE_SIZE,
+        FuriPubSubQueuePolicyFifo,
+        test_pubsub_queued_handler,
+        &fifo);
+    FuriPubSubSubscription* latest_subscription = furi_pubsub_subscribe_queued(
+        test_pubsub,
+        event_loop,
+        sizeof(uint32_t),
+        0,
+        FuriPubSubQueuePolicyLatest,
+        test_pubsub_queued_handler,
+        &latest);
+
+    // Nothing is delivered until the event loop runs
+    for(uint32_t i = 0; i < PUBSUB_QUEUED_MESSAGE_COUNT; i++) {
+        furi_pubsub_publish(test_pubsub, &i);
+    }
+    mu_assert_int_eq(0, fifo.count);
+    mu_assert_int_eq(0, latest.count);
+
+    FuriEventLoopTimer* stop_timer = furi_event_loop_timer_alloc(
+        event_loop, test_pubsub_queued_stop_callback, FuriEventLoopTimerTypeOnce, event_loop);
+    furi_event_loop_timer_start(stop_timer, 10);
+    furi_event_loop_run(event_loop);
+
+    // FIFO keeps the oldest messages, latest only keeps the last one
+    mu_assert_int_eq(PUBSUB_QUEUED_QUEUE_SIZE, fifo.count);
+    for(uint32_t i = 0; i < PUBSUB_QUEUED_QUEUE_SIZE; i++) {
+        mu_assert_int_eq(i, fifo.values[i]);
+    }
+    mu_assert_int_eq(1, latest.count);
+    mu_assert_int_eq(PUBSUB_QUEUED_MESSAGE_COUNT - 1, latest.values[0]);
+
+    FuriPubSubStats stats;
+    furi_pubsub_get_stats(test_pubsub, &stats);
+    mu_assert_int_eq(PUBSUB_QUEUED_MESSAGE_COUNT, stats.published);
+    mu_assert_int_eq(PUBSUB_QUEUED_MESSAGE_COUNT - PUBSUB_QUEUED_QUEUE_SIZE, stats.dropped);
+    mu_assert_int_eq(PUBSUB_QUEUED_MESSAGE_COUNT - 1, stats.coalesced);
+
+    furi_event_loop_timer_free(stop_timer);
+    furi_pubsub_unsubscribe(test_pubsub, fifo_subscription);
+    furi_pubsub_unsubscribe(test_pubsub, latest_subscription);
+    furi_event_loop_free(event_loop);
+    furi_pubsub_free(test_pubsub);
+}
@@ -6,8 +6,14 @@
 void test_furi_create_open(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
+void test_furi_pubsub_queued(void);
 void test_furi_memmgr(void);
+void test_furi_memmgr_benchmark(void);
+void test_furi_memmgr_sites(void);
 void test_furi_event_loop(void);
+void test_furi_event_loop_timer_benchmark(void);
+void test_furi_log_deferred(void);
+void test_furi_log_pack(void);
 
 static int foo = 0;
 
@@ -32,16 +38,40 @@ MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
 
+MU_TEST(mu_test_furi_pubsub_queued) {
+    test_furi_pubsub_queued();
+}
+
 MU_TEST(mu_test_furi_memmgr) {
     // this test is not accurate, but gives a basic understanding
     // that memory management is working fine
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_benchmark) {
+    test_furi_memmgr_benchmark();
+}
+
+MU_TEST(mu_test_furi_memmgr_sites) {
+    test_furi_memmgr_sites();
+}
+
 MU_TEST(mu_test_furi_event_loop) {
     test_furi_event_loop();
 }
 
+MU_TEST(mu_test_furi_event_loop_timer_benchmark) {
+    test_furi_event_loop_timer_benchmark();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
+}
+
+MU_TEST(mu_test_furi_log_pack) {
+    test_furi_log_pack();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
     MU_RUN_TEST(test_check);
@@ -49,8 +79,14 @@ MU_TEST_SUITE(test_suite) {
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
+    MU_RUN_TEST(mu_test_furi_pubsub_queued);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_benchmark);
+    MU_RUN_TEST(mu_test_furi_memmgr_sites);
     MU_RUN_TEST(mu_test_furi_event_loop);
+    MU_RUN_TEST(mu_test_furi_event_loop_timer_benchmark);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
+    MU_RUN_TEST(mu_test_furi_log_pack);
 }
 
 int run_minunit_test_furi(void) {
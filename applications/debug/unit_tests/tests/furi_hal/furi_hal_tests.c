@@ -3,6 +3,8 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include <lp5562_reg.h>
+#include <stm32wbxx_ll_usart.h>
+#include <stm32wbxx_ll_lpuart.h>
 #include "../test.h" // IWYU pragma: keep
 
 #define DATA_SIZE             4
@@ -12,6 +14,10 @@
 #define EEPROM_PAGE_SIZE      16
 #define EEPROM_WRITE_DELAY_MS 6
 
+#define SERIAL_BAUD_RATE 230400
+#define SERIAL_DATA_SIZE 1024
+#define SERIAL_CHUNK     100
+
 static void furi_hal_i2c_int_setup(void) {
     furi_hal_i2c_acquire(&furi_hal_i2c_handle_power);
 }
@@ -214,6 +220,117 @@ MU_TEST(furi_hal_i2c_ext_eeprom) {
     }
 }
 
+static void furi_hal_serial_test_rx_callback(
+    FuriHalSerialHandle* handle,
+    FuriHalSerialRxEvent event,
+    void* context) {
+    FuriStreamBuffer* stream = context;
+
+    if(event & FuriHalSerialRxEventData) {
+        while(furi_hal_serial_async_rx_available(handle)) {
+            const uint8_t data = furi_hal_serial_async_rx(handle);
+            furi_stream_buffer_send(stream, &data, 1, 0);
+        }
+    }
+}
+
+static void furi_hal_serial_test_tx_callback(FuriHalSerialHandle* handle, void* context) {
+    UNUSED(handle);
+    (*(uint32_t*)context)++;
+}
+
+static void furi_hal_serial_test_set_half_duplex(FuriHalSerialId id, bool enable) {
+    // Single wire mode connects receiver to transmitter, every sent byte comes back
+    if(id == FuriHalSerialIdUsart) {
+        LL_USART_Disable(USART1);
+        if(enable) {
+            LL_USART_EnableHalfDuplex(USART1);
+        } else {
+            LL_USART_DisableHalfDuplex(USART1);
+        }
+        LL_USART_Enable(USART1);
+    } else if(id == FuriHalSerialIdLpuart) {
+        LL_LPUART_Disable(LPUART1);
+        if(enable) {
+            LL_LPUART_EnableHalfDuplex(LPUART1);
+        } else {
+            LL_LPUART_DisableHalfDuplex(LPUART1);
+        }
+        LL_LPUART_Enable(LPUART1);
+    }
+}
+
+static void furi_hal_serial_test_tx_order(FuriHalSerialId id) {
+    FuriHalSerialHandle* handle = furi_hal_serial_control_acquire(id);
+    if(!handle) {
+        mu_warn("Serial is busy, skipping");
+        return;
+    }
+
+    uint8_t* tx_data = malloc(SERIAL_DATA_SIZE);
+    uint8_t* rx_data = malloc(SERIAL_DATA_SIZE);
+    FuriStreamBuffer* stream = furi_stream_buffer_alloc(SERIAL_DATA_SIZE, 1);
+    uint32_t released = 0;
+
+    for(size_t i = 0; i < SERIAL_DATA_SIZE; i++) {
+        tx_data[i] = i * 7 + (i >> 8);
+    }
+
+    furi_hal_serial_init(handle, SERIAL_BAUD_RATE);
+    furi_hal_serial_test_set_half_duplex(id, true);
+    furi_hal_serial_async_rx_start(handle, furi_hal_serial_test_rx_callback, stream, false);
+    furi_hal_serial_dma_tx_start(handle, furi_hal_serial_test_tx_callback, &released);
+
+    // Mix queued and blocking writes, blocking ones must not overtake the queue
+    size_t sent = 0;
+    bool async = true;
+    while(sent < SERIAL_DATA_SIZE) {
+        const size_t size = MIN((size_t)SERIAL_CHUNK, SERIAL_DATA_SIZE - sent);
+        if(async) {
+            for(size_t queued = 0; queued < size;) {
+                queued += furi_hal_serial_tx_async(handle, &tx_data[sent + queued], size - queued);
+            }
+        } else {
+            furi_hal_serial_tx(handle, &tx_data[sent], size);
+        }
+        sent += size;
+        async = !async;
+    }
+    furi_hal_serial_tx_wait_complete(handle);
+
+    const bool transfer_complete = (id == FuriHalSerialIdUsart) ?
+                                       LL_USART_IsActiveFlag_TC(USART1) :
+                                       LL_LPUART_IsActiveFlag_TC(LPUART1);
+
+    furi_delay_tick(2);
+    const size_t received =
+        furi_stream_buffer_receive(stream, rx_data, SERIAL_DATA_SIZE, furi_ms_to_ticks(100));
+
+    furi_hal_serial_dma_tx_stop(handle);
+    furi_hal_serial_async_rx_stop(handle);
+    furi_hal_serial_test_set_half_duplex(id, false);
+    furi_hal_serial_control_release(handle);
+
+    const bool in_order = memcmp(tx_data, rx_data, received) == 0;
+
+    furi_stream_buffer_free(stream);
+    free(rx_data);
+    free(tx_data);
+
+    mu_assert(transfer_complete, "transfer not complete after wait");
+    mu_assert_int_eq(SERIAL_DATA_SIZE, received);
+    mu_assert(in_order, "data received out of order");
+    mu_assert(released > 0, "tx callback not called");
+}
+
+MU_TEST(furi_hal_serial_usart_tx_order) {
+    furi_hal_serial_test_tx_order(FuriHalSerialIdUsart);
+}
+
+MU_TEST(furi_hal_serial_lpuart_tx_order) {
+    furi_hal_serial_test_tx_order(FuriHalSerialIdLpuart);
+}
+
 MU_TEST_SUITE(furi_hal_i2c_int_suite) {
     MU_SUITE_CONFIGURE(&furi_hal_i2c_int_setup, &furi_hal_i2c_int_teardown);
     MU_RUN_TEST(furi_hal_i2c_int_1b);
@@ -227,9 +344,15 @@ MU_TEST_SUITE(furi_hal_i2c_ext_suite) {
     MU_RUN_TEST(furi_hal_i2c_ext_eeprom);
 }
 
+MU_TEST_SUITE(furi_hal_serial_suite) {
+    MU_RUN_TEST(furi_hal_serial_usart_tx_order);
+    MU_RUN_TEST(furi_hal_serial_lpuart_tx_order);
+}
+
 int run_minunit_test_furi_hal(void) {
     MU_RUN_SUITE(furi_hal_i2c_int_suite);
     MU_RUN_SUITE(furi_hal_i2c_ext_suite);
+    MU_RUN_SUITE(furi_hal_serial_suite);
     return MU_EXIT_CODE;
 }
 
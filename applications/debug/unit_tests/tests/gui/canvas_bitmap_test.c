@@ -0,0 +1,241 @@
+#include "../test.h" // IWYU pragma: keep
+
+#include <furi.h>
+#include <furi_hal.h>
+#include <gui/canvas_i.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TAG "CanvasBitmapTest"
+
+#define TEST_BITMAP_BUFFER_SIZE (128u * 64u / 8u)
+#define TEST_BITMAP_CASES       (2000u)
+#define TEST_BITMAP_RUNS        (50u)
+
+static const u8x8_display_info_t test_canvas_display_info = {
+    .tile_width = 16,
+    .tile_height = 8,
+    .pixel_width = 128,
+    .pixel_height = 64,
+};
+
+/* Pixel by pixel blitter the canvas used before, kept as the reference */
+static void test_canvas_bitmap_reference(
+    u8g2_t* u8g2,
+    u8g2_uint_t x,
+    u8g2_uint_t y,
+    u8g2_uint_t w,
+    u8g2_uint_t h,
+    bool mirror,
+    bool rotation,
+    const uint8_t* bitmap) {
+    if(u8g2_IsIntersection(u8g2, x, y, x + w, y + h) == 0) return;
+
+    u8g2_uint_t blen = (w + 7) >> 3;
+
+    if(rotation && !mirror) {
+        x += w + 1;
+    } else if(mirror && !rotation) {
+        y += h - 1;
+    }
+
+    while(h > 0) {
+        const uint8_t* b = bitmap;
+        uint16_t len = w;
+        uint16_t x0 = x;
+        uint16_t y0 = y;
+        uint8_t mask = 1;
+        uint8_t color = u8g2->draw_color;
+        uint8_t ncolor = (color == 0 ? 1 : 0);
+
+        while(len > 0) {
+            if(*b & mask) {
+                u8g2->draw_color = color;
+                u8g2_DrawHVLine(u8g2, x0, y0, 1, 0);
+            } else if(u8g2->bitmap_transparency == 0) {
+                u8g2->draw_color = ncolor;
+                u8g2_DrawHVLine(u8g2, x0, y0, 1, 0);
+            }
+
+            if(rotation) {
+                y0++;
+            } else {
+                x0++;
+            }
+
+            mask <<= 1;
+            if(mask == 0) {
+                mask = 1;
+                b++;
+            }
+            len--;
+        }
+
+        u8g2->draw_color = color;
+        bitmap += blen;
+
+        if(mirror) {
+            if(rotation) {
+                x++;
+            } else {
+                y--;
+            }
+        } else {
+            if(rotation) {
+                x--;
+            } else {
+                y++;
+            }
+        }
+        h--;
+    }
+}
+
+static void test_canvas_bitmap_draw(
+    u8g2_t* u8g2,
+    bool reference,
+    int32_t x,
+    int32_t y,
+    size_t w,
+    size_t h,
+    const uint8_t* bitmap,
+    IconRotation rotation) {
+    if(reference) {
+        test_canvas_bitmap_reference(
+            u8g2,
+            x,
+            y,
+            w,
+            h,
+            rotation == IconRotation180 || rotation == IconRotation270,
+            rotation == IconRotation90 || rotation == IconRotation270,
+            bitmap);
+    } else {
+        canvas_draw_u8g2_bitmap(u8g2, x, y, w, h, bitmap, rotation);
+    }
+}
+
+static void test_canvas_bitmap_fill_random(uint8_t* data, size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        data[i] = rand();
+    }
+}
+
+MU_TEST(test_canvas_bitmap_pixel_exact) {
+    const u8g2_cb_t* rotations[] = {&u8g2_cb_r0, &u8g2_cb_r1, &u8g2_cb_r2, &u8g2_cb_r3};
+
+    uint8_t* expected = malloc(TEST_BITMAP_BUFFER_SIZE);
+    uint8_t* result = malloc(TEST_BITMAP_BUFFER_SIZE);
+    uint8_t* bitmap = malloc(TEST_BITMAP_BUFFER_SIZE);
+
+    u8g2_t* u8g2 = malloc(sizeof(u8g2_t));
+    u8g2->u8x8.display_info = &test_canvas_display_info;
+    u8g2_SetupBuffer(u8g2, result, 8, u8g2_ll_hvline_vertical_top_lsb, &u8g2_cb_r0);
+
+    srand(0x1CE);
+    for(size_t i = 0; i < TEST_BITMAP_CASES; i++) {
+        u8g2_SetDisplayRotation(u8g2, rotations[rand() % COUNT_OF(rotations)]);
+        if(rand() % 3 == 0) {
+            const u8g2_uint_t x0 = rand() % 140;
+            const u8g2_uint_t y0 = rand() % 140;
+            u8g2_SetClipWindow(u8g2, x0, y0, x0 + rand() % 100, y0 + rand() % 100);
+        } else {
+            u8g2_SetMaxClipWindow(u8g2);
+        }
+
+        const size_t w = rand() % 48;
+        const size_t h = rand() % 48;
+        const int32_t x = rand() % 260 - 100;
+        const int32_t y = rand() % 260 - 100;
+        const IconRotation rotation = rand() % 4;
+        u8g2->draw_color = rand() % 3;
+        u8g2->bitmap_transparency = rand() % 2;
+
+        test_canvas_bitmap_fill_random(bitmap, TEST_BITMAP_BUFFER_SIZE);
+        test_canvas_bitmap_fill_random(expected, TEST_BITMAP_BUFFER_SIZE);
+        memcpy(result, expected, TEST_BITMAP_BUFFER_SIZE);
+
+        u8g2_SetBufferPtr(u8g2, expected);
+        test_canvas_bitmap_draw(u8g2, true, x, y, w, h, bitmap, rotation);
+        u8g2_SetBufferPtr(u8g2, result);
+        test_canvas_bitmap_draw(u8g2, false, x, y, w, h, bitmap, rotation);
+
+        if(memcmp(expected, result, TEST_BITMAP_BUFFER_SIZE) != 0) {
+            FURI_LOG_E(
+                TAG,
+                "Mismatch: %zux%zu at %ld,%ld, rotation %d, color %u, transparency %u",
+                w,
+                h,
+                x,
+                y,
+                rotation,
+                u8g2->draw_color,
+                u8g2->bitmap_transparency);
+            mu_fail("fast blitter output differs from reference");
+            break;
+        }
+    }
+
+    free(u8g2);
+    free(bitmap);
+    free(result);
+    free(expected);
+}
+
+MU_TEST(test_canvas_bitmap_benchmark) {
+    uint8_t* buffer = malloc(TEST_BITMAP_BUFFER_SIZE);
+    uint8_t* bitmap = malloc(TEST_BITMAP_BUFFER_SIZE);
+    test_canvas_bitmap_fill_random(bitmap, TEST_BITMAP_BUFFER_SIZE);
+
+    u8g2_t* u8g2 = malloc(sizeof(u8g2_t));
+    u8g2->u8x8.display_info = &test_canvas_display_info;
+    u8g2_SetupBuffer(u8g2, buffer, 8, u8g2_ll_hvline_vertical_top_lsb, &u8g2_cb_r0);
+
+    uint32_t cycles[2][2];
+    for(size_t reference = 0; reference < 2; reference++) {
+        // Full screen animation frame
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < TEST_BITMAP_RUNS; i++) {
+            test_canvas_bitmap_draw(u8g2, reference, 0, 0, 128, 64, bitmap, IconRotation0);
+        }
+        cycles[reference][0] = (DWT->CYCCNT - start) / TEST_BITMAP_RUNS;
+
+        // Menu with 10 icons at unaligned positions
+        start = DWT->CYCCNT;
+        for(size_t i = 0; i < TEST_BITMAP_RUNS; i++) {
+            for(size_t icon = 0; icon < 10; icon++) {
+                test_canvas_bitmap_draw(
+                    u8g2, reference, icon * 12 + 1, icon * 5 + 3, 10, 10, bitmap, IconRotation0);
+            }
+        }
+        cycles[reference][1] = (DWT->CYCCNT - start) / TEST_BITMAP_RUNS;
+    }
+
+    FURI_LOG_I(
+        TAG,
+        "Frame 128x64: %lu cycles, reference %lu; 10 icons 10x10: %lu cycles, reference %lu",
+        cycles[0][0],
+        cycles[1][0],
+        cycles[0][1],
+        cycles[1][1]);
+
+    mu_assert(cycles[0][0] < cycles[1][0], "frame is not faster than reference");
+    mu_assert(cycles[0][1] < cycles[1][1], "icons are not faster than reference");
+
+    free(u8g2);
+    free(bitmap);
+    free(buffer);
+}
+
+MU_TEST_SUITE(test_canvas_bitmap) {
+    MU_RUN_TEST(test_canvas_bitmap_pixel_exact);
+    MU_RUN_TEST(test_canvas_bitmap_benchmark);
+}
+
+int run_minunit_test_gui(void) {
+    MU_RUN_SUITE(test_canvas_bitmap);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_gui)
@@ -0,0 +1,279 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+
+#include "../test.h" // IWYU pragma: keep
+
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_primitive_public.h>
+
+#define JS_TEST_DIR        EXT_PATH(".tmp/unit_tests/js")
+#define JS_TEST_SCRIPT     JS_TEST_DIR "/script.js"
+#define JS_TEST_MODULE     JS_TEST_DIR "/module.js"
+#define JS_TEST_CACHE_PATH JS_TEST_DIR "/cache"
+
+typedef struct {
+    const char* source;
+    const char* path; // Executed with bcode cache instead of source if set
+    uint32_t cache_version;
+    double expected;
+    uint32_t time;
+} JsTestContext;
+
+static int32_t js_test_thread(void* context) {
+    JsTestContext* test = context;
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_val_t result = MJS_UNDEFINED;
+
+    const uint32_t start = furi_get_tick();
+    mjs_err_t err;
+    if(test->path) {
+        mjs_set_bcode_cache(mjs, JS_TEST_CACHE_PATH, test->cache_version);
+        err = mjs_exec_file(mjs, test->path, &result);
+    } else {
+        err = mjs_exec(mjs, test->source, &result);
+    }
+    test->time = furi_get_tick() - start;
+
+    bool success = (err == MJS_OK) && mjs_is_number(result) &&
+                   (mjs_get_double(mjs, result) == test->expected);
+    if(err != MJS_OK) {
+        printf("mjs error: %s\r\n", mjs_strerror(mjs, err));
+    }
+
+    mjs_destroy(mjs);
+    return success;
+}
+
+// Parser is recursive, give it the same stack as JS apps get
+static bool js_test_run(JsTestContext* test) {
+    FuriThread* thread = furi_thread_alloc_ex("JsTest", 8 * 1024, js_test_thread, test);
+    furi_thread_start(thread);
+    furi_thread_join(thread);
+    bool success = furi_thread_get_return_code(thread);
+    furi_thread_free(thread);
+    return success;
+}
+
+static bool js_test_exec(const char* source, double expected, uint32_t* time) {
+    JsTestContext test = {.source = source, .expected = expected};
+    bool success = js_test_run(&test);
+    if(time) *time = test.time;
+    return success;
+}
+
+static bool js_test_write_file(const char* path, const char* source) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    bool success = storage_file_open(file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                   storage_file_write(file, source, strlen(source)) == strlen(source);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    return success;
+}
+
+static bool js_test_exec_file(const char* source, uint32_t cache_version, double expected) {
+    JsTestContext test = {
+        .path = JS_TEST_SCRIPT,
+        .cache_version = cache_version,
+        .expected = expected,
+    };
+    return js_test_write_file(JS_TEST_SCRIPT, source) && js_test_run(&test);
+}
+
+static FuriString* js_test_cache_get_path(const char* script) {
+    return furi_string_alloc_printf(
+        "%s/%08lX.jsc", JS_TEST_CACHE_PATH, crc32_calc_buffer(0, script, strlen(script)));
+}
+
+static bool js_test_cache_exists(const char* script) {
+    FuriString* cache_file = js_test_cache_get_path(script);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool exists = storage_file_exists(storage, furi_string_get_cstr(cache_file));
+    furi_record_close(RECORD_STORAGE);
+
+    furi_string_free(cache_file);
+    return exists;
+}
+
+/* Replace a string literal in cached bcode, so a run that gives the new value
+ * must have executed the cache and not the source */
+static bool js_test_cache_patch(const char* script, const char* from, const char* to) {
+    FuriString* cache_file = js_test_cache_get_path(script);
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const size_t length = strlen(from);
+    uint8_t* data = NULL;
+    bool patched = false;
+
+    furi_check(strlen(to) == length);
+
+    if(storage_file_open(
+           file, furi_string_get_cstr(cache_file), FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) {
+        const size_t size = storage_file_size(file);
+        data = malloc(size);
+        if(storage_file_read(file, data, size) == size) {
+            for(size_t i = 0; i + length <= size; i++) {
+                if(memcmp(&data[i], from, length) == 0) {
+                    patched = storage_file_seek(file, i, true) &&
+                              storage_file_write(file, to, length) == length;
+                    break;
+                }
+            }
+        }
+    }
+
+    free(data);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+    furi_string_free(cache_file);
+    return patched;
+}
+
+static void js_test_cache_remove(void) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, JS_TEST_DIR);
+    storage_simply_mkdir(storage, JS_TEST_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(js_property_cache_test) {
+    // Same site, different objects
+    mu_assert(
+        js_test_exec(
+            "let f = function(o) { return o.value; };"
+            "f({value: 1}) + f({other: 5, value: 2}) + f({value: 3});",
+            6,
+            NULL),
+        "Site must not return a property of another object");
+
+    // Own property shadows the prototype one after the first lookups
+    mu_assert(
+        js_test_exec(
+            "let p = {x: 5}; let q = Object.create(p); let r = 0;"
+            "for(let i = 0; i < 10; i++) { r = r + q.x; if(i === 4) { q.x = 100; } } r;",
+            525,
+            NULL),
+        "Own property must shadow the prototype");
+
+    // Long names compared by contents, and updated values seen
+    mu_assert(
+        js_test_exec(
+            "let o = {long_property_name: 1}; let s = 0;"
+            "for(let i = 0; i < 10; i++) { s = s + o.long_property_name;"
+            " o.long_property_name = o.long_property_name + 1; } s;",
+            55,
+            NULL),
+        "Long property name lookup error");
+
+    // Objects die and get collected while the site is hot
+    mu_assert(
+        js_test_exec(
+            "let s = 0;"
+            "for(let i = 0; i < 300; i++) { let o = {counter_value: i, pad: 'some long string'};"
+            " s = s + o.counter_value; } s;",
+            44850,
+            NULL),
+        "Lookup across GC error");
+}
+
+MU_TEST(js_property_bench_test) {
+    uint32_t time = 0;
+    mu_assert(
+        js_test_exec(
+            "let o = {a: 1, bb: 2, longname: 3, another_long: 4}; let s = 0;"
+            "for(let i = 0; i < 2000; i++)"
+            " { s = s + o.a + o.bb + o.longname + o.another_long; } s;",
+            2000 * 10,
+            &time),
+        "Property loop error");
+    printf("2000 property loop iterations: %lums\r\n", time);
+}
+
+MU_TEST(js_array_bench_test) {
+    uint32_t time = 0;
+    mu_assert(
+        js_test_exec(
+            "let a = []; for(let i = 0; i < 100; i++) { a.push(i); } let t = 0;"
+            "for(let k = 0; k < 20; k++)"
+            " { for(let i = 0; i < a.length; i++) { t = t + a[i]; } } t;",
+            20 * 4950,
+            &time),
+        "Array iteration error");
+    printf("20 iterations over 100 array items: %lums\r\n", time);
+}
+
+MU_TEST(js_bcode_cache_test) {
+    js_test_cache_remove();
+
+    // Char code of 'm' comes from the source, 'h' only from the patched cache
+    mu_assert(
+        js_test_exec_file("let a = 'cache_miss'; a.at(6);", 1, 'm'), "Uncached run error");
+    mu_assert(js_test_cache_exists(JS_TEST_SCRIPT), "Bcode was not cached");
+    mu_assert(js_test_cache_patch(JS_TEST_SCRIPT, "cache_miss", "cache_hits"), "Patch error");
+    mu_assert(js_test_exec_file("let a = 'cache_miss'; a.at(6);", 1, 'h'), "Cache was not hit");
+
+    // Same size, different contents
+    mu_assert(
+        js_test_exec_file("let a = 'cache_miss'; a.at(8);", 1, 's'),
+        "Stale source was not detected");
+    mu_assert(js_test_cache_patch(JS_TEST_SCRIPT, "cache_miss", "cache_hits"), "Patch error");
+    mu_assert(js_test_exec_file("let a = 'cache_miss'; a.at(8);", 2, 's'), "Version change error");
+
+    js_test_cache_remove();
+    mu_assert(!js_test_exec_file("let a = ;", 1, 0), "Syntax error was not reported");
+    mu_assert(!js_test_cache_exists(JS_TEST_SCRIPT), "Bcode with errors was cached");
+
+    js_test_cache_remove();
+}
+
+MU_TEST(js_bcode_cache_module_test) {
+    js_test_cache_remove();
+
+    // Functions, loops and branches, loaded after the main script bcode part
+    mu_assert(
+        js_test_write_file(
+            JS_TEST_MODULE,
+            "function fib(n) { let a = 0; let b = 1;"
+            " for(let i = 0; i < n; i++) { let t = a + b; a = b; b = t; } return a; }"
+            "function sum(n) { let s = 0; let i = 0;"
+            " while(i < n) { if(i % 2 === 0) { s = s + i; } else { s = s - 1; } i++; }"
+            " return s; }"
+            "let marker = 'module_miss';"
+            "fib(20) + sum(10) * 1000 + marker.at(7);"),
+        "Module write error");
+
+    mu_assert(
+        js_test_exec_file("load('" JS_TEST_MODULE "');", 1, 6765 + 15000 + 'm'),
+        "Uncached module error");
+    mu_assert(js_test_cache_exists(JS_TEST_MODULE), "Module bcode was not cached");
+    mu_assert(js_test_cache_patch(JS_TEST_MODULE, "module_miss", "module_hits"), "Patch error");
+
+    // Longer main script moves the cached module to another bcode offset
+    mu_assert(
+        js_test_exec_file(
+            "let pad = [1, 2, 3]; let r = load('" JS_TEST_MODULE "'); r + pad.length - 3;",
+            1,
+            6765 + 15000 + 'h'),
+        "Cached module error");
+
+    js_test_cache_remove();
+}
+
+MU_TEST_SUITE(test_js_suite) {
+    MU_RUN_TEST(js_property_cache_test);
+    MU_RUN_TEST(js_property_bench_test);
+    MU_RUN_TEST(js_array_bench_test);
+    MU_RUN_TEST(js_bcode_cache_test);
+    MU_RUN_TEST(js_bcode_cache_module_test);
+}
+
+int run_minunit_test_js(void) {
+    MU_RUN_SUITE(test_js_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_js)
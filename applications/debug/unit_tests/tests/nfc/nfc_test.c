@@ -24,6 +24,7 @@
 #include <nfc/nfc_poller.h>
 
 #include <toolbox/keys_dict.h>
+#include <toolbox/keys_dict_prefetcher.h>
 #include <nfc/nfc.h>
 
 #include "../test.h" // IWYU pragma: keep
@@ -32,6 +33,9 @@
 
 #define NFC_TEST_NFC_DEV_PATH                  EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
+#define NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH    EXT_PATH("unit_tests/mf_dict_bench.nfc")
+#define NFC_TEST_MF_CLASSIC_DICT_BENCH_KEYS    (600)
+#define NFC_TEST_MF_CLASSIC_DICT_BENCH_TIMEOUT (60000)
 
 #define NFC_TEST_FLAG_WORKER_DONE (1)
 
@@ -50,6 +54,15 @@ typedef struct {
     FuriThreadId thread_id;
 } NfcTestMfClassicSendFrameTest;
 
+typedef struct {
+    KeysDict* dict;
+    KeysDictPrefetcher* prefetcher;
+    MfClassicData* data;
+    size_t keys_requested;
+    bool success;
+    FuriThreadId thread_id;
+} NfcTestMfClassicDictAttack;
+
 typedef enum {
     NfcTestSlixPollerSetPasswordStateGetRandomNumber,
     NfcTestSlixPollerSetPasswordStateSetPassword,
@@ -644,12 +657,243 @@ MU_TEST(mf_classic_dict_test) {
         dict_keys_total == test_key_num - COUNT_OF(delete_keys_idx),
         "keys_dict_keys_total() failed");
 
+    keys_dict_free(dict);
+
+    // Reopened dict is served by the rebuilt index
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "keys_dict_alloc() failed");
+
+    dict_keys_total = keys_dict_get_total_keys(dict);
+    mu_assert(
+        dict_keys_total == test_key_num - COUNT_OF(delete_keys_idx),
+        "keys_dict_keys_total() failed");
+
+    for(size_t i = 0, j = 0; i < test_key_num; i++) {
+        bool is_deleted = (j < COUNT_OF(delete_keys_idx)) && (delete_keys_idx[j] == i);
+        if(is_deleted) j++;
+        mu_assert(
+            keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)) !=
+                is_deleted,
+            "keys_dict_is_key_present() failed");
+    }
+
+    // Adding a key in the middle of iteration moves it from the index to the text
+    MfClassicKey key_added = {};
+    furi_hal_random_fill_buf(key_added.data, sizeof(MfClassicKey));
+    size_t keys_read = 0;
+    for(size_t i = 0, j = 0; i < test_key_num; i++) {
+        if((j < COUNT_OF(delete_keys_idx)) && (delete_keys_idx[j] == i)) {
+            j++;
+            continue;
+        }
+        if(keys_read == dict_keys_total / 2) {
+            mu_assert(
+                keys_dict_add_key(dict, key_added.data, sizeof(MfClassicKey)),
+                "add key failed");
+        }
+        mu_assert(
+            keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey)),
+            "keys_dict_get_next_key() failed");
+        mu_assert(
+            memcmp(key_arr_ref[i].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+            "Iteration position lost on key add");
+        keys_read++;
+    }
+    mu_assert(
+        keys_dict_get_next_key(dict, key_dut.data, sizeof(MfClassicKey)) &&
+            memcmp(key_added.data, key_dut.data, sizeof(MfClassicKey)) == 0,
+        "Added key must come last");
+
     keys_dict_free(dict);
     free(key_arr_ref);
 
     mu_assert(
         storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
         "Remove test dict failed");
+    mu_assert(
+        storage_simply_remove(
+            storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH KEYS_DICT_INDEX_EXTENSION),
+        "Remove test dict index failed");
+}
+
+static void mf_classic_dict_bench_remove(Storage* storage) {
+    storage_simply_remove(storage, NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH);
+    storage_simply_remove(
+        storage, NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH KEYS_DICT_INDEX_EXTENSION);
+}
+
+MU_TEST(mf_classic_dict_prefetcher_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mf_classic_dict_bench_remove(storage);
+
+    const size_t test_key_num = KEYS_DICT_PREFETCHER_BLOCK_KEYS * 2 + 17;
+    KeysDict* dict = keys_dict_alloc(
+        NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "keys_dict_alloc() failed");
+
+    MfClassicKey* key_arr_ref = malloc(test_key_num * sizeof(MfClassicKey));
+    for(size_t i = 0; i < test_key_num; i++) {
+        furi_hal_random_fill_buf(key_arr_ref[i].data, sizeof(MfClassicKey));
+        mu_assert(
+            keys_dict_add_key(dict, key_arr_ref[i].data, sizeof(MfClassicKey)), "add key failed");
+    }
+    keys_dict_free(dict);
+
+    dict = keys_dict_alloc(
+        NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    KeysDictPrefetcher* prefetcher = keys_dict_prefetcher_alloc(dict, sizeof(MfClassicKey));
+
+    // Rewind both inside the first block and after it
+    const size_t rewind_at[] = {5, test_key_num, KEYS_DICT_PREFETCHER_BLOCK_KEYS + 3};
+    for(size_t i = 0; i < COUNT_OF(rewind_at); i++) {
+        MfClassicKey key_dut = {};
+        size_t key_idx = 0;
+        while(key_idx < rewind_at[i] &&
+              keys_dict_prefetcher_get_next_key(prefetcher, key_dut.data, sizeof(MfClassicKey))) {
+            mu_assert(
+                memcmp(key_arr_ref[key_idx].data, key_dut.data, sizeof(MfClassicKey)) == 0,
+                "Prefetched key data mismatch");
+            key_idx++;
+        }
+        mu_assert(key_idx == MIN(rewind_at[i], test_key_num), "Prefetched keys count mismatch");
+        keys_dict_prefetcher_rewind(prefetcher);
+    }
+
+    keys_dict_prefetcher_free(prefetcher);
+    keys_dict_free(dict);
+    free(key_arr_ref);
+
+    mf_classic_dict_bench_remove(storage);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static NfcCommand mf_classic_dict_attack_bench_callback(NfcGenericEvent event, void* context) {
+    furi_check(event.event_data);
+    furi_check(context);
+
+    NfcCommand command = NfcCommandContinue;
+    MfClassicPollerEvent* mfc_event = event.event_data;
+    NfcTestMfClassicDictAttack* attack = context;
+
+    if(mfc_event->type == MfClassicPollerEventTypeRequestMode) {
+        mfc_event->data->poller_mode.mode = MfClassicPollerModeDictAttack;
+        mfc_event->data->poller_mode.data = attack->data;
+    } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
+        MfClassicKey* key = &mfc_event->data->key_request_data.key;
+        if(attack->prefetcher) {
+            mfc_event->data->key_request_data.key_provided = keys_dict_prefetcher_get_next_key(
+                attack->prefetcher, key->data, sizeof(MfClassicKey));
+        } else {
+            mfc_event->data->key_request_data.key_provided =
+                keys_dict_get_next_key(attack->dict, key->data, sizeof(MfClassicKey));
+        }
+        attack->keys_requested++;
+    } else if(
+        mfc_event->type == MfClassicPollerEventTypeNextSector ||
+        mfc_event->type == MfClassicPollerEventTypeKeyAttackStop) {
+        if(attack->prefetcher) {
+            keys_dict_prefetcher_rewind(attack->prefetcher);
+        } else {
+            keys_dict_rewind(attack->dict);
+        }
+    } else if(mfc_event->type == MfClassicPollerEventTypeSuccess) {
+        attack->success = true;
+        command = NfcCommandStop;
+    } else if(mfc_event->type == MfClassicPollerEventTypeCardLost) {
+        command = NfcCommandStop;
+    }
+
+    if(command == NfcCommandStop) {
+        furi_thread_flags_set(attack->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+    }
+
+    return command;
+}
+
+static uint32_t mf_classic_dict_attack_bench_run(NfcTestMfClassicDictAttack* attack) {
+    Nfc* poller = nfc_alloc();
+    Nfc* listener = nfc_alloc();
+
+    NfcDevice* nfc_device = nfc_device_alloc();
+    nfc_data_generator_fill_data(NfcDataGeneratorTypeMfClassicMini, nfc_device);
+    NfcListener* mfc_listener = nfc_listener_alloc(
+        listener, NfcProtocolMfClassic, nfc_device_get_data(nfc_device, NfcProtocolMfClassic));
+    nfc_listener_start(mfc_listener, NULL, NULL);
+
+    // Start with no keys known, the dictionary ends with the default key
+    attack->data = mf_classic_alloc();
+    mf_classic_copy(attack->data, nfc_device_get_data(nfc_device, NfcProtocolMfClassic));
+    attack->data->key_a_mask = 0;
+    attack->data->key_b_mask = 0;
+    memset(attack->data->block_read_mask, 0, sizeof(attack->data->block_read_mask));
+    attack->keys_requested = 0;
+    attack->success = false;
+    attack->thread_id = furi_thread_get_current_id();
+
+    uint32_t attack_start = furi_get_tick();
+    NfcPoller* mfc_poller = nfc_poller_alloc(poller, NfcProtocolMfClassic);
+    nfc_poller_start(mfc_poller, mf_classic_dict_attack_bench_callback, attack);
+
+    uint32_t flag = furi_thread_flags_wait(
+        NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, NFC_TEST_MF_CLASSIC_DICT_BENCH_TIMEOUT);
+    uint32_t attack_time = furi_get_tick() - attack_start;
+    // Attack stays unsuccessful on timeout
+    if(flag != NFC_TEST_FLAG_WORKER_DONE) attack->success = false;
+
+    nfc_poller_stop(mfc_poller);
+    nfc_poller_free(mfc_poller);
+    nfc_listener_stop(mfc_listener);
+    nfc_listener_free(mfc_listener);
+    mf_classic_free(attack->data);
+    nfc_device_free(nfc_device);
+    nfc_free(listener);
+    nfc_free(poller);
+
+    return attack_time;
+}
+
+MU_TEST(mf_classic_dict_attack_benchmark_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mf_classic_dict_bench_remove(storage);
+
+    KeysDict* dict = keys_dict_alloc(
+        NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
+    for(size_t i = 0; i < NFC_TEST_MF_CLASSIC_DICT_BENCH_KEYS; i++) {
+        MfClassicKey key = {};
+        furi_hal_random_fill_buf(key.data, sizeof(MfClassicKey));
+        keys_dict_add_key(dict, key.data, sizeof(MfClassicKey));
+    }
+    const MfClassicKey default_key = {.data = {0xff, 0xff, 0xff, 0xff, 0xff, 0xff}};
+    keys_dict_add_key(dict, default_key.data, sizeof(MfClassicKey));
+    keys_dict_free(dict);
+
+    NfcTestMfClassicDictAttack attack = {};
+
+    // Reference: keys are read from storage on every request
+    attack.dict = keys_dict_alloc(
+        NFC_TEST_MF_CLASSIC_DICT_BENCH_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    uint32_t direct_time = mf_classic_dict_attack_bench_run(&attack);
+    size_t direct_keys = attack.keys_requested;
+    mu_assert(attack.success, "Dict attack failed");
+
+    // Prefetcher: keys are decoded in blocks on a background thread
+    attack.prefetcher = keys_dict_prefetcher_alloc(attack.dict, sizeof(MfClassicKey));
+    uint32_t prefetch_time = mf_classic_dict_attack_bench_run(&attack);
+    size_t prefetch_keys = attack.keys_requested;
+    mu_assert(attack.success, "Dict attack failed");
+    keys_dict_prefetcher_free(attack.prefetcher);
+    keys_dict_free(attack.dict);
+
+    // Every requested key is tried as key A and key B
+    printf(
+        "Dict attack: direct %lu auth/s, prefetched %lu auth/s\r\n",
+        (uint32_t)(direct_keys * 2 * 1000 / MAX(direct_time, 1UL)),
+        (uint32_t)(prefetch_keys * 2 * 1000 / MAX(prefetch_time, 1UL)));
+    mu_assert(direct_keys == prefetch_keys, "Requested keys count mismatch");
+
+    mf_classic_dict_bench_remove(storage);
+    furi_record_close(RECORD_STORAGE);
 }
 
 static FelicaError
@@ -864,6 +1108,8 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(mf_classic_dict_prefetcher_test);
+    MU_RUN_TEST(mf_classic_dict_attack_benchmark_test);
     MU_RUN_TEST(felica_read);
     MU_RUN_TEST(felica_read_auth);
 
@@ -389,6 +389,23 @@ static void test_rpc_add_read_or_write_to_list(
     } while(pattern_repeats);
 }
 
+static void test_rpc_add_chunks_to_list(
+    MsgList_t msg_list,
+    bool write,
+    const char* path,
+    const uint8_t* data,
+    size_t size,
+    size_t chunk_size,
+    uint32_t command_id) {
+    do {
+        size_t part_size = MIN(size, chunk_size);
+        test_rpc_add_read_or_write_to_list(msg_list, write, path, data, part_size, 1, command_id);
+        data += part_size;
+        size -= part_size;
+        MsgList_back(msg_list)->has_next = (size > 0);
+    } while(size);
+}
+
 static void test_rpc_encode_and_feed_one(PB_Main* request, uint8_t session) {
     furi_check(request);
     furi_check(session < TEST_RPC_SESSIONS);
@@ -547,11 +564,19 @@ static bool test_rpc_pb_stream_read(pb_istream_t* istream, pb_byte_t* buf, size_
     RpcSessionContext* session_context = istream->state;
     size_t bytes_received = 0;
 
-    uint32_t now = furi_get_tick();
-    int32_t time_left = session_context->timeout - now;
-    time_left = MAX(time_left, 0);
-    bytes_received =
-        furi_stream_buffer_receive(session_context->output_stream, buf, count, time_left);
+    // Messages are streamed in several chunks, large fields may arrive in parts
+    while(bytes_received < count) {
+        int32_t time_left = session_context->timeout - furi_get_tick();
+        time_left = MAX(time_left, 0);
+        size_t received = furi_stream_buffer_receive(
+            session_context->output_stream,
+            &buf[bytes_received],
+            count - bytes_received,
+            time_left);
+        if(!received) break;
+        bytes_received += received;
+    }
+
     return count == bytes_received;
 }
 
@@ -1001,6 +1026,70 @@ MU_TEST(test_storage_read) {
     test_storage_read_run(TEST_DIR "file4.txt", ++command_id);
 }
 
+#define TEST_READ_THROUGHPUT_SIZE (64u * 1024u)
+
+static void test_storage_read_throughput_run(const char* path, uint32_t command_id) {
+    PB_Main request;
+    test_rpc_create_simple_message(&request, PB_Main_storage_read_request_tag, path, command_id);
+
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+
+    size_t bytes_received = 0;
+    size_t messages_received = 0;
+    bool has_next = true;
+
+    const uint32_t start = furi_get_tick();
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    while(has_next) {
+        rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+        if(!pb_decode_ex(&istream, &PB_Main_msg, &result, PB_DECODE_DELIMITED)) {
+            mu_fail("read response not decoded");
+            break;
+        }
+
+        mu_check(result.command_id == command_id);
+        mu_check(result.command_status == PB_CommandStatus_OK);
+        mu_check(result.which_content == PB_Main_storage_read_response_tag);
+        mu_check(result.content.storage_read_response.file.data);
+
+        bytes_received += result.content.storage_read_response.file.data->size;
+        messages_received++;
+        has_next = result.has_next;
+        pb_release(&PB_Main_msg, &result);
+    }
+
+    const uint32_t elapsed_ms =
+        (furi_get_tick() - start) * 1000 / furi_kernel_get_tick_frequency();
+
+    mu_assert_int_eq(TEST_READ_THROUGHPUT_SIZE, bytes_received);
+    mu_assert_int_eq(
+        (TEST_READ_THROUGHPUT_SIZE + MAX_DATA_SIZE - 1) / MAX_DATA_SIZE, messages_received);
+
+    FURI_LOG_I(
+        TAG,
+        "Read %zu bytes in %zu chunks: %lums, %luKiB/s",
+        bytes_received,
+        messages_received,
+        elapsed_ms,
+        (uint32_t)(bytes_received / MAX(elapsed_ms, 1U) * 1000 / 1024));
+
+    pb_release(&PB_Main_msg, &request);
+}
+
+// Baseline of the fixed read chunk size, reported only: no larger chunk to compare against
+MU_TEST(test_storage_read_throughput) {
+    test_create_file(TEST_DIR "throughput.bin", TEST_READ_THROUGHPUT_SIZE);
+
+    test_storage_read_throughput_run(TEST_DIR "throughput.bin", ++command_id);
+}
+
 static void test_storage_write_run(
     const char* path,
     size_t write_size,
@@ -1093,6 +1182,112 @@ MU_TEST(test_storage_write) {
     test_storage_write_run(TEST_DIR "test2.txt", 512, 3, ++command_id, PB_CommandStatus_OK);
 }
 
+// Spans several card writes and read responses, write requests are aligned to neither of them
+#define TEST_MULTI_CHUNK_SIZE       (9000u)
+#define TEST_MULTI_CHUNK_WRITE_SIZE (300u)
+
+static uint8_t* test_storage_multi_chunk_data_alloc(void) {
+    uint8_t* data = malloc(TEST_MULTI_CHUNK_SIZE);
+    // Differs between chunks, so reordered or repeated chunks are caught
+    for(size_t i = 0; i < TEST_MULTI_CHUNK_SIZE; ++i) {
+        data[i] = (uint8_t)(i ^ (i >> 8));
+    }
+    return data;
+}
+
+MU_TEST(test_storage_write_read_multi_chunk) {
+    const char* path = TEST_DIR "multi_chunk.bin";
+    uint8_t* data = test_storage_multi_chunk_data_alloc();
+
+    MsgList_t input_msg_list;
+    MsgList_init(input_msg_list);
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    test_rpc_add_chunks_to_list(
+        input_msg_list,
+        WRITE_REQUEST,
+        path,
+        data,
+        TEST_MULTI_CHUNK_SIZE,
+        TEST_MULTI_CHUNK_WRITE_SIZE,
+        ++command_id);
+    test_rpc_add_empty_to_list(expected_msg_list, PB_CommandStatus_OK, command_id);
+
+    test_rpc_create_simple_message(
+        MsgList_push_raw(input_msg_list), PB_Main_storage_read_request_tag, path, ++command_id);
+    test_rpc_add_chunks_to_list(
+        expected_msg_list,
+        READ_RESPONSE,
+        path,
+        data,
+        TEST_MULTI_CHUNK_SIZE,
+        MAX_DATA_SIZE,
+        command_id);
+
+    test_rpc_encode_and_feed(input_msg_list, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+
+    test_rpc_free_msg_list(input_msg_list);
+    test_rpc_free_msg_list(expected_msg_list);
+    free(data);
+}
+
+MU_TEST(test_storage_write_error_mid_transfer) {
+    const char* path = TEST_DIR "multi_chunk.bin";
+    uint8_t* data = test_storage_multi_chunk_data_alloc();
+    // More than one card write is in flight when the upload fails
+    const size_t accepted_size = TEST_MULTI_CHUNK_WRITE_SIZE * 19;
+
+    MsgList_t input_msg_list;
+    MsgList_init(input_msg_list);
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+
+    test_rpc_add_chunks_to_list(
+        input_msg_list,
+        WRITE_REQUEST,
+        path,
+        data,
+        accepted_size + TEST_MULTI_CHUNK_WRITE_SIZE,
+        TEST_MULTI_CHUNK_WRITE_SIZE,
+        ++command_id);
+
+    // Upload is cut short by a request that is rejected
+    PB_Main* request = MsgList_back(input_msg_list);
+    free(request->content.storage_write_request.path);
+    request->content.storage_write_request.path = strdup(TEST_DIR "multi?chunk.bin");
+    request->has_next = true;
+
+    test_rpc_add_empty_to_list(
+        expected_msg_list, PB_CommandStatus_ERROR_STORAGE_INVALID_NAME, command_id);
+
+    test_rpc_encode_and_feed(input_msg_list, 0);
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+
+    test_rpc_free_msg_list(input_msg_list);
+    test_rpc_free_msg_list(expected_msg_list);
+
+    // Data queued before the failure is on the card, the file is closed
+    Storage* fs_api = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(fs_api);
+    mu_check(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(accepted_size, storage_file_size(file));
+    uint8_t* buffer = malloc(accepted_size);
+    mu_assert_int_eq(accepted_size, storage_file_read(file, buffer, accepted_size));
+    mu_assert_mem_eq(data, buffer, accepted_size);
+    free(buffer);
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    // Session accepts new uploads
+    uint8_t pattern[] = "abcdefgh";
+    test_storage_write_read_run(path, pattern, sizeof(pattern), 3, &command_id);
+
+    free(data);
+}
+
 MU_TEST(test_storage_interrupt_continuous_same_system) {
     MsgList_t input_msg_list;
     MsgList_init(input_msg_list);
@@ -1495,8 +1690,11 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_list_md5);
     MU_RUN_TEST(test_storage_list_size);
     MU_RUN_TEST(test_storage_read);
+    MU_RUN_TEST(test_storage_read_throughput);
     MU_RUN_TEST(test_storage_write_read);
     MU_RUN_TEST(test_storage_write);
+    MU_RUN_TEST(test_storage_write_read_multi_chunk);
+    MU_RUN_TEST(test_storage_write_error_mid_transfer);
     MU_RUN_TEST(test_storage_delete);
     MU_RUN_TEST(test_storage_delete_recursive);
     MU_RUN_TEST(test_storage_mkdir);
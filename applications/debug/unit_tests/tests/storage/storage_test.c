@@ -175,6 +175,69 @@ MU_TEST(storage_file_read_write_64k) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_BENCH_CHUNK_SIZE  (64U * 1024U)
+#define STORAGE_BENCH_CHUNK_COUNT (8U)
+
+static void storage_file_benchmark_print(const char* name, uint32_t ticks) {
+    const uint32_t bytes = STORAGE_BENCH_CHUNK_SIZE * STORAGE_BENCH_CHUNK_COUNT;
+    const uint32_t kb_per_s =
+        (uint64_t)bytes * furi_kernel_get_tick_frequency() / MAX(ticks, 1UL) / 1024;
+    printf(
+        "Sequential 64K %s: %lu.%02lu MB/s\r\n",
+        name,
+        kb_per_s / 1024,
+        (kb_per_s % 1024) * 100 / 1024);
+}
+
+MU_TEST(storage_file_benchmark_64k) {
+    const char* filename = UNIT_TESTS_PATH("storage_bench.test");
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    if(memmgr_heap_get_max_free_block() < STORAGE_BENCH_CHUNK_SIZE) {
+        mu_warn("Not enough RAM for 64k benchmark");
+    } else {
+        uint8_t* data = malloc(STORAGE_BENCH_CHUNK_SIZE);
+        for(size_t i = 0; i < STORAGE_BENCH_CHUNK_SIZE; i++) {
+            data[i] = i % 113;
+        }
+
+        // Whole clusters go straight to the card as multi-block transfers
+        mu_check(storage_file_open(file, filename, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+        uint32_t ticks = furi_get_tick();
+        for(size_t i = 0; i < STORAGE_BENCH_CHUNK_COUNT; i++) {
+            mu_check(
+                storage_file_write(file, data, STORAGE_BENCH_CHUNK_SIZE) ==
+                STORAGE_BENCH_CHUNK_SIZE);
+        }
+        mu_check(storage_file_sync(file));
+        storage_file_benchmark_print("write", furi_get_tick() - ticks);
+        storage_file_close(file);
+
+        mu_check(storage_file_open(file, filename, FSAM_READ, FSOM_OPEN_EXISTING));
+        ticks = furi_get_tick();
+        bool data_valid = true;
+        for(size_t i = 0; i < STORAGE_BENCH_CHUNK_COUNT; i++) {
+            memset(data, 0, STORAGE_BENCH_CHUNK_SIZE);
+            mu_check(
+                storage_file_read(file, data, STORAGE_BENCH_CHUNK_SIZE) ==
+                STORAGE_BENCH_CHUNK_SIZE);
+            data_valid &= (data[0] == 0) &&
+                          (data[STORAGE_BENCH_CHUNK_SIZE - 1] ==
+                           (STORAGE_BENCH_CHUNK_SIZE - 1) % 113);
+        }
+        storage_file_benchmark_print("read", furi_get_tick() - ticks);
+        storage_file_close(file);
+        mu_check(data_valid);
+
+        free(data);
+    }
+
+    storage_simply_remove(storage, filename);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
@@ -184,6 +247,7 @@ MU_TEST_SUITE(storage_file) {
 
 MU_TEST_SUITE(storage_file_64k) {
     MU_RUN_TEST(storage_file_read_write_64k);
+    MU_RUN_TEST(storage_file_benchmark_64k);
 }
 
 MU_TEST(storage_dir_open_close) {
@@ -5,6 +5,7 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_file.h>
 #include <lib/subghz/protocols/protocol_items.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
@@ -19,6 +20,13 @@
 #define TEST_RANDOM_DIR_NAME    EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT            10000
+#define TEST_RAW_BINARY_NAME    EXT_PATH(".tmp/unit_tests/subghz_raw_binary.sub")
+#define TEST_RAW_TEXT_NAME      EXT_PATH(".tmp/unit_tests/subghz_raw_text.sub")
+#define TEST_RAW_SEEK_SAMPLES   1024
+
+#define TEST_BENCHMARK_PULSES_MAX 8192
+#define TEST_BENCHMARK_ROUNDS     4
+#define TEST_BENCHMARK_BATCH      64
 
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
@@ -211,6 +219,208 @@ static bool subghz_encoder_test(const char* path) {
     return subghz_test_decoder_count ? true : false;
 }
 
+static size_t subghz_benchmark_load(const char* path, LevelDuration* pulses, size_t pulses_max) {
+    size_t pulses_count = 0;
+
+    SubGhzFileEncoderWorker* file_worker = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(file_worker, path, NULL)) {
+        // the worker needs a file in order to open and read part of the file
+        furi_delay_ms(100);
+
+        uint32_t load_start = furi_get_tick();
+        while((pulses_count < pulses_max) && (furi_get_tick() - load_start < TEST_TIMEOUT)) {
+            LevelDuration level_duration =
+                subghz_file_encoder_worker_get_level_duration(file_worker);
+            if(level_duration_is_reset(level_duration)) {
+                break;
+            } else if(level_duration_is_wait(level_duration)) {
+                furi_thread_yield();
+            } else {
+                pulses[pulses_count++] = level_duration;
+            }
+        }
+
+        if(subghz_file_encoder_worker_is_running(file_worker)) {
+            subghz_file_encoder_worker_stop(file_worker);
+        }
+    }
+    subghz_file_encoder_worker_free(file_worker);
+
+    return pulses_count;
+}
+
+static void subghz_benchmark_decoder_callback(SubGhzProtocolDecoderBase* decoder, void* context) {
+    UNUSED(decoder);
+    uint32_t* decoded = context;
+    (*decoded)++;
+}
+
+static void subghz_benchmark_receiver_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(receiver);
+    UNUSED(decoder_base);
+    uint32_t* decoded = context;
+    (*decoded)++;
+}
+
+MU_TEST(subghz_receiver_benchmark_test) {
+    LevelDuration* pulses = malloc(sizeof(LevelDuration) * TEST_BENCHMARK_PULSES_MAX);
+    size_t pulses_count =
+        subghz_benchmark_load(TEST_RANDOM_DIR_NAME, pulses, TEST_BENCHMARK_PULSES_MAX);
+    mu_assert(pulses_count > 0, "Benchmark data load error\r\n");
+
+    // Reference: every decodable decoder sees every pulse
+    const SubGhzProtocolRegistry* registry =
+        subghz_environment_get_protocol_registry(environment_handler);
+    size_t decoders_count = subghz_protocol_registry_count(registry);
+    SubGhzProtocolDecoderBase** decoders =
+        malloc(sizeof(SubGhzProtocolDecoderBase*) * decoders_count);
+    uint32_t reference_decoded = 0;
+
+    for(size_t i = 0; i < decoders_count; i++) {
+        const SubGhzProtocol* protocol = subghz_protocol_registry_get_by_index(registry, i);
+        decoders[i] = NULL;
+        if(protocol->decoder && protocol->decoder->alloc &&
+           (protocol->flag & SubGhzProtocolFlag_Decodable)) {
+            decoders[i] = protocol->decoder->alloc(environment_handler);
+            subghz_protocol_decoder_base_set_decoder_callback(
+                decoders[i], subghz_benchmark_decoder_callback, &reference_decoded);
+        }
+    }
+
+    uint32_t reference_start = furi_get_tick();
+    for(size_t round = 0; round < TEST_BENCHMARK_ROUNDS; round++) {
+        for(size_t i = 0; i < pulses_count; i++) {
+            bool level = level_duration_get_level(pulses[i]);
+            uint32_t duration = level_duration_get_duration(pulses[i]);
+            for(size_t j = 0; j < decoders_count; j++) {
+                if(decoders[j]) decoders[j]->protocol->decoder->feed(decoders[j], level, duration);
+            }
+        }
+    }
+    uint32_t reference_time = furi_get_tick() - reference_start;
+
+    for(size_t i = 0; i < decoders_count; i++) {
+        if(decoders[i]) decoders[i]->protocol->decoder->free(decoders[i]);
+    }
+    free(decoders);
+
+    // Receiver: idle decoders are skipped by their preamble window
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment_handler);
+    uint32_t receiver_decoded = 0;
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(
+        receiver, subghz_benchmark_receiver_callback, &receiver_decoded);
+
+    uint32_t receiver_start = furi_get_tick();
+    for(size_t round = 0; round < TEST_BENCHMARK_ROUNDS; round++) {
+        for(size_t i = 0; i < pulses_count; i++) {
+            subghz_receiver_decode(
+                receiver,
+                level_duration_get_level(pulses[i]),
+                level_duration_get_duration(pulses[i]));
+        }
+    }
+    uint32_t receiver_time = furi_get_tick() - receiver_start;
+    uint32_t receiver_single_decoded = receiver_decoded;
+
+    // Receiver batch: blocks of pulses, as handed over by SubGhzWorker
+    subghz_receiver_reset(receiver);
+    receiver_decoded = 0;
+
+    uint32_t batch_start = furi_get_tick();
+    for(size_t round = 0; round < TEST_BENCHMARK_ROUNDS; round++) {
+        for(size_t i = 0; i < pulses_count; i += TEST_BENCHMARK_BATCH) {
+            subghz_receiver_decode_batch(
+                receiver, &pulses[i], MIN(pulses_count - i, (size_t)TEST_BENCHMARK_BATCH));
+        }
+    }
+    uint32_t batch_time = furi_get_tick() - batch_start;
+
+    subghz_receiver_free(receiver);
+    free(pulses);
+
+    uint32_t pulses_total = pulses_count * TEST_BENCHMARK_ROUNDS;
+    printf(
+        "SubGhz receiver benchmark: %lu pulses, every decoder %lu pulses/s, "
+        "dispatch %lu pulses/s, batch %lu pulses/s\r\n",
+        pulses_total,
+        pulses_total * 1000 / MAX(reference_time, 1UL),
+        pulses_total * 1000 / MAX(receiver_time, 1UL),
+        pulses_total * 1000 / MAX(batch_time, 1UL));
+
+    mu_assert_int_eq(reference_decoded, receiver_single_decoded);
+    mu_assert_int_eq(reference_decoded, receiver_decoded);
+}
+
+static void subghz_benchmark_reset_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(decoder_base);
+    uint32_t* decoded = context;
+    (*decoded)++;
+    // Same as the SubGhz app receiver scene
+    subghz_receiver_reset(receiver);
+}
+
+static uint32_t subghz_receiver_reset_run(
+    const LevelDuration* pulses,
+    size_t pulses_count,
+    size_t batch,
+    uint32_t* time) {
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment_handler);
+    uint32_t decoded = 0;
+    subghz_receiver_set_filter(receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(receiver, subghz_benchmark_reset_callback, &decoded);
+
+    uint32_t start = furi_get_tick();
+    for(size_t round = 0; round < TEST_BENCHMARK_ROUNDS; round++) {
+        for(size_t i = 0; i < pulses_count; i += batch) {
+            if(batch == 1) {
+                subghz_receiver_decode(
+                    receiver,
+                    level_duration_get_level(pulses[i]),
+                    level_duration_get_duration(pulses[i]));
+            } else {
+                subghz_receiver_decode_batch(receiver, &pulses[i], MIN(pulses_count - i, batch));
+            }
+        }
+    }
+    *time = furi_get_tick() - start;
+
+    subghz_receiver_free(receiver);
+    return decoded;
+}
+
+MU_TEST(subghz_receiver_batch_reset_test) {
+    LevelDuration* pulses = malloc(sizeof(LevelDuration) * TEST_BENCHMARK_PULSES_MAX);
+    size_t pulses_count =
+        subghz_benchmark_load(TEST_RANDOM_DIR_NAME, pulses, TEST_BENCHMARK_PULSES_MAX);
+    mu_assert(pulses_count > 0, "Benchmark data load error\r\n");
+
+    uint32_t single_time = 0;
+    uint32_t batch_time = 0;
+    uint32_t single_decoded = subghz_receiver_reset_run(pulses, pulses_count, 1, &single_time);
+    uint32_t batch_decoded =
+        subghz_receiver_reset_run(pulses, pulses_count, TEST_BENCHMARK_BATCH, &batch_time);
+    free(pulses);
+
+    uint32_t pulses_total = pulses_count * TEST_BENCHMARK_ROUNDS;
+    printf(
+        "SubGhz receiver reset on decode: %lu pulses, %lu decoded, "
+        "dispatch %lu pulses/s, batch %lu pulses/s\r\n",
+        pulses_total,
+        single_decoded,
+        pulses_total * 1000 / MAX(single_time, 1UL),
+        pulses_total * 1000 / MAX(batch_time, 1UL));
+
+    mu_assert(single_decoded > 0, "Nothing decoded\r\n");
+    mu_assert_int_eq(single_decoded, batch_decoded);
+}
+
 MU_TEST(subghz_keystore_test) {
     mu_assert(
         subghz_environment_load_keystore(environment_handler, KEYSTORE_DIR_NAME),
@@ -839,6 +1049,65 @@ MU_TEST(subghz_random_test) {
     mu_assert(subghz_decode_random_test(TEST_RANDOM_DIR_NAME), "Random test error\r\n");
 }
 
+MU_TEST(subghz_raw_file_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    mu_assert(
+        subghz_raw_file_convert(storage, TEST_RANDOM_DIR_NAME, TEST_RAW_BINARY_NAME, true),
+        "Convert to binary error\r\n");
+
+    FileInfo text_info;
+    FileInfo binary_info;
+    mu_assert(
+        storage_common_stat(storage, TEST_RANDOM_DIR_NAME, &text_info) == FSE_OK &&
+            storage_common_stat(storage, TEST_RAW_BINARY_NAME, &binary_info) == FSE_OK,
+        "Stat error\r\n");
+    FURI_LOG_I(TAG, "RAW text %llu, binary %llu bytes", text_info.size, binary_info.size);
+    mu_assert(binary_info.size * 3 < text_info.size, "Binary file is too large\r\n");
+
+    // Seek must land on the same samples as sequential read
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    FuriString* protocol = furi_string_alloc();
+    int32_t* samples = malloc(TEST_RAW_SEEK_SAMPLES * sizeof(int32_t));
+    mu_assert(
+        flipper_format_file_open_existing(flipper_format, TEST_RAW_BINARY_NAME) &&
+            flipper_format_read_string(flipper_format, "Protocol", protocol),
+        "Binary file header error\r\n");
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    stream_seek(stream, 1, StreamOffsetFromCurrent);
+
+    SubGhzRawFileReader* reader = subghz_raw_file_reader_alloc(stream);
+    mu_assert_int_eq(
+        TEST_RAW_SEEK_SAMPLES,
+        subghz_raw_file_reader_read(reader, samples, TEST_RAW_SEEK_SAMPLES));
+    const uint32_t seek_samples[] = {TEST_RAW_SEEK_SAMPLES - 1, 0, 700, 1};
+    for(size_t i = 0; i < COUNT_OF(seek_samples); i++) {
+        int32_t sample = 0;
+        mu_assert(subghz_raw_file_reader_seek(reader, seek_samples[i]), "Seek error\r\n");
+        mu_assert_int_eq(1, subghz_raw_file_reader_read(reader, &sample, 1));
+        mu_assert_int_eq(samples[seek_samples[i]], sample);
+    }
+    mu_assert(!subghz_raw_file_reader_seek(reader, UINT32_MAX), "Seek past the end\r\n");
+    subghz_raw_file_reader_free(reader);
+
+    free(samples);
+    furi_string_free(protocol);
+    flipper_format_free(flipper_format);
+
+    mu_assert(
+        subghz_raw_file_convert(storage, TEST_RAW_BINARY_NAME, TEST_RAW_TEXT_NAME, false),
+        "Convert to text error\r\n");
+    furi_record_close(RECORD_STORAGE);
+
+    mu_assert(subghz_decode_random_test(TEST_RAW_BINARY_NAME), "Binary random test error\r\n");
+    mu_assert(subghz_decode_random_test(TEST_RAW_TEXT_NAME), "Text random test error\r\n");
+
+    storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, TEST_RAW_BINARY_NAME);
+    storage_simply_remove(storage, TEST_RAW_TEXT_NAME);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
@@ -917,6 +1186,9 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dickert_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_raw_file_test);
+    MU_RUN_TEST(subghz_receiver_benchmark_test);
+    MU_RUN_TEST(subghz_receiver_batch_reset_test);
     subghz_test_deinit();
 }
 
@@ -6,8 +6,10 @@
 #include <task.h>
 
 #include <rpc/rpc_i.h>
+#include <gui/canvas_i.h>
 #include <flipper.pb.h>
 #include <core/event_loop.h>
+#include <core/log_i.h>
 
 static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(resource_manifest_reader_alloc, ResourceManifestReader*, (Storage*)),
@@ -42,4 +44,33 @@ static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(furi_event_loop_unsubscribe, void, (FuriEventLoop*, FuriEventLoopObject*)),
     API_METHOD(furi_event_loop_run, void, (FuriEventLoop*)),
     API_METHOD(furi_event_loop_stop, void, (FuriEventLoop*)),
+    API_METHOD(furi_log_pack, bool, (uint8_t*, size_t, size_t*, const char*, va_list)),
+    API_METHOD(furi_log_unpack, void, (FuriString*, const char*, const uint8_t*, size_t)),
+    API_METHOD(
+        canvas_draw_u8g2_bitmap,
+        void,
+        (u8g2_t*, int32_t, int32_t, size_t, size_t, const uint8_t*, IconRotation)),
+    API_METHOD(
+        u8g2_SetupBuffer,
+        void,
+        (u8g2_t*, uint8_t*, uint8_t, u8g2_draw_ll_hvline_cb, const u8g2_cb_t*)),
+    API_METHOD(u8g2_SetDisplayRotation, void, (u8g2_t*, const u8g2_cb_t*)),
+    API_METHOD(u8g2_SetMaxClipWindow, void, (u8g2_t*)),
+    API_METHOD(
+        u8g2_SetClipWindow,
+        void,
+        (u8g2_t*, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t)),
+    API_METHOD(u8g2_DrawHVLine, void, (u8g2_t*, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t, uint8_t)),
+    API_METHOD(
+        u8g2_ll_hvline_vertical_top_lsb,
+        void,
+        (u8g2_t*, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t, uint8_t)),
+    API_METHOD(
+        u8g2_IsIntersection,
+        uint8_t,
+        (u8g2_t*, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t, u8g2_uint_t)),
+    API_VARIABLE(u8g2_cb_r0, const u8g2_cb_t),
+    API_VARIABLE(u8g2_cb_r1, const u8g2_cb_t),
+    API_VARIABLE(u8g2_cb_r2, const u8g2_cb_t),
+    API_VARIABLE(u8g2_cb_r3, const u8g2_cb_t),
     API_VARIABLE(PB_Main_msg, PB_Main_msg_t)));
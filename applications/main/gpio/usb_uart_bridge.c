@@ -36,6 +36,7 @@ typedef enum {
     WorkerEvtLineCfgSet = (1 << 6),
     WorkerEvtCtrlLineSet = (1 << 7),
 
+    WorkerEvtTxSpace = (1 << 8),
 } WorkerEvtFlags;
 
 #define WORKER_ALL_RX_EVENTS                                                      \
@@ -103,6 +104,12 @@ static void usb_uart_on_irq_rx_dma_cb(
     }
 }
 
+static void usb_uart_on_tx_dma_cb(FuriHalSerialHandle* handle, void* context) {
+    UNUSED(handle);
+    UsbUartBridge* usb_uart = (UsbUartBridge*)context;
+    furi_thread_flags_set(furi_thread_get_id(usb_uart->tx_thread), WorkerEvtTxSpace);
+}
+
 static void usb_uart_vcp_init(UsbUartBridge* usb_uart, uint8_t vcp_ch) {
     furi_hal_usb_unlock();
     if(vcp_ch == 0) {
@@ -138,6 +145,7 @@ static void usb_uart_serial_init(UsbUartBridge* usb_uart, uint8_t uart_ch) {
     furi_hal_serial_init(usb_uart->serial_handle, 115200);
     furi_hal_serial_dma_rx_start(
         usb_uart->serial_handle, usb_uart_on_irq_rx_dma_cb, usb_uart, false);
+    furi_hal_serial_dma_tx_start(usb_uart->serial_handle, usb_uart_on_tx_dma_cb, usb_uart);
 }
 
 static void usb_uart_serial_deinit(UsbUartBridge* usb_uart) {
@@ -288,6 +296,10 @@ static int32_t usb_uart_worker(void* context) {
             usb_uart_update_ctrl_lines(usb_uart);
         }
     }
+    // Stop sending before the serial goes away
+    furi_thread_flags_set(furi_thread_get_id(usb_uart->tx_thread), WorkerEvtTxStop);
+    furi_thread_join(usb_uart->tx_thread);
+
     usb_uart_vcp_deinit(usb_uart, usb_uart->cfg.vcp_ch);
     usb_uart_serial_deinit(usb_uart);
 
@@ -298,8 +310,6 @@ static int32_t usb_uart_worker(void* context) {
         furi_hal_gpio_init_simple(flow_pins[usb_uart->cfg.flow_pins - 1][1], GpioModeAnalog);
     }
 
-    furi_thread_flags_set(furi_thread_get_id(usb_uart->tx_thread), WorkerEvtTxStop);
-    furi_thread_join(usb_uart->tx_thread);
     furi_thread_free(usb_uart->tx_thread);
 
     furi_stream_buffer_free(usb_uart->rx_stream);
@@ -335,7 +345,17 @@ static int32_t usb_uart_tx_thread(void* context) {
                 if(usb_uart->cfg.software_de_re != 0)
                     furi_hal_gpio_write(USB_USART_DE_RE_PIN, false);
 
-                furi_hal_serial_tx(usb_uart->serial_handle, data, len);
+                // Next packet is received from USB while this one goes out over DMA
+                const uint8_t* tx_data = data;
+                while(len > 0) {
+                    const size_t sent =
+                        furi_hal_serial_tx_async(usb_uart->serial_handle, tx_data, len);
+                    tx_data += sent;
+                    len -= sent;
+                    if(len > 0) {
+                        furi_thread_flags_wait(WorkerEvtTxSpace, FuriFlagWaitAny, FuriWaitForever);
+                    }
+                }
 
                 if(usb_uart->cfg.software_de_re != 0) {
                     furi_hal_serial_tx_wait_complete(usb_uart->serial_handle);
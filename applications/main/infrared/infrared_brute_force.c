@@ -5,6 +5,7 @@
 #include <flipper_format/flipper_format.h>
 
 #include "infrared_signal.h"
+#include "infrared_brute_force_cache.h"
 
 typedef struct {
     uint32_t index;
@@ -20,6 +21,7 @@ DICT_DEF2(
 
 struct InfraredBruteForce {
     FlipperFormat* ff;
+    InfraredBruteForceCache* cache;
     const char* db_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
@@ -30,6 +32,7 @@ struct InfraredBruteForce {
 InfraredBruteForce* infrared_brute_force_alloc(void) {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
     brute_force->ff = NULL;
+    brute_force->cache = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
     brute_force->is_started = false;
@@ -38,8 +41,17 @@ InfraredBruteForce* infrared_brute_force_alloc(void) {
     return brute_force;
 }
 
+static void infrared_brute_force_cache_release(InfraredBruteForce* brute_force) {
+    if(brute_force->cache) {
+        infrared_brute_force_cache_free(brute_force->cache);
+        brute_force->cache = NULL;
+        furi_record_close(RECORD_STORAGE);
+    }
+}
+
 void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
+    infrared_brute_force_cache_release(brute_force);
     InfraredBruteForceRecordDict_clear(brute_force->records);
     furi_string_free(brute_force->current_record_name);
     free(brute_force);
@@ -47,6 +59,7 @@ void infrared_brute_force_free(InfraredBruteForce* brute_force) {
 
 void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const char* db_filename) {
     furi_assert(!brute_force->is_started);
+    infrared_brute_force_cache_release(brute_force);
     brute_force->db_filename = db_filename;
 }
 
@@ -55,6 +68,27 @@ InfraredErrorCode infrared_brute_force_calculate_messages(InfraredBruteForce* br
     furi_assert(brute_force->db_filename);
     InfraredErrorCode error = InfraredErrorCodeNone;
 
+    // Parsed signals from the binary cache, no text parsing at all
+    infrared_brute_force_cache_release(brute_force);
+    brute_force->cache = infrared_brute_force_cache_alloc(furi_record_open(RECORD_STORAGE));
+    error = infrared_brute_force_cache_open(brute_force->cache, brute_force->db_filename);
+
+    if(!INFRARED_ERROR_PRESENT(error)) {
+        InfraredBruteForceRecordDict_it_t it;
+        for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+            !InfraredBruteForceRecordDict_end_p(it);
+            InfraredBruteForceRecordDict_next(it)) {
+            InfraredBruteForceRecordDict_itref_t* record = InfraredBruteForceRecordDict_ref(it);
+            record->value.count = infrared_brute_force_cache_get_count(
+                brute_force->cache, furi_string_get_cstr(record->key));
+        }
+        return error;
+    }
+
+    // No cache on read-only storage, fall back to the text database
+    infrared_brute_force_cache_release(brute_force);
+    error = InfraredErrorCodeNone;
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
     FuriString* signal_name = furi_string_alloc();
@@ -111,7 +145,14 @@ bool infrared_brute_force_start(
         }
     }
 
-    if(*record_count) {
+    if(*record_count && brute_force->cache) {
+        furi_record_open(RECORD_STORAGE);
+        brute_force->current_signal = infrared_signal_alloc();
+        brute_force->is_started = true;
+        success = infrared_brute_force_cache_select(
+            brute_force->cache, furi_string_get_cstr(brute_force->current_record_name));
+        if(!success) infrared_brute_force_stop(brute_force);
+    } else if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
         brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
@@ -131,7 +172,7 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->ff) flipper_format_free(brute_force->ff);
     brute_force->current_signal = NULL;
     brute_force->ff = NULL;
     brute_force->is_started = false;
@@ -141,11 +182,17 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
 
-    const bool success = infrared_signal_search_by_name_and_read(
-                             brute_force->current_signal,
-                             brute_force->ff,
-                             furi_string_get_cstr(brute_force->current_record_name)) ==
-                         InfraredErrorCodeNone;
+    bool success;
+    if(brute_force->cache) {
+        success = infrared_brute_force_cache_read_next(
+            brute_force->cache, brute_force->current_signal);
+    } else {
+        success = infrared_signal_search_by_name_and_read(
+                      brute_force->current_signal,
+                      brute_force->ff,
+                      furi_string_get_cstr(brute_force->current_record_name)) ==
+                  InfraredErrorCodeNone;
+    }
     if(success) {
         infrared_signal_transmit(brute_force->current_signal);
     }
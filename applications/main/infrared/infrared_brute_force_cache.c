@@ -0,0 +1,489 @@
+#include "infrared_brute_force_cache.h"
+
+#include <stdlib.h>
+#include <m-array.h>
+#include <m-dict.h>
+#include <core/check.h>
+#include <infrared_worker.h>
+#include <toolbox/crc32_calc.h>
+
+#define TAG "InfraredBruteForceCache"
+
+#define INFRARED_BRUTE_FORCE_CACHE_MAGIC   (0x43425249UL) // "IRBC"
+#define INFRARED_BRUTE_FORCE_CACHE_VERSION (1U)
+
+/*
+ * Cache file layout, integers are little endian:
+ * - InfraredBruteForceCacheHeader
+ * - Signals in the database order, each one is InfraredBruteForceCacheSignal
+ *   followed by timings_size uint32_t timings for raw signals
+ * - Name table at names_offset: names_count InfraredBruteForceCacheName,
+ *   each one followed by name_size name characters
+ * - Offsets of the signals with a given name, count uint32_t at offsets_offset
+ *
+ * The cache is valid while size and timestamp of the database match the
+ * header. If only the timestamp differs, the database CRC is checked instead.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t source_size;
+    uint32_t source_timestamp;
+    uint32_t source_crc;
+    uint32_t names_offset;
+    uint32_t names_count;
+} FURI_PACKED InfraredBruteForceCacheHeader;
+
+typedef struct {
+    uint8_t is_raw;
+    union {
+        struct {
+            int32_t protocol;
+            uint32_t address;
+            uint32_t command;
+        } message;
+        struct {
+            uint32_t frequency;
+            float duty_cycle;
+            uint32_t timings_size;
+        } raw;
+    };
+} FURI_PACKED InfraredBruteForceCacheSignal;
+
+typedef struct {
+    uint32_t count;
+    uint32_t offsets_offset;
+    uint8_t name_size;
+} FURI_PACKED InfraredBruteForceCacheName;
+
+ARRAY_DEF(InfraredBruteForceCacheOffsetArray, uint32_t, M_POD_OPLIST); // NOLINT
+
+DICT_DEF2(
+    InfraredBruteForceCacheOffsetDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    InfraredBruteForceCacheOffsetArray_t,
+    ARRAY_OPLIST(InfraredBruteForceCacheOffsetArray, M_POD_OPLIST));
+
+DICT_DEF2(
+    InfraredBruteForceCacheNameDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    InfraredBruteForceCacheName,
+    M_POD_OPLIST);
+
+struct InfraredBruteForceCache {
+    Storage* storage;
+    File* file;
+    InfraredBruteForceCacheNameDict_t names;
+
+    uint32_t* offsets;
+    uint32_t offsets_count;
+    uint32_t offsets_position;
+    uint32_t* timings;
+};
+
+static bool infrared_brute_force_cache_source_stat(
+    Storage* storage,
+    const char* path,
+    uint32_t* source_size,
+    uint32_t* source_timestamp) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, path, source_timestamp) != FSE_OK) return false;
+    *source_size = file_info.size;
+    return true;
+}
+
+static bool
+    infrared_brute_force_cache_source_crc(Storage* storage, const char* path, uint32_t* crc) {
+    File* file = storage_file_alloc(storage);
+    bool success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(success) {
+        *crc = crc32_calc_file(file, NULL, NULL);
+    }
+    storage_file_close(file);
+    storage_file_free(file);
+    return success;
+}
+
+static void infrared_brute_force_cache_close(InfraredBruteForceCache* cache) {
+    if(cache->file) {
+        storage_file_close(cache->file);
+        storage_file_free(cache->file);
+        cache->file = NULL;
+    }
+    InfraredBruteForceCacheNameDict_reset(cache->names);
+
+    free(cache->offsets);
+    cache->offsets = NULL;
+    cache->offsets_count = 0;
+    cache->offsets_position = 0;
+}
+
+static bool infrared_brute_force_cache_write_signal(File* file, const InfraredSignal* signal) {
+    InfraredBruteForceCacheSignal record = {.is_raw = infrared_signal_is_raw(signal)};
+    const uint32_t* timings = NULL;
+
+    if(record.is_raw) {
+        const InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
+        record.raw.frequency = raw->frequency;
+        record.raw.duty_cycle = raw->duty_cycle;
+        record.raw.timings_size = raw->timings_size;
+        timings = raw->timings;
+    } else {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        record.message.protocol = message->protocol;
+        record.message.address = message->address;
+        record.message.command = message->command;
+    }
+
+    if(storage_file_write(file, &record, sizeof(record)) != sizeof(record)) return false;
+    if(timings) {
+        const size_t timings_bytes = sizeof(uint32_t) * record.raw.timings_size;
+        if(storage_file_write(file, timings, timings_bytes) != timings_bytes) return false;
+    }
+
+    return true;
+}
+
+static bool infrared_brute_force_cache_write_names(
+    File* file,
+    InfraredBruteForceCacheOffsetDict_t offsets,
+    InfraredBruteForceCacheHeader* header) {
+    header->names_offset = storage_file_tell(file);
+    header->names_count = InfraredBruteForceCacheOffsetDict_size(offsets);
+
+    // Offsets follow the name table
+    uint32_t offsets_offset = header->names_offset;
+    InfraredBruteForceCacheOffsetDict_it_t it;
+    for(InfraredBruteForceCacheOffsetDict_it(it, offsets);
+        !InfraredBruteForceCacheOffsetDict_end_p(it);
+        InfraredBruteForceCacheOffsetDict_next(it)) {
+        const InfraredBruteForceCacheOffsetDict_itref_t* item =
+            InfraredBruteForceCacheOffsetDict_cref(it);
+        offsets_offset += sizeof(InfraredBruteForceCacheName) + furi_string_size(item->key);
+    }
+
+    for(InfraredBruteForceCacheOffsetDict_it(it, offsets);
+        !InfraredBruteForceCacheOffsetDict_end_p(it);
+        InfraredBruteForceCacheOffsetDict_next(it)) {
+        const InfraredBruteForceCacheOffsetDict_itref_t* item =
+            InfraredBruteForceCacheOffsetDict_cref(it);
+        if(furi_string_size(item->key) > UINT8_MAX) return false;
+
+        InfraredBruteForceCacheName name = {
+            .count = InfraredBruteForceCacheOffsetArray_size(item->value),
+            .offsets_offset = offsets_offset,
+            .name_size = furi_string_size(item->key),
+        };
+        if(storage_file_write(file, &name, sizeof(name)) != sizeof(name)) return false;
+        if(storage_file_write(file, furi_string_get_cstr(item->key), name.name_size) !=
+           name.name_size)
+            return false;
+
+        offsets_offset += sizeof(uint32_t) * name.count;
+    }
+
+    for(InfraredBruteForceCacheOffsetDict_it(it, offsets);
+        !InfraredBruteForceCacheOffsetDict_end_p(it);
+        InfraredBruteForceCacheOffsetDict_next(it)) {
+        const InfraredBruteForceCacheOffsetDict_itref_t* item =
+            InfraredBruteForceCacheOffsetDict_cref(it);
+        // Array storage is contiguous and never empty here
+        const size_t offsets_bytes =
+            sizeof(uint32_t) * InfraredBruteForceCacheOffsetArray_size(item->value);
+        if(storage_file_write(
+               file, InfraredBruteForceCacheOffsetArray_cget(item->value, 0), offsets_bytes) !=
+           offsets_bytes)
+            return false;
+    }
+
+    return true;
+}
+
+static InfraredErrorCode infrared_brute_force_cache_build(
+    InfraredBruteForceCache* cache,
+    const char* db_filename,
+    const char* cache_filename) {
+    InfraredErrorCode error = InfraredErrorCodeNone;
+
+    InfraredBruteForceCacheHeader header = {
+        .magic = INFRARED_BRUTE_FORCE_CACHE_MAGIC,
+        .version = INFRARED_BRUTE_FORCE_CACHE_VERSION,
+    };
+
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(cache->storage);
+    File* file = storage_file_alloc(cache->storage);
+    FuriString* signal_name = furi_string_alloc();
+    InfraredSignal* signal = infrared_signal_alloc();
+    InfraredBruteForceCacheOffsetDict_t offsets;
+    InfraredBruteForceCacheOffsetDict_init(offsets);
+
+    bool cache_saved = false;
+    do {
+        if(!infrared_brute_force_cache_source_stat(
+               cache->storage, db_filename, &header.source_size, &header.source_timestamp) ||
+           !infrared_brute_force_cache_source_crc(
+               cache->storage, db_filename, &header.source_crc)) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
+
+        if(!flipper_format_buffered_file_open_existing(ff, db_filename)) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
+
+        if(!storage_file_open(file, cache_filename, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
+
+        // Written again once the name table is known
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
+
+        bool signals_valid = true;
+        while(infrared_signal_read_name(ff, signal_name) == InfraredErrorCodeNone) {
+            error = infrared_signal_read_body(signal, ff);
+            signals_valid = (!INFRARED_ERROR_PRESENT(error)) && infrared_signal_is_valid(signal);
+            if(!signals_valid) break;
+
+            InfraredBruteForceCacheOffsetArray_t* signal_offsets =
+                InfraredBruteForceCacheOffsetDict_safe_get(offsets, signal_name);
+            InfraredBruteForceCacheOffsetArray_push_back(
+                *signal_offsets, storage_file_tell(file));
+
+            if(!infrared_brute_force_cache_write_signal(file, signal)) {
+                error = InfraredErrorCodeFileOperationFailed;
+                signals_valid = false;
+                break;
+            }
+        }
+        if(!signals_valid) break;
+        error = InfraredErrorCodeNone;
+
+        if(!infrared_brute_force_cache_write_names(file, offsets, &header) ||
+           !storage_file_seek(file, 0, true) ||
+           storage_file_write(file, &header, sizeof(header)) != sizeof(header)) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
+
+        cache_saved = true;
+    } while(false);
+
+    storage_file_close(file);
+    if(!cache_saved) {
+        FURI_LOG_W(TAG, "Failed to build cache: %lX", error);
+        storage_simply_remove(cache->storage, cache_filename);
+    } else {
+        FURI_LOG_I(TAG, "Cache built: %lu names", header.names_count);
+    }
+
+    InfraredBruteForceCacheOffsetDict_clear(offsets);
+    infrared_signal_free(signal);
+    furi_string_free(signal_name);
+    storage_file_free(file);
+    flipper_format_free(ff);
+
+    return error;
+}
+
+static bool infrared_brute_force_cache_load(
+    InfraredBruteForceCache* cache,
+    const char* db_filename,
+    const char* cache_filename) {
+    uint32_t source_size = 0;
+    uint32_t source_timestamp = 0;
+    if(!infrared_brute_force_cache_source_stat(
+           cache->storage, db_filename, &source_size, &source_timestamp)) {
+        return false;
+    }
+
+    cache->file = storage_file_alloc(cache->storage);
+    FuriString* name_str = furi_string_alloc();
+
+    bool cache_loaded = false;
+    do {
+        if(!storage_file_open(cache->file, cache_filename, FSAM_READ_WRITE, FSOM_OPEN_EXISTING))
+            break;
+
+        InfraredBruteForceCacheHeader header;
+        if(storage_file_read(cache->file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != INFRARED_BRUTE_FORCE_CACHE_MAGIC ||
+           header.version != INFRARED_BRUTE_FORCE_CACHE_VERSION ||
+           header.source_size != source_size) {
+            FURI_LOG_D(TAG, "Cache is outdated");
+            break;
+        }
+
+        if(header.source_timestamp != source_timestamp) {
+            // Copied over with the same contents
+            uint32_t source_crc = 0;
+            if(!infrared_brute_force_cache_source_crc(cache->storage, db_filename, &source_crc) ||
+               source_crc != header.source_crc) {
+                FURI_LOG_D(TAG, "Cache is outdated");
+                break;
+            }
+
+            header.source_timestamp = source_timestamp;
+            if(!storage_file_seek(cache->file, 0, true)) break;
+            if(storage_file_write(cache->file, &header, sizeof(header)) != sizeof(header)) break;
+        }
+
+        if(!storage_file_seek(cache->file, header.names_offset, true)) break;
+
+        bool names_loaded = true;
+        for(uint32_t i = 0; names_loaded && i < header.names_count; i++) {
+            InfraredBruteForceCacheName name;
+            char name_buffer[UINT8_MAX + 1];
+            names_loaded =
+                storage_file_read(cache->file, &name, sizeof(name)) == sizeof(name) &&
+                storage_file_read(cache->file, name_buffer, name.name_size) == name.name_size;
+            if(names_loaded) {
+                name_buffer[name.name_size] = '\0';
+                furi_string_set_str(name_str, name_buffer);
+                InfraredBruteForceCacheNameDict_set_at(cache->names, name_str, name);
+            }
+        }
+        if(!names_loaded) break;
+
+        cache_loaded = true;
+    } while(false);
+
+    furi_string_free(name_str);
+
+    if(!cache_loaded) infrared_brute_force_cache_close(cache);
+
+    return cache_loaded;
+}
+
+InfraredBruteForceCache* infrared_brute_force_cache_alloc(Storage* storage) {
+    InfraredBruteForceCache* cache = malloc(sizeof(InfraredBruteForceCache));
+    cache->storage = storage;
+    InfraredBruteForceCacheNameDict_init(cache->names);
+    return cache;
+}
+
+void infrared_brute_force_cache_free(InfraredBruteForceCache* cache) {
+    furi_assert(cache);
+    infrared_brute_force_cache_close(cache);
+    InfraredBruteForceCacheNameDict_clear(cache->names);
+    free(cache->timings);
+    free(cache);
+}
+
+InfraredErrorCode
+    infrared_brute_force_cache_open(InfraredBruteForceCache* cache, const char* db_filename) {
+    furi_assert(cache);
+    furi_assert(db_filename);
+
+    infrared_brute_force_cache_close(cache);
+
+    InfraredErrorCode error = InfraredErrorCodeNone;
+    FuriString* cache_filename =
+        furi_string_alloc_printf("%s%s", db_filename, INFRARED_BRUTE_FORCE_CACHE_EXTENSION);
+
+    const char* cache_path = furi_string_get_cstr(cache_filename);
+
+    do {
+        if(infrared_brute_force_cache_load(cache, db_filename, cache_path)) break;
+
+        error = infrared_brute_force_cache_build(cache, db_filename, cache_path);
+        if(INFRARED_ERROR_PRESENT(error)) break;
+
+        if(!infrared_brute_force_cache_load(cache, db_filename, cache_path)) {
+            error = InfraredErrorCodeFileOperationFailed;
+        }
+    } while(false);
+
+    furi_string_free(cache_filename);
+    return error;
+}
+
+uint32_t infrared_brute_force_cache_get_count(InfraredBruteForceCache* cache, const char* name) {
+    furi_assert(cache);
+    furi_assert(name);
+
+    FuriString* key = furi_string_alloc_set_str(name);
+    const InfraredBruteForceCacheName* entry =
+        InfraredBruteForceCacheNameDict_cget(cache->names, key);
+    furi_string_free(key);
+
+    return entry ? entry->count : 0;
+}
+
+bool infrared_brute_force_cache_select(InfraredBruteForceCache* cache, const char* name) {
+    furi_assert(cache);
+    furi_assert(name);
+
+    free(cache->offsets);
+    cache->offsets = NULL;
+    cache->offsets_count = 0;
+    cache->offsets_position = 0;
+
+    if(!cache->file) return false;
+
+    FuriString* key = furi_string_alloc_set_str(name);
+    const InfraredBruteForceCacheName* entry =
+        InfraredBruteForceCacheNameDict_cget(cache->names, key);
+    furi_string_free(key);
+
+    if(!entry || !entry->count) return false;
+
+    bool success = false;
+    const size_t offsets_bytes = sizeof(uint32_t) * entry->count;
+    cache->offsets = malloc(offsets_bytes);
+    if(storage_file_seek(cache->file, entry->offsets_offset, true) &&
+       storage_file_read(cache->file, cache->offsets, offsets_bytes) == offsets_bytes) {
+        cache->offsets_count = entry->count;
+        success = true;
+    }
+
+    if(!cache->timings) {
+        cache->timings = malloc(sizeof(uint32_t) * MAX_TIMINGS_AMOUNT);
+    }
+
+    return success;
+}
+
+bool infrared_brute_force_cache_read_next(InfraredBruteForceCache* cache, InfraredSignal* signal) {
+    furi_assert(cache);
+    furi_assert(signal);
+
+    if(cache->offsets_position >= cache->offsets_count) return false;
+
+    const uint32_t offset = cache->offsets[cache->offsets_position++];
+    InfraredBruteForceCacheSignal record;
+    if(!storage_file_seek(cache->file, offset, true)) return false;
+    if(storage_file_read(cache->file, &record, sizeof(record)) != sizeof(record)) return false;
+
+    if(record.is_raw) {
+        if(record.raw.timings_size > MAX_TIMINGS_AMOUNT) return false;
+        const size_t timings_bytes = sizeof(uint32_t) * record.raw.timings_size;
+        if(storage_file_read(cache->file, cache->timings, timings_bytes) != timings_bytes) {
+            return false;
+        }
+        infrared_signal_set_raw_signal(
+            signal,
+            cache->timings,
+            record.raw.timings_size,
+            record.raw.frequency,
+            record.raw.duty_cycle);
+    } else {
+        const InfraredMessage message = {
+            .protocol = record.message.protocol,
+            .address = record.message.address,
+            .command = record.message.command,
+            .repeat = false,
+        };
+        infrared_signal_set_message(signal, &message);
+    }
+
+    return true;
+}
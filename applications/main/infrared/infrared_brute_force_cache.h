@@ -0,0 +1,73 @@
+/**
+ * @file infrared_brute_force_cache.h
+ * @brief Binary cache of signal databases used for brute-forcing.
+ *
+ * Universal remote databases are large text files. The cache keeps their
+ * signals already parsed, grouped by name, next to the database file, so
+ * opening a database and sending signals does not involve text parsing.
+ * The cache is built on first use and rebuilt when the database changes.
+ */
+#pragma once
+
+#include <storage/storage.h>
+
+#include "infrared_signal.h"
+
+#define INFRARED_BRUTE_FORCE_CACHE_EXTENSION ".bin"
+
+/**
+ * @brief InfraredBruteForceCache opaque type declaration.
+ */
+typedef struct InfraredBruteForceCache InfraredBruteForceCache;
+
+/**
+ * @brief Create a new InfraredBruteForceCache instance.
+ *
+ * @param[in] storage pointer to the storage instance to be used.
+ * @returns pointer to the created instance.
+ */
+InfraredBruteForceCache* infrared_brute_force_cache_alloc(Storage* storage);
+
+/**
+ * @brief Delete an InfraredBruteForceCache instance.
+ *
+ * @param[in,out] cache pointer to the instance to be deleted.
+ */
+void infrared_brute_force_cache_free(InfraredBruteForceCache* cache);
+
+/**
+ * @brief Open the cache of a database file, building it if it is missing or outdated.
+ *
+ * @param[in,out] cache pointer to the instance to be used.
+ * @param[in] db_filename pointer to a zero-terminated string containing a full path to the database file.
+ * @returns InfraredErrorCodeNone on success, otherwise error code.
+ */
+InfraredErrorCode
+    infrared_brute_force_cache_open(InfraredBruteForceCache* cache, const char* db_filename);
+
+/**
+ * @brief Get the number of signals with a given name.
+ *
+ * @param[in] cache pointer to an opened instance.
+ * @param[in] name pointer to a zero-terminated string containing the signal name.
+ * @returns number of signals, 0 if there are none.
+ */
+uint32_t infrared_brute_force_cache_get_count(InfraredBruteForceCache* cache, const char* name);
+
+/**
+ * @brief Select signals with a given name for reading.
+ *
+ * @param[in,out] cache pointer to an opened instance.
+ * @param[in] name pointer to a zero-terminated string containing the signal name.
+ * @returns true on success, false otherwise.
+ */
+bool infrared_brute_force_cache_select(InfraredBruteForceCache* cache, const char* name);
+
+/**
+ * @brief Read the next selected signal.
+ *
+ * @param[in,out] cache pointer to an opened instance.
+ * @param[out] signal pointer to the instance to be filled.
+ * @returns true if the next signal existed and could be read, false otherwise.
+ */
+bool infrared_brute_force_cache_read_next(InfraredBruteForceCache* cache, InfraredSignal* signal);
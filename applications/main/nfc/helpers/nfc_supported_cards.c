@@ -8,7 +8,10 @@
 #include <flipper_application/plugins/composite_resolver.h>
 #include <loader/firmware_api/firmware_api.h>
 
+#include <nfc/protocols/iso14443_3a/iso14443_3a.h>
+
 #include <furi.h>
+#include <furi_hal.h>
 #include <path.h>
 #include <m-array.h>
 
@@ -17,6 +20,11 @@
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH  APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_INDEX_FOLDER  EXT_PATH("nfc/.cache")
+#define NFC_SUPPORTED_CARDS_INDEX_PATH    NFC_SUPPORTED_CARDS_INDEX_FOLDER "/supported_cards.idx"
+#define NFC_SUPPORTED_CARDS_INDEX_MAGIC   (0x4943534EUL) // "NSCI"
+#define NFC_SUPPORTED_CARDS_INDEX_VERSION (2U)
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
@@ -25,10 +33,31 @@ typedef enum {
 
 typedef struct {
     FuriString* name;
+    uint32_t file_size;
+    uint32_t file_timestamp;
     NfcProtocol protocol;
     NfcSupportedCardsPluginFeature feature;
+    NfcSupportedCardPluginFilter filter;
 } NfcSupportedCardsPluginCache;
 
+typedef struct FURI_PACKED {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t plugin_api_version;
+    uint32_t firmware_api_version;
+    uint32_t record_count;
+} NfcSupportedCardsIndexHeader;
+
+// Followed by name_len bytes of the plugin name without suffix
+typedef struct FURI_PACKED {
+    uint32_t file_size;
+    uint32_t file_timestamp;
+    uint32_t protocol;
+    uint8_t feature;
+    NfcSupportedCardPluginFilter filter;
+    uint8_t name_len;
+} NfcSupportedCardsIndexRecord;
+
 ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
 
 typedef enum {
@@ -64,17 +93,21 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
     return instance;
 }
 
-void nfc_supported_cards_free(NfcSupportedCards* instance) {
-    furi_assert(instance);
-
+static void nfc_supported_cards_plugins_cache_clear(NfcSupportedCardsPluginCache_t cache_arr) {
     NfcSupportedCardsPluginCache_it_t iter;
-    for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
+    for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
         !NfcSupportedCardsPluginCache_end_p(iter);
         NfcSupportedCardsPluginCache_next(iter)) {
         NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
         furi_string_free(plugin_cache->name);
     }
-    NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
+    NfcSupportedCardsPluginCache_clear(cache_arr);
+}
+
+void nfc_supported_cards_free(NfcSupportedCards* instance) {
+    furi_assert(instance);
+
+    nfc_supported_cards_plugins_cache_clear(instance->plugins_cache_arr);
 
     composite_api_resolver_free(instance->api_resolver);
     free(instance);
@@ -131,7 +164,9 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
         if(descriptor == NULL) break;
 
         if(strcmp(descriptor->appid, NFC_SUPPORTED_CARD_PLUGIN_APP_ID) != 0) break;
-        if(descriptor->ep_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
+        if((descriptor->ep_api_version < 1) ||
+           (descriptor->ep_api_version > NFC_SUPPORTED_CARD_PLUGIN_API_VERSION))
+            break;
 
         plugin = descriptor->entry_point;
     } while(false);
@@ -140,35 +175,232 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
     return plugin;
 }
 
-static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
+static bool nfc_supported_cards_get_next_file(
     NfcSupportedCardsLoadContext* instance,
-    const ElfApiInterface* api_interface) {
-    const NfcSupportedCardsPlugin* plugin = NULL;
+    FileInfo* file_info) {
+    if(!storage_file_is_open(instance->directory)) return false;
 
-    do {
-        if(!storage_file_is_open(instance->directory)) break;
-        if(!storage_dir_read(
-               instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
-            break;
+    const size_t suffix_len = strlen(NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
+
+    while(storage_dir_read(
+        instance->directory, file_info, instance->file_name, sizeof(instance->file_name))) {
+        if(file_info_is_dir(file_info)) continue;
 
-        const size_t suffix_len = strlen(NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
         const size_t file_name_len = strlen(instance->file_name);
-        if(file_name_len <= suffix_len) break;
+        if(file_name_len <= suffix_len) continue;
 
         size_t suffix_start_pos = file_name_len - suffix_len;
         if(memcmp(
                &instance->file_name[suffix_start_pos],
                NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX,
                suffix_len) != 0) //-V1051
-            break;
+            continue;
 
         // Trim suffix from file_name to save memory. The suffix will be concatenated on plugin load.
         instance->file_name[suffix_start_pos] = '\0';
+        return true;
+    }
 
-        plugin = nfc_supported_cards_get_plugin(instance, instance->file_name, api_interface);
-    } while(plugin == NULL); //-V654
+    return false;
+}
 
-    return plugin;
+// Plugins are linked against firmware API, an update may change which of them load
+static uint32_t nfc_supported_cards_index_get_firmware_api_version(void) {
+    uint16_t api_major, api_minor;
+    furi_hal_info_get_api_version(&api_major, &api_minor);
+    return ((uint32_t)api_major << 16) | api_minor;
+}
+
+static bool
+    nfc_supported_cards_index_load(Storage* storage, NfcSupportedCardsPluginCache_t index) {
+    File* file = storage_file_alloc(storage);
+    uint8_t* buffer = NULL;
+    bool success = false;
+
+    do {
+        if(!storage_file_open(
+               file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        const size_t size = storage_file_size(file);
+        if(size < sizeof(NfcSupportedCardsIndexHeader)) break;
+
+        buffer = malloc(size);
+        if(storage_file_read(file, buffer, size) != size) break;
+
+        NfcSupportedCardsIndexHeader header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.magic != NFC_SUPPORTED_CARDS_INDEX_MAGIC) break;
+        if(header.version != NFC_SUPPORTED_CARDS_INDEX_VERSION) break;
+        if(header.plugin_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
+        if(header.firmware_api_version != nfc_supported_cards_index_get_firmware_api_version())
+            break;
+
+        size_t offset = sizeof(header);
+        uint32_t i = 0;
+        for(; i < header.record_count; i++) {
+            NfcSupportedCardsIndexRecord record;
+            if(offset + sizeof(record) > size) break;
+            memcpy(&record, &buffer[offset], sizeof(record));
+            offset += sizeof(record);
+
+            if(offset + record.name_len > size) break;
+
+            NfcSupportedCardsPluginCache plugin_cache = {
+                .name = furi_string_alloc(),
+                .file_size = record.file_size,
+                .file_timestamp = record.file_timestamp,
+                .protocol = record.protocol,
+                .feature = record.feature,
+                .filter = record.filter,
+            };
+            furi_string_set_strn(
+                plugin_cache.name, (const char*)&buffer[offset], record.name_len);
+            offset += record.name_len;
+
+            NfcSupportedCardsPluginCache_push_back(index, plugin_cache);
+        }
+
+        success = (i == header.record_count);
+    } while(false);
+
+    if(!success) {
+        nfc_supported_cards_plugins_cache_clear(index);
+        NfcSupportedCardsPluginCache_init(index);
+    }
+
+    free(buffer);
+    storage_file_free(file);
+
+    return success;
+}
+
+static void
+    nfc_supported_cards_index_save(Storage* storage, NfcSupportedCardsPluginCache_t index) {
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    do {
+        if(!storage_simply_mkdir(storage, NFC_SUPPORTED_CARDS_INDEX_FOLDER)) break;
+        if(!storage_file_open(
+               file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        const NfcSupportedCardsIndexHeader header = {
+            .magic = NFC_SUPPORTED_CARDS_INDEX_MAGIC,
+            .version = NFC_SUPPORTED_CARDS_INDEX_VERSION,
+            .plugin_api_version = NFC_SUPPORTED_CARD_PLUGIN_API_VERSION,
+            .firmware_api_version = nfc_supported_cards_index_get_firmware_api_version(),
+            .record_count = NfcSupportedCardsPluginCache_size(index),
+        };
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        NfcSupportedCardsPluginCache_it_t iter;
+        for(NfcSupportedCardsPluginCache_it(iter, index);
+            !NfcSupportedCardsPluginCache_end_p(iter);
+            NfcSupportedCardsPluginCache_next(iter)) {
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
+            const NfcSupportedCardsIndexRecord record = {
+                .file_size = plugin_cache->file_size,
+                .file_timestamp = plugin_cache->file_timestamp,
+                .protocol = plugin_cache->protocol,
+                .feature = plugin_cache->feature,
+                .filter = plugin_cache->filter,
+                .name_len = furi_string_size(plugin_cache->name),
+            };
+            if(storage_file_write(file, &record, sizeof(record)) != sizeof(record)) break;
+            if(storage_file_write(
+                   file, furi_string_get_cstr(plugin_cache->name), record.name_len) !=
+               record.name_len)
+                break;
+        }
+
+        success = NfcSupportedCardsPluginCache_end_p(iter);
+    } while(false);
+
+    storage_file_free(file);
+
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save plugin index");
+        storage_simply_remove(storage, NFC_SUPPORTED_CARDS_INDEX_PATH);
+    }
+}
+
+static const NfcSupportedCardsPluginCache* nfc_supported_cards_index_find(
+    NfcSupportedCardsPluginCache_t index,
+    const char* name,
+    uint32_t file_size,
+    uint32_t file_timestamp) {
+    NfcSupportedCardsPluginCache_it_t iter;
+    for(NfcSupportedCardsPluginCache_it(iter, index);
+        !NfcSupportedCardsPluginCache_end_p(iter);
+        NfcSupportedCardsPluginCache_next(iter)) {
+        const NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_cref(iter);
+        if(plugin_cache->file_size == file_size &&
+           plugin_cache->file_timestamp == file_timestamp &&
+           furi_string_cmp_str(plugin_cache->name, name) == 0) {
+            return plugin_cache;
+        }
+    }
+    return NULL;
+}
+
+static bool nfc_supported_cards_describe_plugin(
+    NfcSupportedCards* instance,
+    NfcSupportedCardsPluginCache* plugin_cache) {
+    const ElfApiInterface* api_interface = composite_api_resolver_get(instance->api_resolver);
+    const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
+        instance->load_context, instance->load_context->file_name, api_interface);
+
+    if(plugin == NULL) return false;
+
+    plugin_cache->protocol = plugin->protocol;
+    if(plugin->verify) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasVerify;
+    }
+    if(plugin->read) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasRead;
+    }
+    if(plugin->parse) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasParse;
+    }
+
+    const FlipperAppPluginDescriptor* descriptor =
+        flipper_application_plugin_get_descriptor(instance->load_context->app);
+    if(descriptor->ep_api_version >= 2) {
+        plugin_cache->filter = plugin->filter;
+    }
+
+    return true;
+}
+
+static bool nfc_supported_cards_filter_match(
+    const NfcSupportedCardPluginFilter* filter,
+    const NfcDevice* device) {
+    if(filter->uid_len) {
+        size_t uid_len = 0;
+        nfc_device_get_uid(device, &uid_len);
+        if(uid_len != filter->uid_len) return false;
+    }
+
+    if(filter->sak_mask || filter->atqa_mask[0] || filter->atqa_mask[1]) {
+        const NfcProtocol protocol = nfc_device_get_protocol(device);
+        if((protocol != NfcProtocolIso14443_3a) &&
+           !nfc_protocol_has_parent(protocol, NfcProtocolIso14443_3a))
+            return false;
+
+        const Iso14443_3aData* data = nfc_device_get_data(device, NfcProtocolIso14443_3a);
+        if((iso14443_3a_get_sak(data) ^ filter->sak) & filter->sak_mask) return false;
+
+        uint8_t atqa[2];
+        iso14443_3a_get_atqa(data, atqa);
+        for(size_t i = 0; i < COUNT_OF(atqa); i++) {
+            if((atqa[i] ^ filter->atqa[i]) & filter->atqa_mask[i]) return false;
+        }
+    }
+
+    return true;
 }
 
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
@@ -180,32 +412,65 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
             break;
 
         instance->load_context = nfc_supported_cards_load_context_alloc();
+        Storage* storage = instance->load_context->storage;
 
-        while(true) {
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin =
-                nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
-            if(plugin == NULL) break; //-V547
+        NfcSupportedCardsPluginCache_t index;
+        NfcSupportedCardsPluginCache_init(index);
+        bool index_changed = !nfc_supported_cards_index_load(storage, index);
+
+        FuriString* plugin_path = furi_string_alloc();
+        FileInfo file_info;
+        size_t plugins_loaded = 0;
+
+        while(nfc_supported_cards_get_next_file(instance->load_context, &file_info)) {
+            const char* name = instance->load_context->file_name;
+
+            uint32_t file_timestamp = 0;
+            furi_string_printf(
+                plugin_path,
+                "%s/%s%s",
+                NFC_SUPPORTED_CARDS_PLUGINS_PATH,
+                name,
+                NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
+            storage_common_timestamp(storage, furi_string_get_cstr(plugin_path), &file_timestamp);
+
+            const NfcSupportedCardsPluginCache* indexed =
+                nfc_supported_cards_index_find(index, name, file_info.size, file_timestamp);
 
             NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
-            plugin_cache.name = furi_string_alloc_set(instance->load_context->file_name);
-            plugin_cache.protocol = plugin->protocol;
-            if(plugin->verify) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
-            }
-            if(plugin->read) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
-            }
-            if(plugin->parse) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
+            if(indexed) {
+                plugin_cache = *indexed;
+            } else {
+                plugin_cache.file_size = file_info.size;
+                plugin_cache.file_timestamp = file_timestamp;
+                index_changed = true;
+                // Failure may be transient, such a plugin is not indexed and is retried later
+                if(!nfc_supported_cards_describe_plugin(instance, &plugin_cache)) {
+                    FURI_LOG_W(TAG, "Failed to load plugin %s", name);
+                    continue;
+                }
             }
+            plugin_cache.name = furi_string_alloc_set(name);
+
             NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
+            if(plugin_cache.feature) plugins_loaded++;
+        }
+
+        furi_string_free(plugin_path);
+
+        // Removed plugins leave stale records behind
+        if(NfcSupportedCardsPluginCache_size(index) !=
+           NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr)) {
+            index_changed = true;
+        }
+
+        if(index_changed) {
+            nfc_supported_cards_index_save(storage, instance->plugins_cache_arr);
         }
 
+        nfc_supported_cards_plugins_cache_clear(index);
         nfc_supported_cards_load_context_free(instance->load_context);
 
-        size_t plugins_loaded = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr);
         if(plugins_loaded == 0) {
             FURI_LOG_D(TAG, "Plugins not found");
             instance->load_state = NfcSupportedCardsLoadStateFail;
@@ -237,6 +502,7 @@ bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nf
             NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
             if(plugin_cache->protocol != protocol) continue;
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasRead) == 0) continue;
+            if(!nfc_supported_cards_filter_match(&plugin_cache->filter, device)) continue;
 
             const ElfApiInterface* api_interface =
                 composite_api_resolver_get(instance->api_resolver);
@@ -285,6 +551,7 @@ bool nfc_supported_cards_parse(
             NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
             if(plugin_cache->protocol != protocol) continue;
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasParse) == 0) continue;
+            if(!nfc_supported_cards_filter_match(&plugin_cache->filter, device)) continue;
 
             const ElfApiInterface* api_interface =
                 composite_api_resolver_get(instance->api_resolver);
@@ -56,6 +56,7 @@
 #include <nfc/nfc_device.h>
 #include <nfc/helpers/nfc_data_generator.h>
 #include <toolbox/keys_dict.h>
+#include <toolbox/keys_dict_prefetcher.h>
 
 #include <gui/modules/validators.h>
 #include <toolbox/path.h>
@@ -84,6 +85,7 @@ typedef enum {
 
 typedef struct {
     KeysDict* dict;
+    KeysDictPrefetcher* dict_prefetcher;
     uint8_t sectors_total;
     uint8_t sectors_read;
     uint8_t current_sector;
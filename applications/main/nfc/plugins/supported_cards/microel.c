@@ -216,6 +216,7 @@ static const NfcSupportedCardsPlugin microel_plugin = {
         NULL, // the verification I need is based on verifying the keys generated via uid and try to authenticate not like on mizip that there is default b0 but added verify in read function
     .read = microel_read,
     .parse = microel_parse,
+    .filter = {.uid_len = UID_LENGTH},
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
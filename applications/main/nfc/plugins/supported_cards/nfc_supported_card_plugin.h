@@ -35,8 +35,10 @@
 
 /**
  * @brief Currently supported plugin API version.
+ *
+ * Version 1 plugins, which have no filter, are still accepted.
  */
-#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 1
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 2
 
 /**
  * @brief Verify that the card is of a supported type.
@@ -81,6 +83,21 @@ typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
  */
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
 
+/**
+ * @brief Card filter checked by the application before loading the plugin.
+ *
+ * The filter is stored in the plugin index, so plugins for other cards are not
+ * loaded at all. A zero-initialized filter matches any card. SAK and ATQA are
+ * only available for ISO14443-3A based protocols.
+ */
+typedef struct {
+    uint8_t uid_len; /**< Required UID length, 0 for any. */
+    uint8_t sak; /**< Required SAK bits. */
+    uint8_t sak_mask; /**< SAK bits to check, 0 for any. */
+    uint8_t atqa[2]; /**< Required ATQA bits. */
+    uint8_t atqa_mask[2]; /**< ATQA bits to check, 0 for any. */
+} NfcSupportedCardPluginFilter;
+
 /**
  * @brief Supported card plugin interface.
  *
@@ -91,4 +108,5 @@ typedef struct {
     NfcSupportedCardPluginVerify verify; /**< Pointer to the verify() function. */
     NfcSupportedCardPluginRead read; /**< Pointer to the read() function. */
     NfcSupportedCardPluginParse parse; /**< Pointer to the parse() function. */
+    NfcSupportedCardPluginFilter filter; /**< Optional card filter. */
 } NfcSupportedCardsPlugin;
@@ -41,8 +41,8 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeRequestKey) {
         MfClassicKey key = {};
-        if(keys_dict_get_next_key(
-               instance->nfc_dict_context.dict, key.data, sizeof(MfClassicKey))) {
+        if(keys_dict_prefetcher_get_next_key(
+               instance->nfc_dict_context.dict_prefetcher, key.data, sizeof(MfClassicKey))) {
             mfc_event->data->key_request_data.key = key;
             mfc_event->data->key_request_data.key_provided = true;
             instance->nfc_dict_context.dict_keys_current++;
@@ -61,7 +61,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeNextSector) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        keys_dict_prefetcher_rewind(instance->nfc_dict_context.dict_prefetcher);
         instance->nfc_dict_context.dict_keys_current = 0;
         instance->nfc_dict_context.current_sector =
             mfc_event->data->next_sector_data.current_sector;
@@ -80,7 +80,7 @@ NfcCommand nfc_dict_attack_worker_callback(NfcGenericEvent event, void* context)
         view_dispatcher_send_custom_event(
             instance->view_dispatcher, NfcCustomEventDictAttackDataUpdate);
     } else if(mfc_event->type == MfClassicPollerEventTypeKeyAttackStop) {
-        keys_dict_rewind(instance->nfc_dict_context.dict);
+        keys_dict_prefetcher_rewind(instance->nfc_dict_context.dict_prefetcher);
         instance->nfc_dict_context.is_key_attack = false;
         instance->nfc_dict_context.dict_keys_current = 0;
         view_dispatcher_send_custom_event(
@@ -120,6 +120,15 @@ static void nfc_scene_mf_classic_dict_attack_update_view(NfcApp* instance) {
     }
 }
 
+static void nfc_scene_mf_classic_dict_attack_free_dict(NfcApp* instance) {
+    // Prefetcher is not allocated yet when an empty user dictionary is skipped
+    if(instance->nfc_dict_context.dict_prefetcher) {
+        keys_dict_prefetcher_free(instance->nfc_dict_context.dict_prefetcher);
+        instance->nfc_dict_context.dict_prefetcher = NULL;
+    }
+    keys_dict_free(instance->nfc_dict_context.dict);
+}
+
 static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
     uint32_t state =
         scene_manager_get_scene_state(instance->scene_manager, NfcSceneMfClassicDictAttack);
@@ -133,7 +142,7 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
             instance->nfc_dict_context.dict = keys_dict_alloc(
                 NFC_APP_MF_CLASSIC_DICT_USER_PATH, KeysDictModeOpenAlways, sizeof(MfClassicKey));
             if(keys_dict_get_total_keys(instance->nfc_dict_context.dict) == 0) {
-                keys_dict_free(instance->nfc_dict_context.dict);
+                nfc_scene_mf_classic_dict_attack_free_dict(instance);
                 state = DictAttackStateSystemDictInProgress;
                 break;
             }
@@ -149,6 +158,9 @@ static void nfc_scene_mf_classic_dict_attack_prepare_view(NfcApp* instance) {
 
     instance->nfc_dict_context.dict_keys_total =
         keys_dict_get_total_keys(instance->nfc_dict_context.dict);
+    // Keys are requested while the card is in the field, keep storage access off that path
+    instance->nfc_dict_context.dict_prefetcher =
+        keys_dict_prefetcher_alloc(instance->nfc_dict_context.dict, sizeof(MfClassicKey));
     dict_attack_set_total_dict_keys(
         instance->dict_attack, instance->nfc_dict_context.dict_keys_total);
     instance->nfc_dict_context.dict_keys_current = 0;
@@ -196,7 +208,7 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
             if(state == DictAttackStateUserDictInProgress) {
                 nfc_poller_stop(instance->poller);
                 nfc_poller_free(instance->poller);
-                keys_dict_free(instance->nfc_dict_context.dict);
+                nfc_scene_mf_classic_dict_attack_free_dict(instance);
                 scene_manager_set_scene_state(
                     instance->scene_manager,
                     NfcSceneMfClassicDictAttack,
@@ -226,7 +238,7 @@ bool nfc_scene_mf_classic_dict_attack_on_event(void* context, SceneManagerEvent
                 if(instance->nfc_dict_context.is_card_present) {
                     nfc_poller_stop(instance->poller);
                     nfc_poller_free(instance->poller);
-                    keys_dict_free(instance->nfc_dict_context.dict);
+                    nfc_scene_mf_classic_dict_attack_free_dict(instance);
                     scene_manager_set_scene_state(
                         instance->scene_manager,
                         NfcSceneMfClassicDictAttack,
@@ -264,7 +276,7 @@ void nfc_scene_mf_classic_dict_attack_on_exit(void* context) {
     scene_manager_set_scene_state(
         instance->scene_manager, NfcSceneMfClassicDictAttack, DictAttackStateUserDictInProgress);
 
-    keys_dict_free(instance->nfc_dict_context.dict);
+    nfc_scene_mf_classic_dict_attack_free_dict(instance);
 
     instance->nfc_dict_context.current_sector = 0;
     instance->nfc_dict_context.sectors_total = 0;
@@ -67,6 +67,17 @@ void subghz_scene_receiver_callback(SubGhzCustomEvent event, void* context) {
     view_dispatcher_send_custom_event(subghz->view_dispatcher, event);
 }
 
+static void subghz_scene_receiver_item_callback(
+    void* context,
+    uint16_t idx,
+    FuriString* output,
+    uint8_t* type) {
+    furi_assert(context);
+    SubGhzHistory* history = context;
+    subghz_history_get_text_item_menu(history, output, idx);
+    *type = subghz_history_get_type_protocol(history, idx);
+}
+
 static void subghz_scene_add_to_history_callback(
     SubGhzReceiver* receiver,
     SubGhzProtocolDecoderBase* decoder_base,
@@ -74,25 +85,16 @@ static void subghz_scene_add_to_history_callback(
     furi_assert(context);
     SubGhz* subghz = context;
     SubGhzHistory* history = subghz->history;
-    FuriString* str_buff = furi_string_alloc();
 
     SubGhzRadioPreset preset = subghz_txrx_get_preset(subghz->txrx);
 
     if(subghz_history_add_to_history(history, decoder_base, &preset)) {
-        furi_string_reset(str_buff);
-
         subghz->state_notifications = SubGhzNotificationStateRxDone;
-        uint16_t item_history = subghz_history_get_item(history);
-        subghz_history_get_text_item_menu(history, str_buff, item_history - 1);
-        subghz_view_receiver_add_item_to_menu(
-            subghz->subghz_receiver,
-            furi_string_get_cstr(str_buff),
-            subghz_history_get_type_protocol(history, item_history - 1));
-
-        subghz_scene_receiver_update_statusbar(subghz);
+        // Menu text may come from SD card, view is updated from the scene thread
+        view_dispatcher_send_custom_event(
+            subghz->view_dispatcher, SubGhzCustomEventSceneReceiverAddItem);
     }
     subghz_receiver_reset(receiver);
-    furi_string_free(str_buff);
     subghz_rx_key_state_set(subghz, SubGhzRxKeyStateAddKey);
 }
 
@@ -100,9 +102,6 @@ void subghz_scene_receiver_on_enter(void* context) {
     SubGhz* subghz = context;
     SubGhzHistory* history = subghz->history;
 
-    FuriString* str_buff;
-    str_buff = furi_string_alloc();
-
     if(subghz_rx_key_state_get(subghz) == SubGhzRxKeyStateIDLE) {
         subghz_set_default_preset(subghz);
         subghz_history_reset(history);
@@ -111,18 +110,14 @@ void subghz_scene_receiver_on_enter(void* context) {
 
     subghz_view_receiver_set_lock(subghz->subghz_receiver, subghz_is_locked(subghz));
 
-    //Load history to receiver
+    //Load history to receiver, visible items are fetched by the view
     subghz_view_receiver_exit(subghz->subghz_receiver);
-    for(uint8_t i = 0; i < subghz_history_get_item(history); i++) {
-        furi_string_reset(str_buff);
-        subghz_history_get_text_item_menu(history, str_buff, i);
-        subghz_view_receiver_add_item_to_menu(
-            subghz->subghz_receiver,
-            furi_string_get_cstr(str_buff),
-            subghz_history_get_type_protocol(history, i));
+    subghz_view_receiver_set_item_callback(
+        subghz->subghz_receiver, subghz_scene_receiver_item_callback, history);
+    subghz_view_receiver_set_item_count(subghz->subghz_receiver, subghz_history_get_item(history));
+    if(subghz_history_get_item(history)) {
         subghz_rx_key_state_set(subghz, SubGhzRxKeyStateAddKey);
     }
-    furi_string_free(str_buff);
 
     subghz_view_receiver_set_callback(
         subghz->subghz_receiver, subghz_scene_receiver_callback, subghz);
@@ -146,6 +141,12 @@ bool subghz_scene_receiver_on_event(void* context, SceneManagerEvent event) {
     bool consumed = false;
     if(event.type == SceneManagerEventTypeCustom) {
         switch(event.event) {
+        case SubGhzCustomEventSceneReceiverAddItem:
+            subghz_history_flush(subghz->history);
+            subghz_view_receiver_add_item_to_menu(subghz->subghz_receiver);
+            subghz_scene_receiver_update_statusbar(subghz);
+            consumed = true;
+            break;
         case SubGhzCustomEventViewReceiverBack:
             // Stop CC1101 Rx
             subghz->state_notifications = SubGhzNotificationStateIDLE;
@@ -189,6 +190,7 @@ bool subghz_scene_receiver_on_event(void* context, SceneManagerEvent event) {
             break;
         }
     } else if(event.type == SceneManagerEventTypeTick) {
+        subghz_history_flush(subghz->history);
         if(subghz_txrx_hopper_get_state(subghz->txrx) != SubGhzHopperStateOFF) {
             subghz_txrx_hopper_update(subghz->txrx);
             subghz_scene_receiver_update_statusbar(subghz);
@@ -10,14 +10,16 @@ void subghz_scene_receiver_info_callback(SubGhzCustomEvent event, void* context)
 
 static bool subghz_scene_receiver_info_update_parser(void* context) {
     SubGhz* subghz = context;
+    // Spilled history is read from SD card, which may fail
+    FlipperFormat* raw_data =
+        subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen);
 
-    if(subghz_txrx_load_decoder_by_name_protocol(
+    if(raw_data &&
+       subghz_txrx_load_decoder_by_name_protocol(
            subghz->txrx,
            subghz_history_get_protocol_name(subghz->history, subghz->idx_menu_chosen))) {
         // we are trying to deserialize without checking for errors, since it is assumed that we just received this chignal
-        subghz_protocol_decoder_base_deserialize(
-            subghz_txrx_get_decoder(subghz->txrx),
-            subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen));
+        subghz_protocol_decoder_base_deserialize(subghz_txrx_get_decoder(subghz->txrx), raw_data);
 
         SubGhzRadioPreset* preset =
             subghz_history_get_radio_preset(subghz->history, subghz->idx_menu_chosen);
@@ -74,14 +76,18 @@ bool subghz_scene_receiver_info_on_event(void* context, SceneManagerEvent event)
     SubGhz* subghz = context;
     if(event.type == SceneManagerEventTypeCustom) {
         if(event.event == SubGhzCustomEventViewTransmitterSendStart) {
-            if(!subghz_scene_receiver_info_update_parser(subghz)) {
-                return false;
+            FlipperFormat* raw_data = NULL;
+            if(subghz_scene_receiver_info_update_parser(subghz)) {
+                raw_data = subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen);
+            }
+            if(!raw_data) {
+                view_dispatcher_send_custom_event(
+                    subghz->view_dispatcher, SubGhzCustomEventSceneShowErrorSub);
+                return true;
             }
             //CC1101 Stop RX -> Start TX
             subghz_txrx_hopper_pause(subghz->txrx);
-            if(!subghz_tx_start(
-                   subghz,
-                   subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen))) {
+            if(!subghz_tx_start(subghz, raw_data)) {
                 subghz_txrx_rx_start(subghz->txrx);
                 subghz_txrx_hopper_unpause(subghz->txrx);
                 subghz->state_notifications = SubGhzNotificationStateRx;
@@ -105,7 +111,9 @@ bool subghz_scene_receiver_info_on_event(void* context, SceneManagerEvent event)
 
             subghz_txrx_stop(subghz->txrx);
             if(!subghz_scene_receiver_info_update_parser(subghz)) {
-                return false;
+                view_dispatcher_send_custom_event(
+                    subghz->view_dispatcher, SubGhzCustomEventSceneShowErrorSub);
+                return true;
             }
 
             if(subghz_txrx_protocol_is_serializable(subghz->txrx)) {
@@ -119,6 +127,8 @@ bool subghz_scene_receiver_info_on_event(void* context, SceneManagerEvent event)
         }
 
     } else if(event.type == SceneManagerEventTypeTick) {
+        // Receiving goes on in background
+        subghz_history_flush(subghz->history);
         if(subghz_txrx_hopper_get_state(subghz->txrx) != SubGhzHopperStateOFF) {
             subghz_txrx_hopper_update(subghz->txrx);
         }
@@ -9,6 +9,7 @@
 #include <lib/subghz/receiver.h>
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_raw_file.h>
 #include <lib/subghz/protocols/protocol_items.h>
 #include <lib/subghz/devices/cc1101_int/cc1101_int_interconnect.h>
 #include <lib/subghz/devices/devices.h>
@@ -497,7 +498,8 @@ void subghz_cli_command_decode_raw(Cli* cli, FuriString* args, void* context) {
         }
 
         if(!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE) &&
-           temp_data32 == SUBGHZ_KEY_FILE_VERSION) {
+           (temp_data32 == SUBGHZ_RAW_FILE_VERSION ||
+            temp_data32 == SUBGHZ_RAW_FILE_VERSION_BINARY)) {
         } else {
             printf("subghz decode_raw \033[0;31mType or version mismatch\033[0m\r\n");
             break;
@@ -644,9 +646,11 @@ void subghz_cli_command_tx_from_file(Cli* cli, FuriString* args, void* context)
             break;
         }
 
-        if(((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_KEY_FILE_TYPE)) ||
-            (!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE))) &&
-           temp_data32 == SUBGHZ_KEY_FILE_VERSION) {
+        if(((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_KEY_FILE_TYPE)) &&
+            temp_data32 == SUBGHZ_KEY_FILE_VERSION) ||
+           ((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE)) &&
+            (temp_data32 == SUBGHZ_RAW_FILE_VERSION ||
+             temp_data32 == SUBGHZ_RAW_FILE_VERSION_BINARY))) {
         } else {
             printf("subghz tx_from_file: \033[0;31mType or version mismatch\033[0m\r\n");
             break;
@@ -829,6 +833,8 @@ static void subghz_cli_command_print_usage(void) {
     printf("\trx <frequency:in Hz> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Receive\r\n");
     printf("\trx_raw <frequency:in Hz>\t - Receive RAW\r\n");
     printf("\tdecode_raw <file_name: path_RAW_file>\t - Testing\r\n");
+    printf(
+        "\tconvert_raw <path_source_RAW_file> <path_destination_RAW_file> <format: text, binary>\t - Convert RAW file\r\n");
     printf(
         "\ttx_from_file <file_name: path_file> <repeat: count> <device: 0 - CC1101_INT, 1 - CC1101_EXT>\t - Transmitting from file\r\n");
 
@@ -924,6 +930,46 @@ static void subghz_cli_command_encrypt_raw(Cli* cli, FuriString* args) {
     furi_string_free(source);
 }
 
+static void subghz_cli_command_convert_raw(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+
+    FuriString* source;
+    FuriString* destination;
+    FuriString* format;
+    source = furi_string_alloc();
+    destination = furi_string_alloc();
+    format = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, source) ||
+           !args_read_string_and_trim(args, destination) ||
+           !args_read_string_and_trim(args, format)) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        bool binary = furi_string_cmp_str(format, "binary") == 0;
+        if(!binary && furi_string_cmp_str(format, "text") != 0) {
+            subghz_cli_command_print_usage();
+            break;
+        }
+
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        if(!subghz_raw_file_convert(
+               storage,
+               furi_string_get_cstr(source),
+               furi_string_get_cstr(destination),
+               binary)) {
+            printf("subghz convert_raw \033[0;31mConversion failed\033[0m\r\n");
+        }
+        furi_record_close(RECORD_STORAGE);
+    } while(false);
+
+    furi_string_free(format);
+    furi_string_free(destination);
+    furi_string_free(source);
+}
+
 static void subghz_cli_command_chat(Cli* cli, FuriString* args) {
     uint32_t frequency = 433920000;
     uint32_t device_ind = 0; // 0 - CC1101_INT, 1 - CC1101_EXT
@@ -1155,6 +1201,11 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "convert_raw") == 0) {
+            subghz_cli_command_convert_raw(cli, args);
+            break;
+        }
+
         if(furi_string_cmp_str(cmd, "tx_from_file") == 0) {
             subghz_cli_command_tx_from_file(cli, args, context);
             break;
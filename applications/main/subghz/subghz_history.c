@@ -1,93 +1,194 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
-#include <lib/subghz/protocols/came.h>
+#include <lib/subghz/subghz_protocol_registry.h>
+#include <lib/subghz/blocks/generic.h>
+#include <toolbox/stream/file_stream.h>
+#include <toolbox/stream/string_stream.h>
+#include <flipper_format/flipper_format_i.h>
 
 #include <furi.h>
 
-#define SUBGHZ_HISTORY_MAX       50
-#define SUBGHZ_HISTORY_FREE_HEAP 20480
+#define SUBGHZ_HISTORY_MAX         4096
+#define SUBGHZ_HISTORY_RAM_RECORDS 512
+#define SUBGHZ_HISTORY_FREE_HEAP   20480
+#define SUBGHZ_HISTORY_PRESETS_MAX UINT8_MAX
+#define SUBGHZ_HISTORY_BLOB_NONE   0
+
+#define SUBGHZ_HISTORY_RECORDS_PATH SUBGHZ_APP_FOLDER "/.history_records"
+#define SUBGHZ_HISTORY_BLOBS_PATH   SUBGHZ_APP_FOLDER "/.history_blobs"
 
 #define TAG "SubGhzHistory"
 
+/** Received signal. Signals that serialize into nothing but the generic
+ * fields are restored from the record alone, others keep their serialized
+ * data in the blob stream. */
 typedef struct {
-    FuriString* item_str;
-    FlipperFormat* flipper_string;
-    uint8_t type;
-    SubGhzRadioPreset* preset;
-} SubGhzHistoryItem;
+    uint64_t key;
+    uint32_t timestamp; /**< RTC timestamp of reception */
+    uint32_t blob; /**< Blob offset + 1, SUBGHZ_HISTORY_BLOB_NONE if there is none */
+    uint16_t te; /**< 0 if the protocol doesn't save TE */
+    uint16_t bit_count;
+    uint8_t protocol; /**< Protocol index in the registry */
+    uint8_t preset; /**< Index in the preset table */
+} SubGhzHistoryRecord;
 
-ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem, M_POD_OPLIST)
+static_assert(sizeof(SubGhzHistoryRecord) == 24);
 
-#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_POD_OPLIST)
-
-typedef struct {
-    SubGhzHistoryItemArray_t data;
-} SubGhzHistoryStruct;
+ARRAY_DEF(SubGhzHistoryPresetArray, SubGhzRadioPreset*, M_PTR_OPLIST) // NOLINT
 
 struct SubGhzHistory {
     uint32_t last_update_timestamp;
     uint16_t last_index_write;
     uint8_t code_last_hash_data;
     FuriString* tmp_string;
-    SubGhzHistoryStruct* history;
+    FuriMutex* mutex;
+
+    // Newest records, older ones are spilled to the SD card by subghz_history_flush
+    SubGhzHistoryRecord* records;
+    uint16_t spilled;
+    SubGhzHistoryPresetArray_t presets;
+
+    Storage* storage;
+    bool storage_checked;
+    Stream* record_stream;
+    Stream* blob_stream;
+    size_t blob_spilled;
+
+    // Blobs that are not on the SD card yet, all of them without SD card
+    Stream* blob_buffer;
+    Stream* blob_spill;
+    size_t blob_total;
+
+    FlipperFormat* flipper_add;
+    FlipperFormat* flipper_record;
+    FlipperFormat* flipper_string;
 };
 
 SubGhzHistory* subghz_history_alloc(void) {
     SubGhzHistory* instance = malloc(sizeof(SubGhzHistory));
     instance->tmp_string = furi_string_alloc();
-    instance->history = malloc(sizeof(SubGhzHistoryStruct));
-    SubGhzHistoryItemArray_init(instance->history->data);
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    SubGhzHistoryPresetArray_init(instance->presets);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->blob_buffer = string_stream_alloc();
+    instance->blob_spill = string_stream_alloc();
+    instance->flipper_add = flipper_format_string_alloc();
+    instance->flipper_record = flipper_format_string_alloc();
+    instance->flipper_string = flipper_format_string_alloc();
     return instance;
 }
 
 void subghz_history_free(SubGhzHistory* instance) {
     furi_assert(instance);
+    subghz_history_reset(instance);
+    SubGhzHistoryPresetArray_clear(instance->presets);
+    stream_free(instance->blob_buffer);
+    stream_free(instance->blob_spill);
+    flipper_format_free(instance->flipper_add);
+    flipper_format_free(instance->flipper_record);
+    flipper_format_free(instance->flipper_string);
+    furi_record_close(RECORD_STORAGE);
+    furi_mutex_free(instance->mutex);
     furi_string_free(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_clear(instance->history->data);
-    free(instance->history);
     free(instance);
 }
 
+static uint16_t subghz_history_get_capacity(SubGhzHistory* instance) {
+    return instance->record_stream ? SUBGHZ_HISTORY_MAX : SUBGHZ_HISTORY_RAM_RECORDS;
+}
+
+static bool subghz_history_get_record(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    SubGhzHistoryRecord* record) {
+    furi_check(idx < instance->last_index_write);
+
+    if(idx >= instance->spilled) {
+        *record = instance->records[idx % SUBGHZ_HISTORY_RAM_RECORDS];
+        return true;
+    }
+
+    if(!stream_seek(
+           instance->record_stream,
+           idx * sizeof(SubGhzHistoryRecord),
+           StreamOffsetFromStart) ||
+       stream_read(instance->record_stream, (uint8_t*)record, sizeof(SubGhzHistoryRecord)) !=
+           sizeof(SubGhzHistoryRecord)) {
+        FURI_LOG_E(TAG, "Unable to read record %u", idx);
+        return false;
+    }
+    return true;
+}
+
+static SubGhzRadioPreset*
+    subghz_history_get_record_preset(SubGhzHistory* instance, uint16_t idx) {
+    SubGhzHistoryRecord record;
+    if(!subghz_history_get_record(instance, idx, &record)) {
+        return *SubGhzHistoryPresetArray_get(instance->presets, 0);
+    }
+    return *SubGhzHistoryPresetArray_get(instance->presets, record.preset);
+}
+
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    uint32_t frequency = subghz_history_get_record_preset(instance, idx)->frequency;
+    furi_mutex_release(instance->mutex);
+    return frequency;
 }
 
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    SubGhzRadioPreset* preset = subghz_history_get_record_preset(instance, idx);
+    furi_mutex_release(instance->mutex);
+    return preset;
 }
 
 const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    const char* name = furi_string_get_cstr(subghz_history_get_record_preset(instance, idx)->name);
+    furi_mutex_release(instance->mutex);
+    return name;
 }
 
 void subghz_history_reset(SubGhzHistory* instance) {
     furi_assert(instance);
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
     furi_string_reset(instance->tmp_string);
+
+    free(instance->records);
+    instance->records = NULL;
+    instance->spilled = 0;
+
     for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
+        M_EACH(preset, instance->presets, SubGhzHistoryPresetArray_t) {
+            furi_string_free((*preset)->name);
+            free(*preset);
         }
-    SubGhzHistoryItemArray_reset(instance->history->data);
+    SubGhzHistoryPresetArray_reset(instance->presets);
+
+    if(instance->record_stream) {
+        // Blobs are spilled along with records
+        file_stream_close(instance->record_stream);
+        file_stream_close(instance->blob_stream);
+        stream_free(instance->record_stream);
+        stream_free(instance->blob_stream);
+        instance->record_stream = NULL;
+        instance->blob_stream = NULL;
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_RECORDS_PATH);
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_BLOBS_PATH);
+    }
+    instance->storage_checked = false;
+    instance->blob_spilled = 0;
+    instance->blob_total = 0;
+    stream_clean(instance->blob_buffer);
+    stream_clean(instance->blob_spill);
+
     instance->last_index_write = 0;
     instance->code_last_hash_data = 0;
+    furi_mutex_release(instance->mutex);
 }
 
 uint16_t subghz_history_get_item(SubGhzHistory* instance) {
@@ -95,50 +196,372 @@ uint16_t subghz_history_get_item(SubGhzHistory* instance) {
     return instance->last_index_write;
 }
 
+static const SubGhzProtocol*
+    subghz_history_get_record_protocol(SubGhzHistory* instance, uint16_t idx) {
+    SubGhzHistoryRecord record;
+    if(!subghz_history_get_record(instance, idx, &record)) return NULL;
+    return subghz_protocol_registry_get_by_index(&subghz_protocol_registry, record.protocol);
+}
+
 uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->type;
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    const SubGhzProtocol* protocol = subghz_history_get_record_protocol(instance, idx);
+    furi_mutex_release(instance->mutex);
+    return protocol ? protocol->type : SubGhzProtocolTypeUnknown;
 }
 
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-        FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    const SubGhzProtocol* protocol = subghz_history_get_record_protocol(instance, idx);
+    furi_mutex_release(instance->mutex);
+    return protocol ? protocol->name : "";
+}
+
+/** Serialize record the way generic block does, followed by TE if it was saved */
+static bool subghz_history_record_serialize(
+    SubGhzHistory* instance,
+    const SubGhzHistoryRecord* record,
+    FlipperFormat* flipper_format) {
+    SubGhzRadioPreset* preset = *SubGhzHistoryPresetArray_get(instance->presets, record->preset);
+    const SubGhzProtocol* protocol =
+        subghz_protocol_registry_get_by_index(&subghz_protocol_registry, record->protocol);
+    SubGhzBlockGeneric generic = {
+        .protocol_name = protocol->name,
+        .data = record->key,
+        .data_count_bit = record->bit_count,
+    };
+
+    if(subghz_block_generic_serialize(&generic, flipper_format, preset) !=
+       SubGhzProtocolStatusOk) {
+        return false;
     }
-    return furi_string_get_cstr(instance->tmp_string);
+    if(record->te) {
+        uint32_t te = record->te;
+        if(!flipper_format_write_uint32(flipper_format, "TE", &te, 1)) return false;
+    }
+    return true;
+}
+
+static bool subghz_history_blob_load(
+    SubGhzHistory* instance,
+    uint32_t blob,
+    FlipperFormat* flipper_format) {
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    Stream* source = instance->blob_stream;
+    size_t offset = blob - 1;
+    uint16_t size = 0;
+
+    // Blob offsets continue from the SD card file into the RAM buffer
+    if(offset >= instance->blob_spilled) {
+        source = instance->blob_buffer;
+        offset -= instance->blob_spilled;
+    }
+
+    stream_clean(stream);
+    bool result = stream_seek(source, offset, StreamOffsetFromStart) &&
+                  stream_read(source, (uint8_t*)&size, sizeof(size)) == sizeof(size) &&
+                  stream_copy(source, stream, size) == size;
+    flipper_format_rewind(flipper_format);
+
+    return result;
+}
+
+static bool subghz_history_load(
+    SubGhzHistory* instance,
+    uint16_t idx,
+    FlipperFormat* flipper_format) {
+    SubGhzHistoryRecord record;
+    if(!subghz_history_get_record(instance, idx, &record)) return false;
+
+    bool result = (record.blob == SUBGHZ_HISTORY_BLOB_NONE) ?
+                      subghz_history_record_serialize(instance, &record, flipper_format) :
+                      subghz_history_blob_load(instance, record.blob, flipper_format);
+    flipper_format_rewind(flipper_format);
+
+    return result;
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item->flipper_string) {
-        return item->flipper_string;
-    } else {
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    bool loaded = subghz_history_load(instance, idx, instance->flipper_string);
+    furi_mutex_release(instance->mutex);
+
+    if(!loaded) {
+        FURI_LOG_E(TAG, "Unable to load item %u", idx);
         return NULL;
     }
+    return instance->flipper_string;
 }
+
 bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* output) {
     furi_assert(instance);
     if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) {
         if(output != NULL) furi_string_printf(output, "    Free heap LOW");
         return true;
     }
-    if(instance->last_index_write == SUBGHZ_HISTORY_MAX) {
+    if(instance->last_index_write >= subghz_history_get_capacity(instance)) {
         if(output != NULL) furi_string_printf(output, "   Memory is FULL");
         return true;
     }
-    if(output != NULL)
-        furi_string_printf(output, "%02u/%02u", instance->last_index_write, SUBGHZ_HISTORY_MAX);
+    // Capacity depends on SD card and doesn't fit the status bar anyway
+    if(output != NULL) furi_string_printf(output, "%02u", instance->last_index_write);
     return false;
 }
 
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    furi_assert(instance);
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+
+    SubGhzHistoryRecord record;
+    const SubGhzProtocol* protocol = NULL;
+    if(subghz_history_get_record(instance, idx, &record)) {
+        protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, record.protocol);
+    }
+
+    furi_string_reset(output);
+    if(protocol) {
+        furi_string_set(output, protocol->name);
+
+        const bool is_keeloq = !strcmp(protocol->name, "KeeLoq");
+        if((is_keeloq || !strcmp(protocol->name, "Star Line")) &&
+           (record.blob != SUBGHZ_HISTORY_BLOB_NONE)) {
+            // Manufacture is only known to the serialized data
+            FlipperFormat* flipper_format = flipper_format_string_alloc();
+            if(subghz_history_blob_load(instance, record.blob, flipper_format) &&
+               flipper_format_read_string(flipper_format, "Manufacture", instance->tmp_string)) {
+                furi_string_printf(
+                    output,
+                    "%s %s",
+                    is_keeloq ? "KL" : "SL",
+                    furi_string_get_cstr(instance->tmp_string));
+            }
+            flipper_format_free(flipper_format);
+        }
+
+        if(record.key != 0) {
+            if(!(uint32_t)(record.key >> 32)) {
+                furi_string_cat_printf(output, " %lX", (uint32_t)(record.key & 0xFFFFFFFF));
+            } else {
+                furi_string_cat_printf(
+                    output,
+                    " %lX%08lX",
+                    (uint32_t)(record.key >> 32),
+                    (uint32_t)(record.key & 0xFFFFFFFF));
+            }
+        }
+    }
+
+    furi_mutex_release(instance->mutex);
+}
+
+static void subghz_history_open_storage(SubGhzHistory* instance) {
+    if(storage_sd_status(instance->storage) != FSE_OK ||
+       !storage_simply_mkdir(instance->storage, SUBGHZ_APP_FOLDER)) {
+        return;
+    }
+
+    Stream* record_stream = file_stream_alloc(instance->storage);
+    Stream* blob_stream = file_stream_alloc(instance->storage);
+    if(file_stream_open(
+           record_stream, SUBGHZ_HISTORY_RECORDS_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS) &&
+       file_stream_open(
+           blob_stream, SUBGHZ_HISTORY_BLOBS_PATH, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) {
+        // Capacity depends on it, receiver callback checks it
+        furi_mutex_acquire(instance->mutex, FuriWaitForever);
+        instance->record_stream = record_stream;
+        instance->blob_stream = blob_stream;
+        furi_mutex_release(instance->mutex);
+        return;
+    }
+
+    FURI_LOG_W(TAG, "Unable to open spill files, keeping history in RAM");
+    file_stream_close(record_stream);
+    file_stream_close(blob_stream);
+    stream_free(record_stream);
+    stream_free(blob_stream);
+}
+
+void subghz_history_flush(SubGhzHistory* instance) {
+    furi_assert(instance);
+
+    if(!instance->storage_checked) {
+        // Don't touch SD card until there is something to keep
+        if(!subghz_history_get_item(instance)) return;
+        instance->storage_checked = true;
+        subghz_history_open_storage(instance);
+    }
+    if(!instance->record_stream) return;
+
+    // Keep half of the RAM records free for signals received during the write
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    const uint16_t first = instance->spilled;
+    const uint16_t in_ram = instance->last_index_write - first;
+    const uint16_t count = in_ram > SUBGHZ_HISTORY_RAM_RECORDS / 2 ?
+                               in_ram - SUBGHZ_HISTORY_RAM_RECORDS / 2 :
+                               0;
+    Stream* blobs = instance->blob_buffer;
+    instance->blob_buffer = instance->blob_spill;
+    instance->blob_spill = blobs;
+    furi_mutex_release(instance->mutex);
+
+    // Slots of records that are not counted as spilled yet are never reused
+    uint16_t written = 0;
+    if(count &&
+       stream_seek(
+           instance->record_stream, first * sizeof(SubGhzHistoryRecord), StreamOffsetFromStart)) {
+        while(written < count) {
+            const SubGhzHistoryRecord* record =
+                &instance->records[(first + written) % SUBGHZ_HISTORY_RAM_RECORDS];
+            if(stream_write(instance->record_stream, (const uint8_t*)record, sizeof(*record)) !=
+               sizeof(*record)) {
+                break;
+            }
+            written++;
+        }
+    }
+    if(written != count) {
+        FURI_LOG_E(TAG, "Unable to spill records");
+    }
+
+    const size_t blob_size = stream_size(blobs);
+    const bool blobs_written =
+        !blob_size ||
+        (stream_seek(instance->blob_stream, instance->blob_spilled, StreamOffsetFromStart) &&
+         stream_rewind(blobs) &&
+         stream_copy(blobs, instance->blob_stream, blob_size) == blob_size);
+
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
+    instance->spilled += written;
+    if(blobs_written) {
+        instance->blob_spilled += blob_size;
+        stream_clean(blobs);
+    } else {
+        // Blobs received meanwhile follow the failed ones, keep them all in RAM
+        FURI_LOG_E(TAG, "Unable to spill blobs");
+        stream_seek(blobs, 0, StreamOffsetFromEnd);
+        stream_rewind(instance->blob_buffer);
+        stream_copy(instance->blob_buffer, blobs, stream_size(instance->blob_buffer));
+        stream_clean(instance->blob_buffer);
+        instance->blob_spill = instance->blob_buffer;
+        instance->blob_buffer = blobs;
+    }
+    furi_mutex_release(instance->mutex);
+}
+
+static bool subghz_history_find_preset(
+    SubGhzHistory* instance,
+    const SubGhzRadioPreset* preset,
+    uint8_t* index) {
+    size_t count = SubGhzHistoryPresetArray_size(instance->presets);
+    for(size_t i = 0; i < count; i++) {
+        const SubGhzRadioPreset* item = *SubGhzHistoryPresetArray_get(instance->presets, i);
+        if(item->frequency == preset->frequency && item->data == preset->data &&
+           furi_string_equal(item->name, preset->name)) {
+            *index = i;
+            return true;
+        }
+    }
+
+    if(count == SUBGHZ_HISTORY_PRESETS_MAX) return false;
+
+    SubGhzRadioPreset* item = malloc(sizeof(SubGhzRadioPreset));
+    item->name = furi_string_alloc_set(preset->name);
+    item->frequency = preset->frequency;
+    item->data = preset->data;
+    item->data_size = preset->data_size;
+    SubGhzHistoryPresetArray_push_back(instance->presets, item);
+    *index = count;
+    return true;
+}
+
+static bool subghz_history_find_protocol(const SubGhzProtocol* protocol, uint8_t* index) {
+    size_t count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    for(size_t i = 0; i < count && i <= UINT8_MAX; i++) {
+        if(subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i) == protocol) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool subghz_history_stream_equal(Stream* first, Stream* second) {
+    if(stream_size(first) != stream_size(second)) return false;
+    if(!stream_rewind(first) || !stream_rewind(second)) return false;
+
+    uint8_t first_buffer[32];
+    uint8_t second_buffer[32];
+    size_t count;
+    while((count = stream_read(first, first_buffer, sizeof(first_buffer))) > 0) {
+        if(stream_read(second, second_buffer, count) != count ||
+           memcmp(first_buffer, second_buffer, count) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Fill record from serialized data, store the data as a blob if the record can't restore it */
+static bool subghz_history_record_fill(SubGhzHistory* instance, SubGhzHistoryRecord* record) {
+    FlipperFormat* flipper_format = instance->flipper_add;
+    uint32_t temp_data32 = 0;
+
+    flipper_format_rewind(flipper_format);
+    if(flipper_format_read_uint32(flipper_format, "Bit", &temp_data32, 1) &&
+       temp_data32 <= UINT16_MAX) {
+        record->bit_count = temp_data32;
+    }
+
+    flipper_format_rewind(flipper_format);
+    uint8_t key_data[sizeof(uint64_t)] = {0};
+    if(!flipper_format_read_hex(flipper_format, "Key", key_data, sizeof(uint64_t))) {
+        FURI_LOG_D(TAG, "No Key");
+    }
+    for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
+        record->key = (record->key << 8) | key_data[i];
+    }
+
+    flipper_format_rewind(flipper_format);
+    if(flipper_format_read_uint32(flipper_format, "TE", &temp_data32, 1) &&
+       temp_data32 <= UINT16_MAX) {
+        record->te = temp_data32;
+    }
+
+    if(subghz_history_record_serialize(instance, record, instance->flipper_record) &&
+       subghz_history_stream_equal(
+           flipper_format_get_raw_stream(flipper_format),
+           flipper_format_get_raw_stream(instance->flipper_record))) {
+        return true;
+    }
+
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    size_t size = stream_size(stream);
+    if(size > UINT16_MAX) return false;
+
+    // Only RAM is touched here, subghz_history_flush moves blobs to the SD card
+    uint16_t blob_size = size;
+    if(!stream_seek(instance->blob_buffer, 0, StreamOffsetFromEnd) ||
+       stream_write(instance->blob_buffer, (const uint8_t*)&blob_size, sizeof(blob_size)) !=
+           sizeof(blob_size) ||
+       !stream_rewind(stream) || stream_copy(stream, instance->blob_buffer, size) != size) {
+        FURI_LOG_E(TAG, "Unable to save blob");
+        return false;
+    }
+    record->blob = instance->blob_total + 1;
+    instance->blob_total += sizeof(blob_size) + size;
+
+    return true;
+}
+
+static void
+    subghz_history_record_push(SubGhzHistory* instance, const SubGhzHistoryRecord* record) {
+    const uint16_t idx = instance->last_index_write;
+    instance->records[idx % SUBGHZ_HISTORY_RAM_RECORDS] = *record;
+    instance->last_index_write++;
 }
 
 bool subghz_history_add_to_history(
@@ -149,7 +572,6 @@ bool subghz_history_add_to_history(
     furi_assert(context);
 
     if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
-    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
 
     SubGhzProtocolDecoderBase* decoder_base = context;
     if((instance->code_last_hash_data ==
@@ -159,82 +581,40 @@ bool subghz_history_add_to_history(
         return false;
     }
 
-    instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
-    instance->last_update_timestamp = furi_get_tick();
-
-    FuriString* text;
-    text = furi_string_alloc();
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
-    item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
-
-    item->item_str = furi_string_alloc();
-    item->flipper_string = flipper_format_string_alloc();
-    subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
+    furi_mutex_acquire(instance->mutex, FuriWaitForever);
 
+    bool result = false;
     do {
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
-            break;
+        if(!instance->records) {
+            instance->records = malloc(SUBGHZ_HISTORY_RAM_RECORDS * sizeof(SubGhzHistoryRecord));
         }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-            FURI_LOG_E(TAG, "Missing Protocol");
+        if(instance->last_index_write >= subghz_history_get_capacity(instance)) break;
+        // Oldest records are still waiting for subghz_history_flush
+        if(instance->last_index_write - instance->spilled >= SUBGHZ_HISTORY_RAM_RECORDS) break;
+
+        instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
+        instance->last_update_timestamp = furi_get_tick();
+
+        SubGhzHistoryRecord record = {
+            .timestamp = furi_hal_rtc_get_timestamp(),
+            .blob = SUBGHZ_HISTORY_BLOB_NONE,
+        };
+        if(!subghz_history_find_protocol(decoder_base->protocol, &record.protocol)) {
+            FURI_LOG_E(TAG, "Unknown protocol");
             break;
         }
-        if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
-            furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
-                break;
-            }
-            furi_string_cat(instance->tmp_string, text);
-        } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
-            furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
-                FURI_LOG_E(TAG, "Missing Protocol");
-                break;
-            }
-            furi_string_cat(instance->tmp_string, text);
-        }
-        if(!flipper_format_rewind(item->flipper_string)) {
-            FURI_LOG_E(TAG, "Rewind error");
+        if(!subghz_history_find_preset(instance, preset, &record.preset)) {
+            FURI_LOG_E(TAG, "Too many presets");
             break;
         }
-        uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
-            FURI_LOG_D(TAG, "No Key");
-        }
-        uint64_t data = 0;
-        for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
-            data = (data << 8) | key_data[i];
-        }
-        if(data != 0) {
-            if(!(uint32_t)(data >> 32)) {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            } else {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX%08lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data >> 32),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            }
-        } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
-        }
 
+        subghz_protocol_decoder_base_serialize(decoder_base, instance->flipper_add, preset);
+        if(!subghz_history_record_fill(instance, &record)) break;
+
+        subghz_history_record_push(instance, &record);
+        result = true;
     } while(false);
 
-    furi_string_free(text);
-    instance->last_index_write++;
-    return true;
+    furi_mutex_release(instance->mutex);
+    return result;
 }
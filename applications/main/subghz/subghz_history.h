@@ -7,6 +7,13 @@
 #include <lib/flipper_format/flipper_format.h>
 #include <lib/subghz/types.h>
 
+/** History of received signals
+ * 
+ * Signals are kept as compact records, newest ones in RAM and older ones
+ * spilled to the SD card by subghz_history_flush when it is present. Data
+ * that protocol doesn't share through generic fields is kept serialized
+ * next to the records.
+ */
 typedef struct SubGhzHistory SubGhzHistory;
 
 /** Allocate SubGhzHistory
@@ -96,10 +103,23 @@ bool subghz_history_add_to_history(
     void* context,
     SubGhzRadioPreset* preset);
 
+/** Write records and data received so far to the SD card
+ * 
+ * Receiving only fills RAM buffers, this must be called periodically from
+ * the scene thread to spill them. Until then, history is limited by the
+ * RAM buffer size.
+ * 
+ * @param instance  - SubGhzHistory instance
+ */
+void subghz_history_flush(SubGhzHistory* instance);
+
 /** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
+ * 
+ * Data is restored from the compact record on every call, returned instance
+ * is shared and stays valid until the next call.
  * 
  * @param instance  - SubGhzHistory instance
  * @param idx       - record index
- * @return SubGhzProtocolCommonLoad*
+ * @return SubGhzProtocolCommonLoad*, NULL if the record can't be read
  */
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx);
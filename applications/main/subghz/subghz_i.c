@@ -99,9 +99,11 @@ bool subghz_key_load(SubGhz* subghz, const char* file_path, bool show_dialog) {
             break;
         }
 
-        if(((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_KEY_FILE_TYPE)) ||
-            (!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE))) &&
-           temp_data32 == SUBGHZ_KEY_FILE_VERSION) {
+        if(((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_KEY_FILE_TYPE)) &&
+            temp_data32 == SUBGHZ_KEY_FILE_VERSION) ||
+           ((!strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE)) &&
+            (temp_data32 == SUBGHZ_RAW_FILE_VERSION ||
+             temp_data32 == SUBGHZ_RAW_FILE_VERSION_BINARY))) {
         } else {
             FURI_LOG_E(TAG, "Type or version mismatch");
             break;
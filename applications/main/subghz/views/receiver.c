@@ -4,7 +4,6 @@
 #include <input/input.h>
 #include <gui/elements.h>
 #include <assets_icons.h>
-#include <m-array.h>
 
 #define FRAME_HEIGHT 12
 #define MAX_LEN_PX   111
@@ -13,22 +12,14 @@
 
 #define SUBGHZ_RAW_THRESHOLD_MIN -90.0f
 
+/** Menu items are cached by index modulo MENU_ITEMS, so scrolling fetches one item at a time */
 typedef struct {
     FuriString* item_str;
+    uint16_t idx;
     uint8_t type;
+    bool valid;
 } SubGhzReceiverMenuItem;
 
-ARRAY_DEF(SubGhzReceiverMenuItemArray, SubGhzReceiverMenuItem, M_POD_OPLIST)
-
-#define M_OPL_SubGhzReceiverMenuItemArray_t() \
-    ARRAY_OPLIST(SubGhzReceiverMenuItemArray, M_POD_OPLIST)
-
-struct SubGhzReceiverHistory {
-    SubGhzReceiverMenuItemArray_t data;
-};
-
-typedef struct SubGhzReceiverHistory SubGhzReceiverHistory;
-
 static const Icon* ReceiverItemIcons[] = {
     [SubGhzProtocolTypeUnknown] = &I_Quest_7x8,
     [SubGhzProtocolTypeStatic] = &I_Unlock_7x8,
@@ -55,7 +46,9 @@ typedef struct {
     FuriString* frequency_str;
     FuriString* preset_str;
     FuriString* history_stat_str;
-    SubGhzReceiverHistory* history;
+    SubGhzReceiverMenuItem items[MENU_ITEMS];
+    SubGhzViewReceiverItemCallback item_callback;
+    void* item_context;
     uint16_t idx;
     uint16_t list_offset;
     uint16_t history_item;
@@ -110,6 +103,58 @@ void subghz_view_receiver_set_callback(
     subghz_receiver->context = context;
 }
 
+/* Item text may be read from SD card, fetch it here and not on draw with the model locked */
+static void subghz_view_receiver_fetch_items(SubGhzViewReceiver* subghz_receiver) {
+    SubGhzViewReceiverItemCallback item_callback = NULL;
+    void* item_context = NULL;
+    uint16_t list_offset = 0;
+    uint16_t count = 0;
+
+    with_view_model(
+        subghz_receiver->view,
+        SubGhzViewReceiverModel * model,
+        {
+            item_callback = model->item_callback;
+            item_context = model->item_context;
+            list_offset = model->list_offset;
+            count = MIN(model->history_item, MENU_ITEMS);
+        },
+        false);
+    if(!item_callback) return;
+
+    FuriString* item_str = furi_string_alloc();
+    for(uint16_t i = 0; i < count; ++i) {
+        const uint16_t idx = list_offset + i;
+        bool cached = false;
+        with_view_model(
+            subghz_receiver->view,
+            SubGhzViewReceiverModel * model,
+            {
+                const SubGhzReceiverMenuItem* item_menu = &model->items[idx % MENU_ITEMS];
+                cached = item_menu->valid && item_menu->idx == idx;
+            },
+            false);
+        if(cached) continue;
+
+        uint8_t type = SubGhzProtocolTypeUnknown;
+        furi_string_reset(item_str);
+        item_callback(item_context, idx, item_str, &type);
+
+        with_view_model(
+            subghz_receiver->view,
+            SubGhzViewReceiverModel * model,
+            {
+                SubGhzReceiverMenuItem* item_menu = &model->items[idx % MENU_ITEMS];
+                furi_string_set(item_menu->item_str, item_str);
+                item_menu->type = type;
+                item_menu->idx = idx;
+                item_menu->valid = true;
+            },
+            true);
+    }
+    furi_string_free(item_str);
+}
+
 static void subghz_view_receiver_update_offset(SubGhzViewReceiver* subghz_receiver) {
     furi_assert(subghz_receiver);
 
@@ -130,21 +175,35 @@ static void subghz_view_receiver_update_offset(SubGhzViewReceiver* subghz_receiv
             }
         },
         true);
+    subghz_view_receiver_fetch_items(subghz_receiver);
 }
 
-void subghz_view_receiver_add_item_to_menu(
+void subghz_view_receiver_set_item_callback(
     SubGhzViewReceiver* subghz_receiver,
-    const char* name,
-    uint8_t type) {
+    SubGhzViewReceiverItemCallback callback,
+    void* context) {
+    furi_assert(subghz_receiver);
+    furi_assert(callback);
+    with_view_model(
+        subghz_receiver->view,
+        SubGhzViewReceiverModel * model,
+        {
+            model->item_callback = callback;
+            model->item_context = context;
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                model->items[i].valid = false;
+            }
+        },
+        true);
+    subghz_view_receiver_fetch_items(subghz_receiver);
+}
+
+void subghz_view_receiver_add_item_to_menu(SubGhzViewReceiver* subghz_receiver) {
     furi_assert(subghz_receiver);
     with_view_model(
         subghz_receiver->view,
         SubGhzViewReceiverModel * model,
         {
-            SubGhzReceiverMenuItem* item_menu =
-                SubGhzReceiverMenuItemArray_push_raw(model->history->data);
-            item_menu->item_str = furi_string_alloc_set(name);
-            item_menu->type = type;
             if(model->idx == model->history_item - 1) {
                 model->history_item++;
                 model->idx++;
@@ -156,6 +215,19 @@ void subghz_view_receiver_add_item_to_menu(
     subghz_view_receiver_update_offset(subghz_receiver);
 }
 
+void subghz_view_receiver_set_item_count(SubGhzViewReceiver* subghz_receiver, uint16_t count) {
+    furi_assert(subghz_receiver);
+    with_view_model(
+        subghz_receiver->view,
+        SubGhzViewReceiverModel * model,
+        {
+            model->history_item = count;
+            model->idx = count ? count - 1 : 0;
+        },
+        true);
+    subghz_view_receiver_update_offset(subghz_receiver);
+}
+
 void subghz_view_receiver_add_data_statusbar(
     SubGhzViewReceiver* subghz_receiver,
     const char* frequency_str,
@@ -223,7 +295,9 @@ void subghz_view_receiver_draw(Canvas* canvas, SubGhzViewReceiverModel* model) {
 
     for(size_t i = 0; i < MIN(model->history_item, MENU_ITEMS); ++i) {
         size_t idx = CLAMP((uint16_t)(i + model->list_offset), model->history_item, 0);
-        item_menu = SubGhzReceiverMenuItemArray_get(model->history->data, idx);
+        item_menu = &model->items[idx % MENU_ITEMS];
+        // Not fetched yet, drawn on the next update
+        if(!item_menu->valid || item_menu->idx != idx) continue;
         furi_string_set(str_buff, item_menu->item_str);
         elements_string_fit_width(canvas, str_buff, scrollbar ? MAX_LEN_PX - 7 : MAX_LEN_PX);
         if(model->idx == idx) {
@@ -392,15 +466,12 @@ void subghz_view_receiver_exit(void* context) {
             furi_string_reset(model->frequency_str);
             furi_string_reset(model->preset_str);
             furi_string_reset(model->history_stat_str);
-                for
-                    M_EACH(item_menu, model->history->data, SubGhzReceiverMenuItemArray_t) {
-                        furi_string_free(item_menu->item_str);
-                        item_menu->type = 0;
-                    }
-                SubGhzReceiverMenuItemArray_reset(model->history->data);
-                model->idx = 0;
-                model->list_offset = 0;
-                model->history_item = 0;
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                model->items[i].valid = false;
+            }
+            model->idx = 0;
+            model->list_offset = 0;
+            model->history_item = 0;
         },
         false);
     furi_timer_stop(subghz_receiver->timer);
@@ -430,8 +501,9 @@ SubGhzViewReceiver* subghz_view_receiver_alloc(void) {
             model->preset_str = furi_string_alloc();
             model->history_stat_str = furi_string_alloc();
             model->bar_show = SubGhzViewReceiverBarShowDefault;
-            model->history = malloc(sizeof(SubGhzReceiverHistory));
-            SubGhzReceiverMenuItemArray_init(model->history->data);
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                model->items[i].item_str = furi_string_alloc();
+            }
         },
         true);
     subghz_receiver->timer =
@@ -449,13 +521,9 @@ void subghz_view_receiver_free(SubGhzViewReceiver* subghz_receiver) {
             furi_string_free(model->frequency_str);
             furi_string_free(model->preset_str);
             furi_string_free(model->history_stat_str);
-                for
-                    M_EACH(item_menu, model->history->data, SubGhzReceiverMenuItemArray_t) {
-                        furi_string_free(item_menu->item_str);
-                        item_menu->type = 0;
-                    }
-                SubGhzReceiverMenuItemArray_clear(model->history->data);
-                free(model->history);
+            for(size_t i = 0; i < MENU_ITEMS; ++i) {
+                furi_string_free(model->items[i].item_str);
+            }
         },
         false);
     furi_timer_free(subghz_receiver->timer);
@@ -8,6 +8,14 @@ typedef struct SubGhzViewReceiver SubGhzViewReceiver;
 
 typedef void (*SubGhzViewReceiverCallback)(SubGhzCustomEvent event, void* context);
 
+/** Fill menu item text and protocol type of a visible item that is not cached yet.
+ * Called from the thread that updates the view, never from draw. */
+typedef void (*SubGhzViewReceiverItemCallback)(
+    void* context,
+    uint16_t idx,
+    FuriString* output,
+    uint8_t* type);
+
 void subghz_receiver_rssi(SubGhzViewReceiver* instance, float rssi);
 
 void subghz_view_receiver_set_lock(SubGhzViewReceiver* subghz_receiver, bool keyboard);
@@ -33,10 +41,14 @@ void subghz_view_receiver_set_radio_device_type(
     SubGhzViewReceiver* subghz_receiver,
     SubGhzRadioDeviceType device_type);
 
-void subghz_view_receiver_add_item_to_menu(
+void subghz_view_receiver_set_item_callback(
     SubGhzViewReceiver* subghz_receiver,
-    const char* name,
-    uint8_t type);
+    SubGhzViewReceiverItemCallback callback,
+    void* context);
+
+void subghz_view_receiver_add_item_to_menu(SubGhzViewReceiver* subghz_receiver);
+
+void subghz_view_receiver_set_item_count(SubGhzViewReceiver* subghz_receiver, uint16_t count);
 
 uint16_t subghz_view_receiver_get_idx_menu(SubGhzViewReceiver* subghz_receiver);
 
@@ -191,24 +191,43 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
             "<log debug> — debug information including <log info> (may impact system performance)\r\n");
         printf(
             "<log trace> — system traces including <log debug> (may impact system performance)\r\n");
+        printf("<log [level] deferred> — format messages in background, keeps callers fast\r\n");
+        printf("<log [level] binary> — binary records, decode with scripts/log_decode.py\r\n");
     }
     return false;
 }
 
+static bool cli_command_log_mode_from_string(FuriString* mode, FuriLogMode* log_mode) {
+    if(furi_string_cmp_str(mode, "deferred") == 0) {
+        *log_mode = FuriLogModeDeferred;
+    } else if(furi_string_cmp_str(mode, "binary") == 0) {
+        *log_mode = FuriLogModeBinary;
+    } else {
+        return false;
+    }
+    return true;
+}
+
 void cli_command_log(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriStreamBuffer* ring = furi_stream_buffer_alloc(CLI_COMMAND_LOG_RING_SIZE, 1);
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
     bool restore_log_level = false;
-
-    if(furi_string_size(args) > 0) {
-        if(!cli_command_log_level_set_from_string(args)) {
+    FuriLogMode log_mode = FuriLogModeImmediate;
+
+    FuriString* arg = furi_string_alloc();
+    while(args_read_string_and_trim(args, arg)) {
+        if(cli_command_log_mode_from_string(arg, &log_mode)) continue;
+        if(!cli_command_log_level_set_from_string(arg)) {
+            if(restore_log_level) furi_log_set_level(previous_level);
+            furi_string_free(arg);
             furi_stream_buffer_free(ring);
             return;
         }
         restore_log_level = true;
     }
+    furi_string_free(arg);
 
     const char* current_level;
     furi_log_level_to_string(furi_log_get_level(), &current_level);
@@ -220,6 +239,7 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     };
 
     furi_log_add_handler(log_handler);
+    furi_log_set_mode(log_mode);
 
     printf("Use <log ?> to list available log levels\r\n");
     printf("Press CTRL+C to stop...\r\n");
@@ -228,6 +248,7 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
         cli_write(cli, buffer, ret);
     }
 
+    furi_log_set_mode(FuriLogModeImmediate);
     furi_log_remove_handler(log_handler);
 
     if(restore_log_level) {
@@ -464,12 +485,80 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
 }
 
+static void cli_command_free_blocks_sites(void) {
+    MemmgrHeapSitesSnapshot* snapshot = malloc(sizeof(MemmgrHeapSitesSnapshot));
+    memmgr_heap_get_sites_snapshot(snapshot);
+
+    printf("Site trace: %s\r\n", snapshot->enabled ? "on" : "off");
+    printf(
+        "Free heap: %lu, max block: %lu, fragmentation: %lu.%lu%%\r\n",
+        snapshot->free_heap,
+        snapshot->max_free_block,
+        snapshot->fragmentation / 10,
+        snapshot->fragmentation % 10);
+
+    printf("\r\nLive blocks by size:\r\n");
+    for(size_t i = 0; i < MEMMGR_HEAP_HISTOGRAM_BUCKETS; i++) {
+        if(i == MEMMGR_HEAP_HISTOGRAM_BUCKETS - 1) {
+            printf("  >%-7u %lu\r\n", 16U << (i - 1), snapshot->histogram[i]);
+        } else {
+            printf("  <=%-6u %lu\r\n", 16U << i, snapshot->histogram[i]);
+        }
+    }
+
+    printf("\r\n%-12s %10s %8s\r\n", "Site", "Bytes", "Blocks");
+    for(size_t i = 0; i < snapshot->sites_count; i++) {
+        const MemmgrHeapSite* site = &snapshot->sites[i];
+        if(site->address) {
+            printf("0x%08lx   %10lu %8lu\r\n", site->address, site->live_bytes, site->live_blocks);
+        } else {
+            printf("%-12s %10lu %8lu\r\n", "other", site->live_bytes, site->live_blocks);
+        }
+    }
+
+    printf("\r\n%-10s %10s %10s\r\n", "Tick", "Free", "Max block");
+    for(size_t i = 0; i < snapshot->samples_count; i++) {
+        const MemmgrHeapSample* sample = &snapshot->samples[i];
+        printf("%-10lu %10lu %10lu\r\n", sample->tick, sample->free_heap, sample->max_free_block);
+    }
+
+    free(snapshot);
+}
+
 void cli_command_free_blocks(Cli* cli, FuriString* args, void* context) {
     UNUSED(cli);
-    UNUSED(args);
     UNUSED(context);
 
-    memmgr_heap_printf_free_blocks();
+    if(furi_string_empty(args)) {
+        memmgr_heap_printf_free_blocks();
+        return;
+    }
+
+    FuriString* arg = furi_string_alloc();
+    bool valid = false;
+    do {
+        if(!args_read_string_and_trim(args, arg) || furi_string_cmp_str(arg, "--sites") != 0) {
+            break;
+        }
+
+        if(!args_read_string_and_trim(args, arg)) {
+            cli_command_free_blocks_sites();
+        } else if(furi_string_cmp_str(arg, "on") == 0) {
+            memmgr_heap_enable_site_trace();
+        } else if(furi_string_cmp_str(arg, "off") == 0) {
+            memmgr_heap_disable_site_trace();
+        } else {
+            break;
+        }
+
+        valid = true;
+    } while(false);
+
+    if(!valid) {
+        cli_print_usage("free_blocks", "[--sites [on|off]]", furi_string_get_cstr(arg));
+    }
+
+    furi_string_free(arg);
 }
 
 void cli_command_i2c(Cli* cli, FuriString* args, void* context) {
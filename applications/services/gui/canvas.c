@@ -4,6 +4,8 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
 #include <u8g2_glue.h>
 
 const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
@@ -16,6 +18,8 @@ const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
 Canvas* canvas_init(void) {
     Canvas* canvas = malloc(sizeof(Canvas));
     canvas->compress_icon = compress_icon_alloc(ICON_DECOMPRESSOR_BUFFER_SIZE);
+    // Menus and animations draw the same frames over and over
+    compress_icon_set_cache_size(canvas->compress_icon, ICON_CACHE_SIZE);
 
     // Initialize mutex
     canvas->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
@@ -31,6 +35,10 @@ Canvas* canvas_init(void) {
     // Wake up display
     u8g2_SetPowerSave(&canvas->fb, 0);
 
+    // Display RAM content is unknown
+    canvas->committed = malloc(canvas_get_buffer_size(canvas));
+    canvas->invalidated = true;
+
     // Clear buffer and send to device
     canvas_clear(canvas);
     canvas_commit(canvas);
@@ -43,6 +51,7 @@ void canvas_free(Canvas* canvas) {
     compress_icon_free(canvas->compress_icon);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
+    free(canvas->committed);
     free(canvas);
 }
 
@@ -66,9 +75,63 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+// Compare the buffer with the committed frame block by block, remember what changed
+static bool canvas_update_dirty_map(Canvas* canvas) {
+    const uint8_t* buffer = u8g2_GetBufferPtr(&canvas->fb);
+    const size_t page_size = u8g2_GetBufferTileWidth(&canvas->fb) * 8;
+    const size_t page_count = u8g2_GetBufferTileHeight(&canvas->fb);
+    furi_assert(page_count <= CANVAS_DIRTY_MAP_PAGES);
+
+    bool dirty = false;
+
+    for(size_t page = 0; page < page_count; page++) {
+        const uint8_t* src = &buffer[page * page_size];
+        uint8_t* dst = &canvas->committed[page * page_size];
+        uint16_t tiles = 0;
+
+        if(canvas->invalidated) {
+            tiles = UINT16_MAX;
+        } else if(memcmp(src, dst, page_size) != 0) {
+            for(size_t tile = 0; tile < page_size / 8; tile++) {
+                if(memcmp(&src[tile * 8], &dst[tile * 8], 8) != 0) {
+                    tiles |= 1U << tile;
+                }
+            }
+        }
+
+        if(tiles) {
+            memcpy(dst, src, page_size);
+            dirty = true;
+        }
+
+        canvas->dirty.pages[page] = tiles;
+    }
+
+    canvas->invalidated = false;
+
+    return dirty;
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+
+    if(!canvas_update_dirty_map(canvas) &&
+       canvas->committed_orientation == canvas_get_orientation(canvas)) {
+        // Nothing to send, static screens cost only the comparison
+        return;
+    }
+
+    // Only the span between the first and the last changed block of each page is sent
+    for(size_t page = 0; page < CANVAS_DIRTY_MAP_PAGES; page++) {
+        const uint16_t tiles = canvas->dirty.pages[page];
+        if(!tiles) continue;
+
+        const uint8_t first = __builtin_ctz(tiles);
+        const uint8_t last = 31 - __builtin_clz(tiles);
+        u8g2_UpdateDisplayArea(&canvas->fb, first, page, last - first + 1, 1);
+    }
+
+    canvas->committed_orientation = canvas_get_orientation(canvas);
 
     // Iterate over callbacks
     canvas_lock(canvas);
@@ -83,6 +146,16 @@ void canvas_commit(Canvas* canvas) {
     canvas_unlock(canvas);
 }
 
+const CanvasDirtyMap* canvas_get_dirty_map(const Canvas* canvas) {
+    furi_check(canvas);
+    return &canvas->dirty;
+}
+
+void canvas_invalidate(Canvas* canvas) {
+    furi_check(canvas);
+    canvas->invalidated = true;
+}
+
 uint8_t* canvas_get_buffer(Canvas* canvas) {
     furi_check(canvas);
     return u8g2_GetBufferPtr(&canvas->fb);
@@ -348,6 +421,260 @@ static void canvas_draw_u8g2_bitmap_int(
     }
 }
 
+/* Fast path limits, coordinates stay clear of u8g2_uint_t wrap around */
+#define CANVAS_BITMAP_SIZE_MAX     (0x1000)
+#define CANVAS_BITMAP_POSITION_MAX (0x4000)
+
+typedef struct {
+    uint8_t* buffer;
+    size_t stride;
+    bool opaque;
+    uint8_t fg_or;
+    uint8_t fg_xor;
+    uint8_t bg_or;
+    uint8_t bg_xor;
+} CanvasBitmapBlit;
+
+static inline uint8_t canvas_bitmap_reverse(uint8_t bits) {
+    bits = (uint8_t)((bits & 0xF0) >> 4 | (bits & 0x0F) << 4);
+    bits = (uint8_t)((bits & 0xCC) >> 2 | (bits & 0x33) << 2);
+    bits = (uint8_t)((bits & 0xAA) >> 1 | (bits & 0x55) << 1);
+    return bits;
+}
+
+/* 8 bits of a XBM row starting at pixel i, not aligned to bytes */
+static inline uint8_t canvas_bitmap_get_bits(const uint8_t* row, size_t row_size, size_t i) {
+    const size_t byte = i >> 3;
+    const size_t shift = i & 7;
+    uint32_t bits = row[byte] >> shift;
+    if(shift && (byte + 1 < row_size)) {
+        bits |= (uint32_t)row[byte + 1] << (8 - shift);
+    }
+    return (uint8_t)bits;
+}
+
+/* 8x8 bit matrix transpose: bit c of rows[b] becomes bit b of columns[c] */
+static inline void canvas_bitmap_transpose(const uint8_t rows[8], uint8_t columns[8]) {
+    uint64_t m = 0;
+    for(size_t b = 0; b < 8; b++) {
+        m |= (uint64_t)rows[b] << (b * 8);
+    }
+
+    uint64_t t;
+    t = (m ^ (m >> 7)) & 0x00AA00AA00AA00AAULL;
+    m = m ^ t ^ (t << 7);
+    t = (m ^ (m >> 14)) & 0x0000CCCC0000CCCCULL;
+    m = m ^ t ^ (t << 14);
+    t = (m ^ (m >> 28)) & 0x00000000F0F0F0F0ULL;
+    m = m ^ t ^ (t << 28);
+
+    for(size_t c = 0; c < 8; c++) {
+        columns[c] = (uint8_t)(m >> (c * 8));
+    }
+}
+
+static inline void canvas_bitmap_blit_byte(
+    const CanvasBitmapBlit* blit,
+    uint8_t* byte,
+    uint8_t fg,
+    uint8_t bg) {
+    // Same per pixel operations as u8g2_ll_hvline_vertical_top_lsb, bits don't overlap
+    *byte = (*byte | (fg & blit->fg_or) | (bg & blit->bg_or)) ^
+            ((fg & blit->fg_xor) | (bg & blit->bg_xor));
+}
+
+/* Draw 8 vertical pixels, bit 0 at buffer row y. Pixels outside of valid are not touched. */
+static inline void canvas_bitmap_blit_column(
+    const CanvasBitmapBlit* blit,
+    int32_t x,
+    int32_t y,
+    uint8_t bits,
+    uint8_t valid) {
+    const uint32_t shift = y & 7;
+    const int32_t page = y >> 3;
+    const uint32_t fg = (uint32_t)(bits & valid) << shift;
+    const uint32_t bg = blit->opaque ? (uint32_t)(~bits & valid) << shift : 0;
+
+    // Only pages with valid pixels are accessed, they are within the buffer after clipping
+    if((fg | bg) & 0xFF) {
+        canvas_bitmap_blit_byte(blit, &blit->buffer[page * blit->stride + x], fg, bg);
+    }
+    if((fg | bg) >> 8) {
+        canvas_bitmap_blit_byte(
+            blit, &blit->buffer[(page + 1) * blit->stride + x], fg >> 8, bg >> 8);
+    }
+}
+
+/* Range of t in [0, n) that puts origin + step * t into [lo, hi), step is 1 or -1 */
+static bool canvas_bitmap_clip(
+    int32_t origin,
+    int32_t step,
+    int32_t lo,
+    int32_t hi,
+    int32_t n,
+    int32_t* t0,
+    int32_t* t1) {
+    if(step > 0) {
+        *t0 = MAX(0, lo - origin);
+        *t1 = MIN(n, hi - origin);
+    } else {
+        *t0 = MAX(0, origin - hi + 1);
+        *t1 = MIN(n, origin - lo + 1);
+    }
+    return *t0 < *t1;
+}
+
+/* Display rotation, same transformation as u8g2_draw_l90_rX for a single pixel */
+static void canvas_bitmap_map(u8g2_t* u8g2, int32_t* x, int32_t* y, bool vector) {
+    const int32_t lx = *x;
+    const int32_t ly = *y;
+    const int32_t w = vector ? 0 : u8g2->width - 1;
+    const int32_t h = vector ? 0 : u8g2->height - 1;
+
+    if(u8g2->cb == &u8g2_cb_r1) {
+        *x = h - ly;
+        *y = lx;
+    } else if(u8g2->cb == &u8g2_cb_r2) {
+        *x = w - lx;
+        *y = h - ly;
+    } else if(u8g2->cb == &u8g2_cb_r3) {
+        *x = ly;
+        *y = w - lx;
+    }
+}
+
+/* Draws straight into the page buffer, one byte of 8 vertical pixels at a time.
+ * Produces the same pixels as canvas_draw_u8g2_bitmap_int, returns false if the
+ * buffer layout or arguments are not supported. */
+static bool canvas_draw_u8g2_bitmap_fast(
+    u8g2_t* u8g2,
+    int32_t x,
+    int32_t y,
+    size_t w,
+    size_t h,
+    bool mirror,
+    bool rotation,
+    const uint8_t* bitmap) {
+    if(u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb) return false;
+    if(u8g2->cb != &u8g2_cb_r0 && u8g2->cb != &u8g2_cb_r1 && u8g2->cb != &u8g2_cb_r2 &&
+       u8g2->cb != &u8g2_cb_r3) {
+        return false;
+    }
+
+    // Coordinates as seen by u8g2 after conversion to u8g2_uint_t
+    x = (int16_t)(u8g2_uint_t)x;
+    y = (int16_t)(u8g2_uint_t)y;
+    if(w > CANVAS_BITMAP_SIZE_MAX || h > CANVAS_BITMAP_SIZE_MAX) return false;
+    if(abs(x) > CANVAS_BITMAP_POSITION_MAX || abs(y) > CANVAS_BITMAP_POSITION_MAX) return false;
+
+    if(!u8g2->is_page_clip_window_intersection || !w || !h) return true;
+
+    // Position of source pixel (0, 0) and steps along source column i and row j
+    int32_t ox = x, oy = y;
+    int32_t ix = 1, iy = 0, jx = 0, jy = 1;
+    if(rotation && !mirror) {
+        ox = x + w + 1;
+        ix = 0, iy = 1, jx = -1, jy = 0;
+    } else if(mirror && !rotation) {
+        oy = y + h - 1;
+        jy = -1;
+    } else if(mirror && rotation) {
+        ix = 0, iy = 1, jx = 1, jy = 0;
+    }
+
+    // Clip against the user window, rotation keeps source rows and columns straight
+    int32_t i0 = 0, i1 = w, j0 = 0, j1 = h;
+    int32_t t0, t1;
+    if(!canvas_bitmap_clip(
+           ox, ix ? ix : jx, u8g2->user_x0, u8g2->user_x1, ix ? w : h, &t0, &t1)) {
+        return true;
+    }
+    if(ix) {
+        i0 = t0, i1 = t1;
+    } else {
+        j0 = t0, j1 = t1;
+    }
+    if(!canvas_bitmap_clip(
+           oy, iy ? iy : jy, u8g2->user_y0, u8g2->user_y1, iy ? w : h, &t0, &t1)) {
+        return true;
+    }
+    if(iy) {
+        i0 = t0, i1 = t1;
+    } else {
+        j0 = t0, j1 = t1;
+    }
+
+    // Move to buffer coordinates
+    int32_t bx = ox + ix * i0 + jx * j0;
+    int32_t by = oy + iy * i0 + jy * j0;
+    canvas_bitmap_map(u8g2, &bx, &by, false);
+    by -= u8g2->pixel_curr_row;
+    canvas_bitmap_map(u8g2, &ix, &iy, true);
+    canvas_bitmap_map(u8g2, &jx, &jy, true);
+
+    const uint8_t color = u8g2->draw_color;
+    const uint8_t ncolor = (color == 0 ? 1 : 0);
+    const CanvasBitmapBlit blit = {
+        .buffer = u8g2->tile_buf_ptr,
+        .stride = u8g2_GetU8x8(u8g2)->display_info->tile_width * 8,
+        .opaque = (u8g2->bitmap_transparency == 0),
+        .fg_or = (color <= 1) ? 0xFF : 0x00,
+        .fg_xor = (color != 1) ? 0xFF : 0x00,
+        .bg_or = (ncolor <= 1) ? 0xFF : 0x00,
+        .bg_xor = (ncolor != 1) ? 0xFF : 0x00,
+    };
+    const size_t row_size = (w + 7) / 8;
+
+    if(ix == 0) {
+        // Source rows are buffer columns, source bytes are vertical buffer bytes
+        for(int32_t j = j0; j < j1; j++) {
+            const uint8_t* row = &bitmap[j * row_size];
+            const int32_t column = bx + jx * (j - j0);
+            for(int32_t i = i0; i < i1; i += 8) {
+                const uint8_t valid = 0xFF >> (8 - MIN(8, i1 - i));
+                const uint8_t bits = canvas_bitmap_get_bits(row, row_size, i);
+                if(iy > 0) {
+                    canvas_bitmap_blit_column(&blit, column, by + (i - i0), bits, valid);
+                } else {
+                    canvas_bitmap_blit_column(
+                        &blit,
+                        column,
+                        by - (i - i0) - 7,
+                        canvas_bitmap_reverse(bits),
+                        canvas_bitmap_reverse(valid));
+                }
+            }
+        }
+    } else {
+        // Source rows are buffer rows, 8x8 blocks are transposed into vertical bytes
+        uint8_t rows[8];
+        uint8_t columns[8];
+        for(int32_t j = j0; j < j1; j += 8) {
+            const int32_t count = MIN(8, j1 - j);
+            const uint8_t valid = 0xFF >> (8 - count);
+            const int32_t top = (jy > 0) ? by + (j - j0) : by - (j - j0) - (count - 1);
+
+            for(int32_t i = i0; i < i1; i += 8) {
+                for(int32_t b = 0; b < 8; b++) {
+                    const int32_t r = (jy > 0) ? (j + b) : (j + count - 1 - b);
+                    rows[b] = (b < count) ?
+                                  canvas_bitmap_get_bits(&bitmap[r * row_size], row_size, i) :
+                                  0;
+                }
+                canvas_bitmap_transpose(rows, columns);
+
+                const int32_t column_count = MIN(8, i1 - i);
+                for(int32_t c = 0; c < column_count; c++) {
+                    canvas_bitmap_blit_column(
+                        &blit, bx + ix * (i + c - i0), top, columns[c], valid);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 void canvas_draw_u8g2_bitmap(
     u8g2_t* u8g2,
     int32_t x,
@@ -360,21 +687,27 @@ void canvas_draw_u8g2_bitmap(
     if(u8g2_IsIntersection(u8g2, x, y, x + width, y + height) == 0) return;
 #endif /* U8G2_WITH_INTERSECTION */
 
+    bool mirror = false;
+    bool rotate = false;
     switch(rotation) {
     case IconRotation0:
-        canvas_draw_u8g2_bitmap_int(u8g2, x, y, width, height, 0, 0, bitmap);
         break;
     case IconRotation90:
-        canvas_draw_u8g2_bitmap_int(u8g2, x, y, width, height, 0, 1, bitmap);
+        rotate = true;
         break;
     case IconRotation180:
-        canvas_draw_u8g2_bitmap_int(u8g2, x, y, width, height, 1, 0, bitmap);
+        mirror = true;
         break;
     case IconRotation270:
-        canvas_draw_u8g2_bitmap_int(u8g2, x, y, width, height, 1, 1, bitmap);
+        mirror = true;
+        rotate = true;
         break;
     default:
-        break;
+        return;
+    }
+
+    if(!canvas_draw_u8g2_bitmap_fast(u8g2, x, y, width, height, mirror, rotate, bitmap)) {
+        canvas_draw_u8g2_bitmap_int(u8g2, x, y, width, height, mirror, rotate, bitmap);
     }
 }
 
@@ -576,6 +909,8 @@ void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callba
     canvas_lock(canvas);
     furi_check(!CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(canvas->canvas_callback_pair, p);
+    // New callback needs a complete frame
+    canvas_invalidate(canvas);
     canvas_unlock(canvas);
 }
 
@@ -81,6 +81,18 @@ typedef enum {
     IconRotation270,
 } IconRotation;
 
+/** Number of 8 pixel high pages in the canvas dirty map */
+#define CANVAS_DIRTY_MAP_PAGES (8U)
+
+/** Canvas dirty map
+ *
+ * Bit N of a page is set if the 8x8 pixel block in column N of that page
+ * changed since the previous commit.
+ */
+typedef struct {
+    uint16_t pages[CANVAS_DIRTY_MAP_PAGES];
+} CanvasDirtyMap;
+
 /** Canvas anonymous structure */
 typedef struct Canvas Canvas;
 
@@ -90,7 +102,7 @@ typedef struct Canvas Canvas;
  */
 void canvas_reset(Canvas* canvas);
 
-/** Commit canvas. Send buffer to display
+/** Commit canvas. Send changed parts of the buffer to display
  *
  * @param      canvas  Canvas instance
  */
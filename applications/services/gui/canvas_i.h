@@ -13,6 +13,7 @@
 #include <furi.h>
 
 #define ICON_DECOMPRESSOR_BUFFER_SIZE (128u * 64 / 8)
+#define ICON_CACHE_SIZE               (8u * ICON_DECOMPRESSOR_BUFFER_SIZE)
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,11 @@ struct Canvas {
     CompressIcon* compress_icon;
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
+    // Frame last sent to the display and the difference of the current one
+    uint8_t* committed;
+    CanvasDirtyMap dirty;
+    CanvasOrientation committed_orientation;
+    bool invalidated;
 };
 
 /** Allocate memory and initialize canvas
@@ -126,6 +132,25 @@ void canvas_draw_u8g2_bitmap(
     const uint8_t* bitmap,
     IconRotation rotation);
 
+/** Get canvas dirty map of the last commit
+ *
+ * Valid inside commit callbacks.
+ *
+ * @param      canvas  Canvas instance
+ *
+ * @return     pointer to CanvasDirtyMap
+ */
+const CanvasDirtyMap* canvas_get_dirty_map(const Canvas* canvas);
+
+/** Make the next commit send the whole buffer to display and commit callbacks
+ *
+ * Must be called when the display RAM content could have been lost, or when a commit
+ * callback needs a complete frame.
+ *
+ * @param      canvas  Canvas instance
+ */
+void canvas_invalidate(Canvas* canvas);
+
 /** Add canvas commit callback.
  *
  * This callback will be called upon Canvas commit.
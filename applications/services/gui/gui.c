@@ -478,6 +478,13 @@ void gui_remove_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback,
     canvas_remove_framebuffer_callback(gui->canvas, callback, context);
 }
 
+void gui_get_framebuffer_dirty_map(const Gui* gui, CanvasDirtyMap* map) {
+    furi_check(gui);
+    furi_check(map);
+
+    *map = *canvas_get_dirty_map(gui->canvas);
+}
+
 size_t gui_get_framebuffer_size(const Gui* gui) {
     furi_check(gui);
 
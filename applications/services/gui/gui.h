@@ -93,6 +93,17 @@ void gui_add_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, vo
  */
 void gui_remove_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, void* context);
 
+/** Get gui canvas frame buffer dirty map
+ *
+ * Only valid inside GuiCanvasCommitCallback: tells which 8x8 pixel blocks
+ * changed since the previous commit. Commit callbacks are not called when
+ * nothing changed.
+ *
+ * @param      gui       Gui instance
+ * @param[out] map       CanvasDirtyMap to fill
+ */
+void gui_get_framebuffer_dirty_map(const Gui* gui, CanvasDirtyMap* map);
+
 /** Get gui canvas frame buffer size
  * *
  * @param      gui       Gui instance
@@ -12,32 +12,68 @@ static void input_cli_usage(void) {
     printf("\tsend <key> <type>\t - send input event\r\n");
 }
 
+#define INPUT_CLI_DUMP_QUEUE_SIZE    (8U)
+#define INPUT_CLI_DUMP_POLL_INTERVAL (100U)
+
+typedef struct {
+    FuriEventLoop* event_loop;
+    Cli* cli;
+} InputCliDump;
+
 static void input_cli_dump_events_callback(const void* value, void* ctx) {
     furi_assert(value);
-    furi_assert(ctx);
-    FuriMessageQueue* input_queue = ctx;
-    furi_message_queue_put(input_queue, value, FuriWaitForever);
+    UNUSED(ctx);
+    const InputEvent* input_event = value;
+
+    printf(
+        "key: %s type: %s\r\n",
+        input_get_key_name(input_event->key),
+        input_get_type_name(input_event->type));
+}
+
+static void input_cli_dump_poll_callback(void* ctx) {
+    InputCliDump* dump = ctx;
+    if(cli_cmd_interrupt_received(dump->cli)) {
+        furi_event_loop_stop(dump->event_loop);
+    }
 }
 
 static void input_cli_dump(Cli* cli, FuriString* args, FuriPubSub* event_pubsub) {
     UNUSED(args);
-    FuriMessageQueue* input_queue = furi_message_queue_alloc(8, sizeof(InputEvent));
-    FuriPubSubSubscription* input_subscription =
-        furi_pubsub_subscribe(event_pubsub, input_cli_dump_events_callback, input_queue);
+    InputCliDump dump = {
+        .event_loop = furi_event_loop_alloc(),
+        .cli = cli,
+    };
+
+    // Events are printed by this thread, a slow terminal does not hold up the input service
+    FuriPubSubSubscription* input_subscription = furi_pubsub_subscribe_queued(
+        event_pubsub,
+        dump.event_loop,
+        sizeof(InputEvent),
+        INPUT_CLI_DUMP_QUEUE_SIZE,
+        FuriPubSubQueuePolicyFifo,
+        input_cli_dump_events_callback,
+        NULL);
+
+    FuriEventLoopTimer* poll_timer = furi_event_loop_timer_alloc(
+        dump.event_loop, input_cli_dump_poll_callback, FuriEventLoopTimerTypePeriodic, &dump);
+    furi_event_loop_timer_start(poll_timer, furi_ms_to_ticks(INPUT_CLI_DUMP_POLL_INTERVAL));
 
-    InputEvent input_event;
     printf("Press CTRL+C to stop\r\n");
-    while(!cli_cmd_interrupt_received(cli)) {
-        if(furi_message_queue_get(input_queue, &input_event, 100) == FuriStatusOk) {
-            printf(
-                "key: %s type: %s\r\n",
-                input_get_key_name(input_event.key),
-                input_get_type_name(input_event.type));
-        }
-    }
+    furi_event_loop_run(dump.event_loop);
 
+    furi_event_loop_timer_free(poll_timer);
     furi_pubsub_unsubscribe(event_pubsub, input_subscription);
-    furi_message_queue_free(input_queue);
+
+    FuriPubSubStats stats;
+    furi_pubsub_get_stats(event_pubsub, &stats);
+    printf(
+        "Since boot: %lu events published, %lu dropped, max latency %lu ms\r\n",
+        stats.published,
+        stats.dropped,
+        stats.latency_max * 1000 / furi_kernel_get_tick_frequency());
+
+    furi_event_loop_free(dump.event_loop);
 }
 
 static void input_cli_send_print_usage(void) {
@@ -25,6 +25,9 @@ typedef enum {
 
 #define RPC_ALL_EVENTS (RpcEvtNewData | RpcEvtDisconnect)
 
+/* Encoded output is collected here and handed to the transport in chunks of this size */
+#define RPC_SEND_BUFFER_SIZE (512)
+
 DICT_DEF2(RpcHandlerDict, pb_size_t, M_DEFAULT_OPLIST, RpcHandler, M_POD_OPLIST)
 
 typedef struct {
@@ -83,6 +86,10 @@ struct RpcSession {
     RpcSessionTerminatedCallback terminated_callback;
     RpcOwner owner;
     void* context;
+
+    /* Guarded by callbacks_mutex */
+    uint8_t* send_buffer;
+    size_t send_buffer_used;
 };
 
 struct Rpc {
@@ -370,6 +377,7 @@ static void rpc_session_thread_pending_callback(void* context, uint32_t arg) {
     furi_mutex_free(session->callbacks_mutex);
     furi_thread_join(session->thread);
     furi_thread_free(session->thread);
+    free(session->send_buffer);
     free(session);
 }
 
@@ -385,6 +393,7 @@ RpcSession* rpc_session_open(Rpc* rpc, RpcOwner owner) {
     RpcSession* session = malloc(sizeof(RpcSession));
     session->callbacks_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     session->stream = furi_stream_buffer_alloc(RPC_BUFFER_SIZE, 1);
+    session->send_buffer = malloc(RPC_SEND_BUFFER_SIZE);
     session->rpc = rpc;
     session->terminate = false;
     session->decode_error = false;
@@ -446,36 +455,73 @@ void rpc_add_handler(RpcSession* session, pb_size_t message_tag, RpcHandler* han
     RpcHandlerDict_set_at(session->handlers, message_tag, *handler);
 }
 
+static void rpc_send_bytes(RpcSession* session, const uint8_t* buffer, size_t size) {
+#ifdef SRV_RPC_DEBUG
+    rpc_debug_print_data("OUTPUT", (uint8_t*)buffer, size);
+#endif
+
+    if(session->send_bytes_callback) {
+        session->send_bytes_callback(session->context, (uint8_t*)buffer, size);
+    }
+}
+
+static void rpc_send_buffer_flush(RpcSession* session) {
+    if(session->send_buffer_used) {
+        rpc_send_bytes(session, session->send_buffer, session->send_buffer_used);
+        session->send_buffer_used = 0;
+    }
+}
+
+static bool rpc_pb_ostream_callback(pb_ostream_t* stream, const pb_byte_t* buf, size_t count) {
+    RpcSession* session = stream->state;
+
+    if(count >= RPC_SEND_BUFFER_SIZE) {
+        // Large fields (file data, screen frames) go to the transport without a copy
+        rpc_send_buffer_flush(session);
+        rpc_send_bytes(session, buf, count);
+        return true;
+    }
+
+    while(count) {
+        size_t chunk = MIN(count, RPC_SEND_BUFFER_SIZE - session->send_buffer_used);
+        memcpy(&session->send_buffer[session->send_buffer_used], buf, chunk);
+        session->send_buffer_used += chunk;
+        buf += chunk;
+        count -= chunk;
+
+        if(session->send_buffer_used == RPC_SEND_BUFFER_SIZE) {
+            rpc_send_buffer_flush(session);
+        }
+    }
+
+    return true;
+}
+
 void rpc_send(RpcSession* session, PB_Main* message) {
     furi_assert(session);
     furi_assert(message);
 
-    pb_ostream_t ostream = PB_OSTREAM_SIZING;
-
 #ifdef SRV_RPC_DEBUG
     FURI_LOG_I(TAG, "OUTPUT:");
     rpc_debug_print_message(message);
 #endif
 
-    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
-    furi_check(result && ostream.bytes_written);
-
-    uint8_t* buffer = malloc(ostream.bytes_written);
-    ostream = pb_ostream_from_buffer(buffer, ostream.bytes_written);
+    pb_ostream_t ostream = {
+        .callback = rpc_pb_ostream_callback,
+        .state = session,
+        .max_size = SIZE_MAX,
+        .bytes_written = 0,
+    };
 
-    pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
 
-#ifdef SRV_RPC_DEBUG
-    rpc_debug_print_data("OUTPUT", buffer, ostream.bytes_written);
-#endif
+    // Message is encoded straight into the transport, no intermediate allocation
+    bool result = pb_encode_ex(&ostream, &PB_Main_msg, message, PB_ENCODE_DELIMITED);
+    rpc_send_buffer_flush(session);
 
-    furi_mutex_acquire(session->callbacks_mutex, FuriWaitForever);
-    if(session->send_bytes_callback) {
-        session->send_bytes_callback(session->context, buffer, ostream.bytes_written);
-    }
     furi_mutex_release(session->callbacks_mutex);
 
-    free(buffer);
+    furi_check(result && ostream.bytes_written);
 }
 
 void rpc_send_and_release(RpcSession* session, PB_Main* message) {
@@ -65,6 +65,18 @@ typedef struct {
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
 
+    // Latest committed frame, handed over from the GUI thread to the transmit thread.
+    // Frames are sent raw: the schema has no field to negotiate a compressed encoding.
+    FuriMutex* frame_mutex;
+    uint8_t* frame_pending;
+    CanvasOrientation frame_pending_orientation;
+    bool frame_pending_ready;
+    size_t frame_size;
+
+    uint32_t frames_sent;
+    uint32_t frames_dropped;
+    uint32_t bytes_sent;
+
     bool virtual_display_not_empty;
     bool is_streaming;
 
@@ -90,13 +102,17 @@ static void rpc_system_gui_screen_stream_frame_callback(
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
-
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
-
-    memcpy(buffer, data, size);
-    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
-        rpc_system_gui_screen_orientation_map[orientation];
+    furi_assert(size == rpc_gui->frame_size);
+
+    // Called on the GUI thread: only hand the frame over, a frame not sent yet is replaced
+    furi_check(furi_mutex_acquire(rpc_gui->frame_mutex, FuriWaitForever) == FuriStatusOk);
+    memcpy(rpc_gui->frame_pending, data, size);
+    rpc_gui->frame_pending_orientation = orientation;
+    if(rpc_gui->frame_pending_ready) {
+        rpc_gui->frames_dropped++;
+    }
+    rpc_gui->frame_pending_ready = true;
+    furi_check(furi_mutex_release(rpc_gui->frame_mutex) == FuriStatusOk);
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
@@ -112,14 +128,31 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
             furi_thread_flags_wait(RpcGuiWorkerFlagAny, FuriFlagWaitAny, FuriWaitForever);
 
         if(flags & RpcGuiWorkerFlagTransmit) {
-            transmit_time = furi_get_tick();
-            rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
-            transmit_time = furi_get_tick() - transmit_time;
-
-            // Guaranteed bandwidth reserve
-            uint32_t extra_delay = transmit_time / 20;
-            if(extra_delay > 500) extra_delay = 500;
-            if(extra_delay) furi_delay_tick(extra_delay);
+            furi_check(
+                furi_mutex_acquire(rpc_gui->frame_mutex, FuriWaitForever) == FuriStatusOk);
+            const bool ready = rpc_gui->frame_pending_ready;
+            memcpy(
+                rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes,
+                rpc_gui->frame_pending,
+                rpc_gui->frame_size);
+            rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
+                rpc_system_gui_screen_orientation_map[rpc_gui->frame_pending_orientation];
+            rpc_gui->frame_pending_ready = false;
+            furi_check(furi_mutex_release(rpc_gui->frame_mutex) == FuriStatusOk);
+
+            if(ready) {
+                transmit_time = furi_get_tick();
+                rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
+                transmit_time = furi_get_tick() - transmit_time;
+
+                rpc_gui->frames_sent++;
+                rpc_gui->bytes_sent += rpc_gui->frame_size;
+
+                // Guaranteed bandwidth reserve, frames committed meanwhile are coalesced
+                uint32_t extra_delay = transmit_time / 20;
+                if(extra_delay > 500) extra_delay = 500;
+                if(extra_delay) furi_delay_tick(extra_delay);
+            }
         }
 
         if(flags & RpcGuiWorkerFlagExit) {
@@ -130,6 +163,59 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
     return 0;
 }
 
+static void rpc_system_gui_screen_stream_start(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = true;
+    rpc_gui->frame_size = gui_get_framebuffer_size(rpc_gui->gui);
+    rpc_gui->frame_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    rpc_gui->frame_pending = malloc(rpc_gui->frame_size);
+    rpc_gui->frame_pending_ready = false;
+
+    rpc_gui->frames_sent = 0;
+    rpc_gui->frames_dropped = 0;
+    rpc_gui->bytes_sent = 0;
+
+    // Reusable Frame
+    rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
+    rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
+    rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
+    rpc_gui->transmit_frame->content.gui_screen_frame.data =
+        malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(rpc_gui->frame_size));
+    rpc_gui->transmit_frame->content.gui_screen_frame.data->size = rpc_gui->frame_size;
+    // Transmission thread for async TX
+    rpc_gui->transmit_thread = furi_thread_alloc_ex(
+        "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
+    furi_thread_start(rpc_gui->transmit_thread);
+    // GUI framebuffer callback
+    gui_add_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+}
+
+static void rpc_system_gui_screen_stream_stop(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = false;
+    // Remove GUI framebuffer callback
+    gui_remove_framebuffer_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+    // Stop and release worker thread
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
+    furi_thread_join(rpc_gui->transmit_thread);
+    furi_thread_free(rpc_gui->transmit_thread);
+
+    FURI_LOG_I(
+        TAG,
+        "Screen stream: %lu frames, %lu dropped, %lu bytes",
+        rpc_gui->frames_sent,
+        rpc_gui->frames_dropped,
+        rpc_gui->bytes_sent);
+
+    // Release frame
+    pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
+    free(rpc_gui->transmit_frame);
+    rpc_gui->transmit_frame = NULL;
+
+    free(rpc_gui->frame_pending);
+    furi_mutex_free(rpc_gui->frame_mutex);
+}
+
 static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -145,23 +231,7 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
             session, request->command_id, PB_CommandStatus_ERROR_VIRTUAL_DISPLAY_ALREADY_STARTED);
     } else {
         rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
-
-        rpc_gui->is_streaming = true;
-        size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
-        // Reusable Frame
-        rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
-        rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
-        rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
-        rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
-        rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
-        // Transmission thread for async TX
-        rpc_gui->transmit_thread = furi_thread_alloc_ex(
-            "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
-        furi_thread_start(rpc_gui->transmit_thread);
-        // GUI framebuffer callback
-        gui_add_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
+        rpc_system_gui_screen_stream_start(rpc_gui);
     }
 }
 
@@ -176,18 +246,7 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
     furi_assert(session);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
@@ -473,18 +532,7 @@ void rpc_system_gui_free(void* context) {
     }
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
     furi_record_close(RECORD_INPUT_EVENTS);
     furi_record_close(RECORD_GUI);
@@ -3,6 +3,8 @@
 #include <furi_hal_info.h>
 #include <furi_hal_power.h>
 #include <core/core_defines.h>
+#include <core/memmgr_heap.h>
+#include <toolbox/property.h>
 
 #include "rpc_i.h"
 
@@ -11,6 +13,7 @@
 #define PROPERTY_CATEGORY_DEVICE_INFO "devinfo"
 #define PROPERTY_CATEGORY_POWER_INFO  "pwrinfo"
 #define PROPERTY_CATEGORY_POWER_DEBUG "pwrdebug"
+#define PROPERTY_CATEGORY_HEAP_INFO   "heapinfo"
 
 typedef struct {
     RpcSession* session;
@@ -41,6 +44,56 @@ static void
     }
 }
 
+static void rpc_system_property_heap_info_get(PropertyValueCallback out, void* context) {
+    MemmgrHeapSitesSnapshot* snapshot = malloc(sizeof(MemmgrHeapSitesSnapshot));
+    memmgr_heap_get_sites_snapshot(snapshot);
+
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+    PropertyValueContext property_context = {
+        .key = key, .value = value, .out = out, .sep = '.', .last = false, .context = context};
+    char index[8];
+
+    property_value_out(
+        &property_context, NULL, 2, "trace", "enabled", snapshot->enabled ? "1" : "0");
+    property_value_out(&property_context, "%lu", 2, "heap", "free", snapshot->free_heap);
+    property_value_out(&property_context, "%lu", 2, "heap", "max_block", snapshot->max_free_block);
+    property_value_out(
+        &property_context, "%lu", 2, "heap", "fragmentation", snapshot->fragmentation);
+
+    // Bucket n holds blocks up to 16 << n bytes, the last one everything bigger
+    for(size_t i = 0; i < MEMMGR_HEAP_HISTOGRAM_BUCKETS; i++) {
+        snprintf(index, sizeof(index), "%zu", i);
+        property_value_out(
+            &property_context, "%lu", 2, "histogram", index, snapshot->histogram[i]);
+    }
+
+    for(size_t i = 0; i < snapshot->sites_count; i++) {
+        const MemmgrHeapSite* site = &snapshot->sites[i];
+        snprintf(index, sizeof(index), "%zu", i);
+        property_value_out(
+            &property_context, "0x%08lx", 3, "site", index, "address", site->address);
+        property_value_out(&property_context, "%lu", 3, "site", index, "bytes", site->live_bytes);
+        property_value_out(
+            &property_context, "%lu", 3, "site", index, "blocks", site->live_blocks);
+    }
+
+    for(size_t i = 0; i < snapshot->samples_count; i++) {
+        const MemmgrHeapSample* sample = &snapshot->samples[i];
+        snprintf(index, sizeof(index), "%zu", i);
+        property_value_out(&property_context, "%lu", 3, "sample", index, "tick", sample->tick);
+        property_value_out(
+            &property_context, "%lu", 3, "sample", index, "free", sample->free_heap);
+        property_context.last = (i + 1 == snapshot->samples_count);
+        property_value_out(
+            &property_context, "%lu", 3, "sample", index, "max_block", sample->max_free_block);
+    }
+
+    furi_string_free(key);
+    furi_string_free(value);
+    free(snapshot);
+}
+
 static void rpc_system_property_get_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(request->which_content == PB_Main_property_get_request_tag);
@@ -81,6 +134,8 @@ static void rpc_system_property_get_process(const PB_Main* request, void* contex
         furi_hal_power_info_get(rpc_system_property_get_callback, '.', &property_context);
     } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_POWER_DEBUG)) {
         furi_hal_power_debug_get(rpc_system_property_get_callback, &property_context);
+    } else if(!furi_string_cmp(topkey, PROPERTY_CATEGORY_HEAP_INFO)) {
+        rpc_system_property_heap_info_get(rpc_system_property_get_callback, &property_context);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, PB_CommandStatus_ERROR_INVALID_PARAMETERS);
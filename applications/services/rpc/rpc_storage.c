@@ -18,21 +18,203 @@
 
 #define MAX_NAME_LENGTH 255
 
+/* Read chunk size, fixed: ReadRequest has no field to negotiate a larger one */
 static const size_t MAX_DATA_SIZE = 512;
+/* Card write size of pipelined uploads, client chunks are gathered up to it */
+static const size_t MAX_WRITE_CHUNK_SIZE = 4096;
 
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
 } RpcStorageState;
 
+/* Number of chunk buffers in flight: one is filled while the other one is transferred */
+#define RPC_STORAGE_TRANSFER_BUFFERS (2)
+
+typedef struct {
+    pb_bytes_array_t* data;
+    bool last;
+} RpcStorageChunk;
+
+typedef bool (*RpcStorageTransferCallback)(RpcStorageChunk* chunk, void* context);
+
+/* Double-buffered worker: chunks are filled by the session thread and consumed
+ * by the worker, so SD card and transport transfers overlap. Transfers always start
+ * at offset 0 and carry no chunk checksum, the schema has no fields for either */
+typedef struct {
+    FuriThread* thread;
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* ready_queue;
+    RpcStorageChunk chunks[RPC_STORAGE_TRANSFER_BUFFERS];
+    size_t chunk_size;
+    RpcStorageTransferCallback callback;
+    void* context;
+    /* Set by the worker, checked by the producer */
+    FuriMutex* mutex;
+    bool error;
+} RpcStorageTransfer;
+
 typedef struct {
     RpcSession* session;
     Storage* api;
     File* file;
     RpcStorageState state;
     uint32_t current_command_id;
+    RpcStorageTransfer* write_transfer;
+    RpcStorageChunk* write_chunk;
 } RpcStorageSystem;
 
+typedef struct {
+    RpcSession* session;
+    uint32_t command_id;
+    PB_Main* response;
+} RpcStorageReadContext;
+
+static bool rpc_system_storage_transfer_get_error(RpcStorageTransfer* transfer) {
+    furi_check(furi_mutex_acquire(transfer->mutex, FuriWaitForever) == FuriStatusOk);
+    bool error = transfer->error;
+    furi_check(furi_mutex_release(transfer->mutex) == FuriStatusOk);
+    return error;
+}
+
+static int32_t rpc_system_storage_transfer_worker(void* context) {
+    RpcStorageTransfer* transfer = context;
+
+    while(true) {
+        RpcStorageChunk* chunk;
+        furi_check(
+            furi_message_queue_get(transfer->ready_queue, &chunk, FuriWaitForever) ==
+            FuriStatusOk);
+        if(!chunk) break;
+
+        if(!rpc_system_storage_transfer_get_error(transfer) &&
+           !transfer->callback(chunk, transfer->context)) {
+            furi_check(furi_mutex_acquire(transfer->mutex, FuriWaitForever) == FuriStatusOk);
+            transfer->error = true;
+            furi_check(furi_mutex_release(transfer->mutex) == FuriStatusOk);
+        }
+
+        furi_check(
+            furi_message_queue_put(transfer->free_queue, &chunk, FuriWaitForever) ==
+            FuriStatusOk);
+    }
+
+    return 0;
+}
+
+static RpcStorageTransfer* rpc_system_storage_transfer_alloc(
+    size_t chunk_size,
+    RpcStorageTransferCallback callback,
+    void* context) {
+    RpcStorageTransfer* transfer = malloc(sizeof(RpcStorageTransfer));
+    transfer->chunk_size = chunk_size;
+    transfer->callback = callback;
+    transfer->context = context;
+    transfer->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
+    transfer->free_queue =
+        furi_message_queue_alloc(RPC_STORAGE_TRANSFER_BUFFERS, sizeof(RpcStorageChunk*));
+    /* One extra slot for the stop marker */
+    transfer->ready_queue =
+        furi_message_queue_alloc(RPC_STORAGE_TRANSFER_BUFFERS + 1, sizeof(RpcStorageChunk*));
+
+    for(size_t i = 0; i < RPC_STORAGE_TRANSFER_BUFFERS; ++i) {
+        RpcStorageChunk* chunk = &transfer->chunks[i];
+        chunk->data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(chunk_size));
+        furi_check(furi_message_queue_put(transfer->free_queue, &chunk, 0) == FuriStatusOk);
+    }
+
+    transfer->thread = furi_thread_alloc_ex(
+        "RpcStorageTransfer", 2048, rpc_system_storage_transfer_worker, transfer);
+    furi_thread_start(transfer->thread);
+
+    return transfer;
+}
+
+/* Waits for all committed chunks to be processed, returns false if any of them failed */
+static bool rpc_system_storage_transfer_free(RpcStorageTransfer* transfer) {
+    RpcStorageChunk* stop = NULL;
+    furi_check(
+        furi_message_queue_put(transfer->ready_queue, &stop, FuriWaitForever) == FuriStatusOk);
+    furi_thread_join(transfer->thread);
+    furi_thread_free(transfer->thread);
+
+    bool success = !rpc_system_storage_transfer_get_error(transfer);
+
+    for(size_t i = 0; i < RPC_STORAGE_TRANSFER_BUFFERS; ++i) {
+        free(transfer->chunks[i].data);
+    }
+    furi_message_queue_free(transfer->free_queue);
+    furi_message_queue_free(transfer->ready_queue);
+    furi_mutex_free(transfer->mutex);
+    free(transfer);
+
+    return success;
+}
+
+static RpcStorageChunk* rpc_system_storage_transfer_acquire(RpcStorageTransfer* transfer) {
+    RpcStorageChunk* chunk;
+    furi_check(
+        furi_message_queue_get(transfer->free_queue, &chunk, FuriWaitForever) == FuriStatusOk);
+    chunk->data->size = 0;
+    chunk->last = false;
+    return chunk;
+}
+
+static void rpc_system_storage_transfer_commit(
+    RpcStorageTransfer* transfer,
+    RpcStorageChunk* chunk) {
+    furi_check(
+        furi_message_queue_put(transfer->ready_queue, &chunk, FuriWaitForever) == FuriStatusOk);
+}
+
+static bool rpc_system_storage_write_chunk(RpcStorageChunk* chunk, void* context) {
+    File* file = context;
+    return storage_file_write(file, chunk->data->bytes, chunk->data->size) == chunk->data->size;
+}
+
+/* Data of consecutive write requests is gathered into full chunks before hitting the card */
+static bool rpc_system_storage_write_queue(
+    RpcStorageSystem* rpc_storage,
+    const uint8_t* data,
+    size_t size) {
+    RpcStorageTransfer* transfer = rpc_storage->write_transfer;
+
+    while(size && !rpc_system_storage_transfer_get_error(transfer)) {
+        if(!rpc_storage->write_chunk) {
+            rpc_storage->write_chunk = rpc_system_storage_transfer_acquire(transfer);
+        }
+
+        pb_bytes_array_t* buffer = rpc_storage->write_chunk->data;
+        size_t copy_size = MIN(size, transfer->chunk_size - buffer->size);
+        memcpy(&buffer->bytes[buffer->size], data, copy_size);
+        buffer->size += copy_size;
+        data += copy_size;
+        size -= copy_size;
+
+        if(buffer->size == transfer->chunk_size) {
+            rpc_system_storage_transfer_commit(transfer, rpc_storage->write_chunk);
+            rpc_storage->write_chunk = NULL;
+        }
+    }
+
+    return !rpc_system_storage_transfer_get_error(transfer);
+}
+
+static bool rpc_system_storage_write_finish(RpcStorageSystem* rpc_storage) {
+    if(!rpc_storage->write_transfer) return true;
+
+    if(rpc_storage->write_chunk) {
+        rpc_system_storage_transfer_commit(rpc_storage->write_transfer, rpc_storage->write_chunk);
+        rpc_storage->write_chunk = NULL;
+    }
+
+    bool success = rpc_system_storage_transfer_free(rpc_storage->write_transfer);
+    rpc_storage->write_transfer = NULL;
+
+    return success;
+}
+
 static void rpc_system_storage_reset_state(
     RpcStorageSystem* rpc_storage,
     RpcSession* session,
@@ -49,6 +231,7 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            rpc_system_storage_write_finish(rpc_storage);
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
         }
@@ -341,6 +524,28 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     storage_file_free(file);
 }
 
+static bool rpc_system_storage_read_chunk(File* file, RpcStorageChunk* chunk, size_t size) {
+    chunk->data->size = storage_file_read(file, chunk->data->bytes, size);
+    return chunk->data->size == size;
+}
+
+static bool rpc_system_storage_read_send(RpcStorageChunk* chunk, void* context) {
+    RpcStorageReadContext* read_context = context;
+
+    /* use same message memory to send every chunk of response */
+    PB_Main* response = read_context->response;
+    response->command_id = read_context->command_id;
+    response->command_status = PB_CommandStatus_OK;
+    response->which_content = PB_Main_storage_read_response_tag;
+    response->has_next = !chunk->last;
+    response->content.storage_read_response.has_file = true;
+    response->content.storage_read_response.file.data = chunk->data;
+
+    rpc_send(read_context->session, response);
+
+    return true;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -354,48 +559,46 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     rpc_system_storage_reset_state(rpc_storage, session, true);
 
-    /* use same message memory to send response */
-    PB_Main* response = malloc(sizeof(PB_Main));
+    RpcStorageReadContext read_context = {
+        .session = session,
+        .command_id = request->command_id,
+        .response = malloc(sizeof(PB_Main)),
+    };
     const char* path = request->content.storage_read_request.path;
     File* file = storage_file_alloc(rpc_storage->api);
     bool fs_operation_success = storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING);
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
-        do {
-            response->command_id = request->command_id;
-            response->which_content = PB_Main_storage_read_response_tag;
-            response->command_status = PB_CommandStatus_OK;
-
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Warray-bounds"
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-#pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
-            }
-
+        if(size_left <= MAX_DATA_SIZE) {
+            RpcStorageChunk chunk = {
+                .data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE)),
+                .last = true,
+            };
+            fs_operation_success = rpc_system_storage_read_chunk(file, &chunk, size_left);
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                rpc_system_storage_read_send(&chunk, &read_context);
             }
-        } while((size_left != 0) && fs_operation_success);
+            free(chunk.data);
+        } else {
+            // Next chunk is read from the card while the previous one is sent
+            RpcStorageTransfer* transfer = rpc_system_storage_transfer_alloc(
+                MAX_DATA_SIZE, rpc_system_storage_read_send, &read_context);
+
+            while(size_left && fs_operation_success) {
+                RpcStorageChunk* chunk = rpc_system_storage_transfer_acquire(transfer);
+                size_t read_size = MIN(size_left, MAX_DATA_SIZE);
+                fs_operation_success = rpc_system_storage_read_chunk(file, chunk, read_size);
+                size_left -= read_size;
+                chunk->last = (size_left == 0);
+
+                if(fs_operation_success) {
+                    rpc_system_storage_transfer_commit(transfer, chunk);
+                }
+            }
+
+            rpc_system_storage_transfer_free(transfer);
+        }
     }
 
     if(!fs_operation_success) {
@@ -403,7 +606,7 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
             session, request->command_id, rpc_system_storage_get_file_error(file));
     }
 
-    free(response);
+    free(read_context.response);
     storage_file_close(file);
     storage_file_free(file);
 }
@@ -439,8 +642,15 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         rpc_storage->current_command_id = request->command_id;
         rpc_storage->state = RpcStorageStateWriting;
         const char* path = request->content.storage_write_request.path;
+
         fs_operation_success =
             storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+
+        // Card writes of a multi-chunk upload overlap decoding of the next chunks
+        if(fs_operation_success && request->has_next) {
+            rpc_storage->write_transfer = rpc_system_storage_transfer_alloc(
+                MAX_WRITE_CHUNK_SIZE, rpc_system_storage_write_chunk, rpc_storage->file);
+        }
     }
 
     File* file = rpc_storage->file;
@@ -452,8 +662,18 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
            request->content.storage_write_request.file.data->size) {
             uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
             size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+
+            if(rpc_storage->write_transfer) {
+                fs_operation_success =
+                    rpc_system_storage_write_queue(rpc_storage, buffer, buffer_size);
+            } else {
+                size_t written_size = storage_file_write(file, buffer, buffer_size);
+                fs_operation_success = (written_size == buffer_size);
+            }
+        }
+
+        if(fs_operation_success && !request->has_next) {
+            fs_operation_success = rpc_system_storage_write_finish(rpc_storage);
         }
 
         send_response = !request->has_next;
@@ -462,6 +682,8 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
     PB_CommandStatus command_status = PB_CommandStatus_OK;
     if(!fs_operation_success) {
         send_response = true;
+        // Worker has to be stopped before the file error can be queried
+        rpc_system_storage_write_finish(rpc_storage);
         command_status = rpc_system_storage_get_file_error(file);
         if(command_status == PB_CommandStatus_OK) {
             // Report errors not handled by underlying APIs
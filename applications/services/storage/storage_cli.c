@@ -9,6 +9,7 @@
 #include <lib/toolbox/tar/tar_archive.h>
 #include <storage/storage.h>
 #include <storage/storage_sd_api.h>
+#include <sector_cache.h>
 #include <power/power_service/power.h>
 
 #define MAX_NAME_LENGTH 255
@@ -61,6 +62,17 @@ static void storage_cli_info(Cli* cli, FuriString* path, FuriString* args) {
                 sd_info.product_serial_number,
                 sd_info.manufacturing_month,
                 sd_info.manufacturing_year);
+
+            SectorCacheStats cache_stats;
+            sector_cache_get_stats(&cache_stats);
+            printf(
+                "Cache: %lu hits, %lu misses\r\n"
+                "Read-ahead: %lu sectors\r\nWrite-back: %lu sectors in %lu writes\r\n",
+                cache_stats.hits,
+                cache_stats.misses,
+                cache_stats.read_ahead,
+                cache_stats.write_back,
+                cache_stats.write_back_transfers);
         }
     } else {
         storage_cli_print_usage();
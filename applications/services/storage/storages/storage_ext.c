@@ -1,4 +1,5 @@
 #include <fatfs.h>
+#include <sector_cache.h>
 #include <furi_hal.h>
 #include <furi_hal_sd.h>
 
@@ -51,6 +52,8 @@ static bool sd_mount_card_internal(StorageData* storage, bool notify) {
             // bsp error
             storage->status = StorageStatusErrorInternal;
         } else {
+            // Card may have been swapped, cached sectors are no longer valid
+            sector_cache_init();
             SDError status = f_mount(sd_data->fs, sd_data->path, 1);
 
             if(status == FR_OK || status == FR_NO_FILESYSTEM) {
@@ -162,6 +165,9 @@ FS_Error sd_unmount_card(StorageData* storage) {
     error = FR_DISK_ERR;
 
     // TODO FL-3522: do i need to close the files?
+    if(!sector_cache_flush()) {
+        FURI_LOG_W(TAG, "sector cache flush failed");
+    }
     f_mount(0, sd_data->path, 0);
 
     return storage_ext_parse_error(error);
@@ -11,6 +11,10 @@
 
 #define TAG "JS"
 
+// Shared by scripts started from the app and from CLI, so not APP_DATA_PATH
+#define JS_APP_DATA_PATH    EXT_PATH("apps_data/js_app")
+#define JS_BCODE_CACHE_PATH JS_APP_DATA_PATH "/cache"
+
 struct JsThread {
     FuriThread* thread;
     FuriString* path;
@@ -210,6 +214,17 @@ static void js_global_to_hex_string(struct mjs* mjs) {
     mjs_return(mjs, ret);
 }
 
+static void js_bcode_cache_setup(struct mjs* mjs) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_mkdir(storage, JS_APP_DATA_PATH);
+    furi_record_close(RECORD_STORAGE);
+
+    // Cached bcode is invalidated when firmware API changes
+    uint16_t api_major, api_minor;
+    furi_hal_info_get_api_version(&api_major, &api_minor);
+    mjs_set_bcode_cache(mjs, JS_BCODE_CACHE_PATH, ((uint32_t)api_major << 16) | api_minor);
+}
+
 #ifdef JS_DEBUG
 static void js_dump_write_callback(void* ctx, const char* format, ...) {
     File* file = ctx;
@@ -255,6 +270,8 @@ static int32_t js_thread(void* arg) {
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
 
+    js_bcode_cache_setup(mjs);
+
     mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
 
 #ifdef JS_DEBUG
@@ -87,8 +87,8 @@ struct FuriEventLoop {
     FuriEventLoopTree_t tree;
     WaitingList_t waiting_list;
 
-    // Active timer list
-    TimerList_t timer_list;
+    // Active timers, allocated when the first timer starts
+    FuriEventLoopTimerWheel* timer_wheel;
     // Timer request queue
     TimerQueue_t timer_queue;
     // Pending callback queue
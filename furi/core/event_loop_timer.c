@@ -19,35 +19,248 @@ static inline uint32_t
     return elapsed_time < timer->interval ? timer->interval - elapsed_time : 0;
 }
 
-static inline bool furi_event_loop_timer_is_expired(const FuriEventLoopTimer* timer) {
-    return furi_event_loop_timer_get_elapsed_time(timer) >= timer->interval;
+/*
+ * Timer wheel
+ *
+ * Active timers are kept in a hierarchical timing wheel: level 0 slots are one tick wide,
+ * each next level slot spans a whole revolution of the previous level. A timer is linked
+ * into the slot of the lowest level that can hold its expiration tick, so arming and
+ * cancelling take constant time. When the wheel crosses a slot boundary, timers of the
+ * upper level slot are cascaded down, and expired level 0 slots are moved to the expired
+ * list as a whole. Occupancy bitmaps let the wheel skip empty slots instead of stepping
+ * through every tick.
+ */
+
+#define FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS    (4U)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS (5U)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS     (1U << FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK (FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS - 1U)
+#define FURI_EVENT_LOOP_TIMER_WHEEL_RANGE \
+    (1UL << (FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS))
+
+struct FuriEventLoopTimerWheel {
+    // Next tick to be processed
+    uint32_t now;
+    // Number of timers in the wheel, expired ones included
+    size_t count;
+    // Expired timers waiting for their callbacks, in expiration order
+    FuriEventLoopTimer* expired;
+    // Bit N is set if slot N of the level is not empty
+    uint32_t occupied[FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS];
+    FuriEventLoopTimer* slots[FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS]
+                             [FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS];
+};
+
+// Lists are NULL-terminated forwards, the head's prev points to the tail
+static void furi_event_loop_timer_list_push(FuriEventLoopTimer** list, FuriEventLoopTimer* timer) {
+    FuriEventLoopTimer* head = *list;
+
+    timer->list = list;
+    timer->next = NULL;
+
+    if(head) {
+        FuriEventLoopTimer* tail = head->prev;
+        tail->next = timer;
+        timer->prev = tail;
+        head->prev = timer;
+    } else {
+        timer->prev = timer;
+        *list = timer;
+    }
 }
 
-static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
-    FuriEventLoopTimer* timer_pos = NULL;
+static void
+    furi_event_loop_timer_list_splice(FuriEventLoopTimer** list, FuriEventLoopTimer** from) {
+    FuriEventLoopTimer* other = *from;
+    if(!other) return;
 
-    FURI_CRITICAL_ENTER();
+    for(FuriEventLoopTimer* timer = other; timer; timer = timer->next) {
+        timer->list = list;
+    }
 
-    const uint32_t remaining_time = furi_event_loop_timer_get_remaining_time_private(timer);
+    FuriEventLoopTimer* head = *list;
+    if(head) {
+        FuriEventLoopTimer* tail = head->prev;
+        head->prev = other->prev;
+        tail->next = other;
+        other->prev = tail;
+    } else {
+        *list = other;
+    }
 
-    TimerList_it_t it;
-    for(TimerList_it_last(it, instance->timer_list); !TimerList_end_p(it);
-        TimerList_previous(it)) {
-        FuriEventLoopTimer* tmp = TimerList_ref(it);
-        if(remaining_time >= furi_event_loop_timer_get_remaining_time_private(tmp)) {
-            timer_pos = tmp;
-            break;
-        }
+    *from = NULL;
+}
+
+static void furi_event_loop_timer_wheel_release_slot(
+    FuriEventLoopTimerWheel* wheel,
+    FuriEventLoopTimer** list) {
+    if(list == &wheel->expired || *list) return;
+
+    const size_t index = list - &wheel->slots[0][0];
+    const size_t level = index / FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS;
+
+    wheel->occupied[level] &= ~(1UL << (index % FURI_EVENT_LOOP_TIMER_WHEEL_SLOTS));
+}
+
+static void furi_event_loop_timer_wheel_insert(
+    FuriEventLoopTimerWheel* wheel,
+    FuriEventLoopTimer* timer) {
+    uint32_t expires = timer->expires;
+    uint32_t delta = expires - wheel->now;
+
+    if((int32_t)delta < 0) {
+        // Already due, e.g. zero interval or a long busy loop iteration
+        furi_event_loop_timer_list_push(&wheel->expired, timer);
+        return;
+    }
+
+    if(delta >= FURI_EVENT_LOOP_TIMER_WHEEL_RANGE) {
+        // Parked in the last slot of the top level, cascaded again when it is reached
+        delta = FURI_EVENT_LOOP_TIMER_WHEEL_RANGE - 1;
+        expires = wheel->now + delta;
+    }
+
+    size_t level = 0;
+    while(delta >> ((level + 1) * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS)) {
+        level++;
     }
 
-    FURI_CRITICAL_EXIT();
+    const size_t slot = (expires >> (level * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS)) &
+                        FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK;
 
-    if(timer_pos) {
-        TimerList_push_after(timer_pos, timer);
+    furi_event_loop_timer_list_push(&wheel->slots[level][slot], timer);
+    wheel->occupied[level] |= 1UL << slot;
+}
+
+static void furi_event_loop_timer_wheel_remove(
+    FuriEventLoopTimerWheel* wheel,
+    FuriEventLoopTimer* timer) {
+    FuriEventLoopTimer** list = timer->list;
+    FuriEventLoopTimer* head = *list;
+
+    if(timer == head) {
+        *list = timer->next;
     } else {
-        TimerList_push_front(instance->timer_list, timer);
+        timer->prev->next = timer->next;
+    }
+
+    if(timer->next) {
+        timer->next->prev = timer->prev;
+    } else if(timer != head) {
+        head->prev = timer->prev;
+    }
+
+    timer->list = NULL;
+    timer->next = NULL;
+    timer->prev = NULL;
+
+    furi_event_loop_timer_wheel_release_slot(wheel, list);
+    wheel->count--;
+}
+
+static void furi_event_loop_timer_wheel_cascade(
+    FuriEventLoopTimerWheel* wheel,
+    size_t level,
+    size_t slot) {
+    FuriEventLoopTimer* timer = wheel->slots[level][slot];
+
+    wheel->slots[level][slot] = NULL;
+    wheel->occupied[level] &= ~(1UL << slot);
+
+    while(timer) {
+        FuriEventLoopTimer* next = timer->next;
+        furi_event_loop_timer_wheel_insert(wheel, timer);
+        timer = next;
+    }
+}
+
+// Ticks from `from` to the closest expiration or cascade, UINT32_MAX if the wheel is empty
+static uint32_t furi_event_loop_timer_wheel_get_next_event(
+    const FuriEventLoopTimerWheel* wheel,
+    uint32_t from) {
+    uint32_t result = UINT32_MAX;
+
+    for(size_t level = 0; level < FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS; ++level) {
+        const uint32_t occupied = wheel->occupied[level];
+        if(!occupied) continue;
+
+        // Slot boundaries of this level at or after `from`
+        const size_t shift = level * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS;
+        uint32_t base = from >> shift;
+        if(from & ((1UL << shift) - 1)) {
+            base++;
+        }
+
+        const size_t index = base & FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK;
+        const uint32_t rotated = index ? (occupied >> index) | (occupied << (32U - index)) :
+                                         occupied;
+        const uint32_t event = (base + __builtin_ctz(rotated)) << shift;
+
+        result = MIN(result, event - from);
+    }
+
+    return result;
+}
+
+static void furi_event_loop_timer_wheel_advance(FuriEventLoopTimerWheel* wheel, uint32_t tick) {
+    while((int32_t)(tick - wheel->now) >= 0) {
+        const uint32_t now = wheel->now;
+
+        if((now & FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK) == 0) {
+            // Upper levels first, so that their timers can land in lower level slots due now
+            size_t top = 1;
+            while(top < FURI_EVENT_LOOP_TIMER_WHEEL_LEVELS - 1 &&
+                  ((now >> (top * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS)) &
+                   FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK) == 0) {
+                top++;
+            }
+
+            for(size_t level = top; level > 0; --level) {
+                furi_event_loop_timer_wheel_cascade(
+                    wheel,
+                    level,
+                    (now >> (level * FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_BITS)) &
+                        FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK);
+            }
+        }
+
+        const size_t slot = now & FURI_EVENT_LOOP_TIMER_WHEEL_SLOT_MASK;
+        furi_event_loop_timer_list_splice(&wheel->expired, &wheel->slots[0][slot]);
+        wheel->occupied[0] &= ~(1UL << slot);
+
+        // Jump straight to the next slot that needs attention
+        const uint32_t next_event = furi_event_loop_timer_wheel_get_next_event(wheel, now + 1);
+        const uint32_t remaining = tick - now;
+
+        wheel->now = now + 1 + MIN(next_event, remaining);
     }
-    // At this point, TimerList_front() points to the first timer to expire
+}
+
+static void furi_event_loop_schedule_timer(FuriEventLoop* instance, FuriEventLoopTimer* timer) {
+    FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
+
+    if(!wheel) {
+        wheel = malloc(sizeof(FuriEventLoopTimerWheel));
+        instance->timer_wheel = wheel;
+    }
+
+    if(!wheel->count) {
+        // Nothing to process in between, start from the current tick
+        wheel->now = xTaskGetTickCount();
+    }
+
+    uint32_t expires = timer->start_time + timer->interval;
+
+    if(timer->slack) {
+        // Align to the largest power of two within slack, so that such timers expire together
+        const uint32_t granularity = 1UL << (31U - __builtin_clz(timer->slack));
+        expires = (expires + granularity - 1) & ~(granularity - 1);
+    }
+
+    timer->expires = expires;
+
+    furi_event_loop_timer_wheel_insert(wheel, timer);
+    wheel->count++;
 }
 
 static void furi_event_loop_timer_enqueue_request(
@@ -76,14 +289,21 @@ static void furi_event_loop_timer_enqueue_request(
  */
 
 uint32_t furi_event_loop_get_timer_wait_time(const FuriEventLoop* instance) {
-    uint32_t wait_time = FuriWaitForever;
+    const FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
 
-    if(!TimerList_empty_p(instance->timer_list)) {
-        FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
-        wait_time = furi_event_loop_timer_get_remaining_time_private(timer);
+    if(!wheel || !wheel->count) {
+        return FuriWaitForever;
+    } else if(wheel->expired) {
+        return 0;
     }
 
-    return wait_time;
+    const uint32_t next_event = furi_event_loop_timer_wheel_get_next_event(wheel, wheel->now);
+    if(next_event == UINT32_MAX) {
+        return FuriWaitForever;
+    }
+
+    const uint32_t wait_time = wheel->now + next_event - xTaskGetTickCount();
+    return (int32_t)wait_time > 0 ? wait_time : 0;
 }
 
 void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
@@ -91,7 +311,7 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
         FuriEventLoopTimer* timer = TimerQueue_pop_front(instance->timer_queue);
 
         if(timer->active) {
-            TimerList_unlink(timer);
+            furi_event_loop_timer_wheel_remove(instance->timer_wheel, timer);
         }
 
         if(timer->request == FuriEventLoopTimerRequestStart) {
@@ -116,31 +336,52 @@ void furi_event_loop_process_timer_queue(FuriEventLoop* instance) {
 }
 
 bool furi_event_loop_process_expired_timers(FuriEventLoop* instance) {
-    if(TimerList_empty_p(instance->timer_list)) {
-        return false;
-    }
-    // The front() element contains the earliest-expiring timer
-    FuriEventLoopTimer* timer = TimerList_front(instance->timer_list);
+    FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
 
-    if(!furi_event_loop_timer_is_expired(timer)) {
+    if(!wheel || !wheel->count) {
         return false;
     }
 
-    TimerList_unlink(timer);
+    furi_event_loop_timer_wheel_advance(wheel, xTaskGetTickCount());
 
-    if(timer->periodic) {
-        const uint32_t num_events =
-            furi_event_loop_timer_get_elapsed_time(timer) / timer->interval;
+    bool processed = false;
 
-        timer->start_time += timer->interval * num_events;
-        furi_event_loop_schedule_timer(instance, timer);
+    // All timers that expired since the last iteration are processed in one batch
+    while(wheel->expired) {
+        FuriEventLoopTimer* timer = wheel->expired;
+        furi_event_loop_timer_wheel_remove(wheel, timer);
 
-    } else {
-        timer->active = false;
+        if(timer->periodic) {
+            const uint32_t num_events =
+                furi_event_loop_timer_get_elapsed_time(timer) / timer->interval;
+
+            timer->start_time += timer->interval * num_events;
+            furi_event_loop_schedule_timer(instance, timer);
+
+        } else {
+            timer->active = false;
+        }
+
+        // Stopped, restarted or freed by one of the previous callbacks in this batch
+        if(timer->request != FuriEventLoopTimerRequestNone) {
+            continue;
+        }
+
+        timer->callback(timer->context);
+        processed = true;
     }
 
-    timer->callback(timer->context);
-    return true;
+    return processed;
+}
+
+void furi_event_loop_free_timers(FuriEventLoop* instance) {
+    FuriEventLoopTimerWheel* wheel = instance->timer_wheel;
+
+    if(wheel) {
+        furi_check(wheel->count == 0);
+        free(wheel);
+        instance->timer_wheel = NULL;
+    }
 }
 
 /*
@@ -164,7 +405,6 @@ FuriEventLoopTimer* furi_event_loop_timer_alloc(
     timer->context = context;
     timer->periodic = (type == FuriEventLoopTimerTypePeriodic);
 
-    TimerList_init_field(timer);
     TimerQueue_init_field(timer);
 
     return timer;
@@ -195,6 +435,13 @@ void furi_event_loop_timer_restart(FuriEventLoopTimer* timer) {
     furi_event_loop_timer_enqueue_request(timer, FuriEventLoopTimerRequestStart);
 }
 
+void furi_event_loop_timer_set_slack(FuriEventLoopTimer* timer, uint32_t slack) {
+    furi_check(timer);
+    furi_check(timer->owner->thread_id == furi_thread_get_current_id());
+
+    timer->slack = slack;
+}
+
 void furi_event_loop_timer_stop(FuriEventLoopTimer* timer) {
     furi_check(timer);
     furi_check(timer->owner->thread_id == furi_thread_get_current_id());
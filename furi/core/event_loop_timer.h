@@ -77,6 +77,18 @@ void furi_event_loop_timer_start(FuriEventLoopTimer* timer, uint32_t interval);
  */
 void furi_event_loop_timer_restart(FuriEventLoopTimer* timer);
 
+/**
+ * @brief Allow a timer to expire later than requested.
+ *
+ * Timers with slack are rounded up to a common tick, so that several of them
+ * expire together and the event loop wakes up less often. Takes effect the
+ * next time the timer is started. Default slack is 0.
+ *
+ * @param[in,out] timer pointer to the timer instance to be configured
+ * @param[in] slack maximum delay in ticks
+ */
+void furi_event_loop_timer_set_slack(FuriEventLoopTimer* timer, uint32_t slack);
+
 /**
  * @brief Stop a timer without firing its callback.
  *
@@ -20,9 +20,15 @@ struct FuriEventLoopTimer {
     uint32_t interval;
     uint32_t start_time;
     uint32_t next_interval;
+    uint32_t slack;
 
-    // Interface for the active timer list
-    ILIST_INTERFACE(TimerList, FuriEventLoopTimer);
+    // Tick at which the timer is due, start_time + interval rounded up within slack
+    uint32_t expires;
+
+    // Links of the timer wheel slot (or expired list) the active timer is in
+    FuriEventLoopTimer* next;
+    FuriEventLoopTimer* prev;
+    FuriEventLoopTimer** list;
 
     // Interface for the timer request queue
     ILIST_INTERFACE(TimerQueue, FuriEventLoopTimer);
@@ -33,11 +39,14 @@ struct FuriEventLoopTimer {
     bool periodic;
 };
 
-ILIST_DEF(TimerList, FuriEventLoopTimer, M_POD_OPLIST)
 ILIST_DEF(TimerQueue, FuriEventLoopTimer, M_POD_OPLIST)
 
+typedef struct FuriEventLoopTimerWheel FuriEventLoopTimerWheel;
+
 uint32_t furi_event_loop_get_timer_wait_time(const FuriEventLoop* instance);
 
 void furi_event_loop_process_timer_queue(FuriEventLoop* instance);
 
 bool furi_event_loop_process_expired_timers(FuriEventLoop* instance);
+
+void furi_event_loop_free_timers(FuriEventLoop* instance);
@@ -1,6 +1,7 @@
-#include "log.h"
+#include "log_i.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
@@ -8,10 +9,63 @@ LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+#define FURI_LOG_RING_SIZE           (2048U)
+#define FURI_LOG_RECORD_SIZE_MAX     (128U)
+#define FURI_LOG_TAG_SIZE_MAX        (16U)
+#define FURI_LOG_SPEC_SIZE_MAX       (24U)
+#define FURI_LOG_THREAD_STACK_SIZE   (2048U)
+#define FURI_LOG_THREAD_FLAG_PENDING (1U << 0)
+
+typedef enum {
+    FuriLogRecordFlagRaw = (1U << 0), /**< No header and line ending */
+    FuriLogRecordFlagText = (1U << 1), /**< Payload is tag and formatted text */
+    FuriLogRecordFlagBinary = (1U << 2), /**< Queued in binary mode, sent as is */
+} FuriLogRecordFlag;
+
+/** Deferred message, also sent as is after a zero byte in binary mode
+ * Tag and format are flash addresses, payload holds the arguments:
+ * 32 bit integers, 64 bit integers and doubles in little endian,
+ * strings zero terminated. Text records never go out in binary form.
+ */
+typedef struct {
+    uint8_t size; /**< Record size including this header */
+    uint8_t level;
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t tick;
+    uint32_t tag;
+    uint32_t format;
+} FuriLogRecord;
+
+typedef enum {
+    FuriLogArgNone,
+    FuriLogArgInt,
+    FuriLogArgInt64,
+    FuriLogArgDouble,
+    FuriLogArgString,
+    FuriLogArgInvalid,
+} FuriLogArg;
+
+typedef struct {
+    FuriLogArg arg;
+    uint8_t star_count;
+    bool star_precision;
+    int32_t precision;
+} FuriLogSpec;
+
 typedef struct {
     FuriLogLevel log_level;
+    FuriLogMode mode;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+
+    FuriThread* thread;
+    uint8_t* ring;
+    volatile uint32_t ring_head;
+    volatile uint32_t ring_tail;
+    volatile uint32_t dropped;
+    uintptr_t rom_start;
+    uintptr_t rom_end;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,74 +161,482 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+static void furi_log_print_header(
+    FuriString* string,
+    uint32_t tick,
+    FuriLogLevel level,
+    const char* tag) {
+    const char* color = _FURI_LOG_CLR_RESET;
+    const char* log_letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        color = _FURI_LOG_CLR_E;
+        log_letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        color = _FURI_LOG_CLR_W;
+        log_letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        color = _FURI_LOG_CLR_I;
+        log_letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        color = _FURI_LOG_CLR_D;
+        log_letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        color = _FURI_LOG_CLR_T;
+        log_letter = "T";
+        break;
+    default:
+        break;
+    }
 
-        const char* color = _FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = _FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = _FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = _FURI_LOG_CLR_I;
-            log_letter = "I";
-            break;
-        case FuriLogLevelDebug:
-            color = _FURI_LOG_CLR_D;
-            log_letter = "D";
-            break;
-        case FuriLogLevelTrace:
-            color = _FURI_LOG_CLR_T;
-            log_letter = "T";
-            break;
-        default:
+    // Timestamp
+    furi_string_printf(
+        string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, tick, color, log_letter, tag);
+    furi_log_puts(furi_string_get_cstr(string));
+    furi_string_reset(string);
+}
+
+/******************************* Deferred mode *******************************/
+
+static inline bool furi_log_is_rom(const void* ptr) {
+    return (uintptr_t)ptr >= furi_log.rom_start && (uintptr_t)ptr < furi_log.rom_end;
+}
+
+/* Parse a conversion specification, the same rules are used by scripts/log_decode.py */
+static const char* furi_log_parse_spec(const char* p, FuriLogSpec* spec) {
+    furi_assert(*p == '%');
+    p++;
+
+    spec->arg = FuriLogArgInvalid;
+    spec->star_count = 0;
+    spec->star_precision = false;
+    spec->precision = -1;
+
+    if(*p == '%') {
+        spec->arg = FuriLogArgNone;
+        return p + 1;
+    }
+
+    while(*p && strchr("-+ #0", *p)) p++;
+
+    if(*p == '*') {
+        spec->star_count++;
+        p++;
+    } else {
+        while(*p >= '0' && *p <= '9') p++;
+    }
+
+    if(*p == '.') {
+        p++;
+        if(*p == '*') {
+            spec->star_count++;
+            spec->star_precision = true;
+            p++;
+        } else {
+            spec->precision = 0;
+            while(*p >= '0' && *p <= '9') {
+                spec->precision = spec->precision * 10 + (*p - '0');
+                p++;
+            }
+        }
+    }
+
+    size_t long_count = 0;
+    bool is_wide = false;
+    while(*p && strchr("hlzjtL", *p)) {
+        if(*p == 'l') long_count++;
+        if(*p == 'j') is_wide = true;
+        if(*p == 'L') return p;
+        p++;
+    }
+
+    switch(*p) {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'x':
+    case 'X':
+    case 'o':
+        spec->arg = (long_count > 1 || is_wide) ? FuriLogArgInt64 : FuriLogArgInt;
+        break;
+    case 'c':
+    case 'p':
+        spec->arg = FuriLogArgInt;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+        spec->arg = FuriLogArgDouble;
+        break;
+    case 's':
+        spec->arg = long_count ? FuriLogArgInvalid : FuriLogArgString;
+        break;
+    default:
+        return p;
+    }
+
+    return p + 1;
+}
+
+static bool furi_log_pack_value(
+    uint8_t* buffer,
+    size_t size,
+    size_t* offset,
+    const void* value,
+    size_t value_size) {
+    if(*offset + value_size > size) return false;
+    memcpy(&buffer[*offset], value, value_size);
+    *offset += value_size;
+    return true;
+}
+
+bool furi_log_pack(
+    uint8_t* buffer,
+    size_t size,
+    size_t* packed,
+    const char* format,
+    va_list args) {
+    size_t offset = 0;
+
+    for(const char* p = format; *p;) {
+        if(*p != '%') {
+            p++;
+            continue;
+        }
+
+        FuriLogSpec spec;
+        p = furi_log_parse_spec(p, &spec);
+
+        int32_t precision = spec.precision;
+        for(size_t i = 0; i < spec.star_count; i++) {
+            int32_t star = va_arg(args, int);
+            if(spec.star_precision && i == spec.star_count - 1U) precision = star;
+            if(!furi_log_pack_value(buffer, size, &offset, &star, sizeof(star))) return false;
+        }
+
+        if(spec.arg == FuriLogArgInt) {
+            uint32_t value = va_arg(args, unsigned int);
+            if(!furi_log_pack_value(buffer, size, &offset, &value, sizeof(value))) return false;
+        } else if(spec.arg == FuriLogArgInt64) {
+            uint64_t value = va_arg(args, unsigned long long);
+            if(!furi_log_pack_value(buffer, size, &offset, &value, sizeof(value))) return false;
+        } else if(spec.arg == FuriLogArgDouble) {
+            double value = va_arg(args, double);
+            if(!furi_log_pack_value(buffer, size, &offset, &value, sizeof(value))) return false;
+        } else if(spec.arg == FuriLogArgString) {
+            // The string may be gone by the time the record is printed, copy it
+            const char* value = va_arg(args, const char*);
+            if(value == NULL) value = "(null)";
+            size_t length = precision >= 0 ? strnlen(value, precision) : strlen(value);
+            if(offset + length + 1 > size) return false;
+            memcpy(&buffer[offset], value, length);
+            buffer[offset + length] = '\0';
+            offset += length + 1;
+        } else if(spec.arg == FuriLogArgInvalid) {
+            return false;
+        }
+    }
+
+    *packed = offset;
+    return true;
+}
+
+void furi_log_unpack(FuriString* string, const char* format, const uint8_t* buffer, size_t size) {
+    size_t offset = 0;
+    char spec_buffer[FURI_LOG_SPEC_SIZE_MAX];
+
+    for(const char* p = format; *p;) {
+        const char* spec_start = strchr(p, '%');
+        if(spec_start == NULL) {
+            furi_string_cat_str(string, p);
             break;
         }
+        furi_string_cat_printf(string, "%.*s", (int)(spec_start - p), p);
+
+        FuriLogSpec spec;
+        p = furi_log_parse_spec(spec_start, &spec);
+        if(spec.arg == FuriLogArgNone) {
+            furi_string_push_back(string, '%');
+            continue;
+        }
+
+        // Substitute width and precision arguments
+        size_t spec_length = 0;
+        for(const char* c = spec_start; c < p; c++) {
+            if(spec_length + 12 > sizeof(spec_buffer)) return;
+            if(*c == '*') {
+                int32_t star = 0;
+                if(offset + sizeof(star) > size) return;
+                memcpy(&star, &buffer[offset], sizeof(star));
+                offset += sizeof(star);
+                spec_length += snprintf(
+                    &spec_buffer[spec_length], sizeof(spec_buffer) - spec_length, "%ld", star);
+            } else {
+                spec_buffer[spec_length++] = *c;
+            }
+        }
+        spec_buffer[spec_length] = '\0';
+
+        if(spec.arg == FuriLogArgInt) {
+            uint32_t value;
+            if(offset + sizeof(value) > size) return;
+            memcpy(&value, &buffer[offset], sizeof(value));
+            offset += sizeof(value);
+            furi_string_cat_printf(string, spec_buffer, value);
+        } else if(spec.arg == FuriLogArgInt64) {
+            uint64_t value;
+            if(offset + sizeof(value) > size) return;
+            memcpy(&value, &buffer[offset], sizeof(value));
+            offset += sizeof(value);
+            furi_string_cat_printf(string, spec_buffer, value);
+        } else if(spec.arg == FuriLogArgDouble) {
+            double value;
+            if(offset + sizeof(value) > size) return;
+            memcpy(&value, &buffer[offset], sizeof(value));
+            offset += sizeof(value);
+            furi_string_cat_printf(string, spec_buffer, value);
+        } else if(spec.arg == FuriLogArgString) {
+            const char* value = (const char*)&buffer[offset];
+            const size_t length = strnlen(value, size - offset);
+            if(offset + length >= size) return;
+            offset += length + 1;
+            furi_string_cat_printf(string, spec_buffer, value);
+        } else {
+            return;
+        }
+    }
+}
+
+static void furi_log_ring_push(const uint8_t* record, size_t size) {
+    bool pushed = false;
+    bool was_empty = false;
+
+    FURI_CRITICAL_ENTER();
+    const uint32_t used = furi_log.ring_head - furi_log.ring_tail;
+    if(used + size <= FURI_LOG_RING_SIZE) {
+        const uint32_t position = furi_log.ring_head % FURI_LOG_RING_SIZE;
+        const size_t first = MIN(size, FURI_LOG_RING_SIZE - position);
+        memcpy(&furi_log.ring[position], record, first);
+        memcpy(furi_log.ring, &record[first], size - first);
+        furi_log.ring_head += size;
+        was_empty = (used == 0);
+        pushed = true;
+    } else {
+        furi_log.dropped++;
+    }
+    FURI_CRITICAL_EXIT();
+
+    // The thread drains the ring completely before waiting again
+    if(pushed && was_empty) {
+        furi_thread_flags_set(furi_thread_get_id(furi_log.thread), FURI_LOG_THREAD_FLAG_PENDING);
+    }
+}
 
-        // Timestamp
-        furi_string_printf(
-            string, "%lu %s[%s][%s] " _FURI_LOG_CLR_RESET, furi_get_tick(), color, log_letter, tag);
+static void furi_log_ring_peek(uint8_t* data, size_t size) {
+    const uint32_t position = furi_log.ring_tail % FURI_LOG_RING_SIZE;
+    const size_t first = MIN(size, FURI_LOG_RING_SIZE - position);
+    memcpy(data, &furi_log.ring[position], first);
+    memcpy(&data[first], furi_log.ring, size - first);
+}
+
+static void furi_log_defer(
+    FuriLogLevel level,
+    const char* tag,
+    uint8_t flags,
+    const char* format,
+    va_list args) {
+    uint32_t record_buffer[FURI_LOG_RECORD_SIZE_MAX / sizeof(uint32_t)];
+    FuriLogRecord* record = (FuriLogRecord*)record_buffer;
+    uint8_t* payload = (uint8_t*)record_buffer + sizeof(FuriLogRecord);
+    const size_t payload_size_max = FURI_LOG_RECORD_SIZE_MAX - sizeof(FuriLogRecord);
+    size_t payload_size = 0;
+
+    record->level = level;
+    record->flags = flags;
+    record->reserved = 0;
+    record->tick = furi_get_tick();
+    record->tag = (uint32_t)tag;
+    record->format = (uint32_t)format;
+
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const bool packed = (tag == NULL || furi_log_is_rom(tag)) && furi_log_is_rom(format) &&
+                        furi_log_pack(payload, payload_size_max, &payload_size, format, args_copy);
+    va_end(args_copy);
+
+    if(!packed) {
+        // Application strings or unsupported arguments, format in place
+        record->flags |= FuriLogRecordFlagText;
+        record->tag = 0;
+        record->format = 0;
+
+        const size_t tag_length = tag ? strnlen(tag, FURI_LOG_TAG_SIZE_MAX) : 0;
+        if(tag_length) memcpy(payload, tag, tag_length);
+        payload[tag_length] = '\0';
+        payload_size = tag_length + 1;
+
+        char* text = (char*)&payload[payload_size];
+        int length = vsnprintf(text, payload_size_max - payload_size, format, args);
+        if(length < 0) length = 0;
+        payload_size += MIN((size_t)length, payload_size_max - payload_size - 1) + 1;
+    } else if(furi_log.mode == FuriLogModeBinary) {
+        record->flags |= FuriLogRecordFlagBinary;
+    }
+
+    record->size = sizeof(FuriLogRecord) + payload_size;
+    furi_log_ring_push((const uint8_t*)record_buffer, record->size);
+}
+
+static void furi_log_emit(FuriString* string, const FuriLogRecord* record) {
+    const uint8_t* payload = (const uint8_t*)record + sizeof(FuriLogRecord);
+    const size_t payload_size = record->size - sizeof(FuriLogRecord);
+    const bool is_raw = record->flags & FuriLogRecordFlagRaw;
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+
+    if(record->flags & FuriLogRecordFlagText) {
+        const char* tag = (const char*)payload;
+        if(!is_raw) furi_log_print_header(string, record->tick, record->level, tag);
+        furi_log_puts(tag + strlen(tag) + 1);
+        if(!is_raw) furi_log_puts("\r\n");
+
+    } else if(record->flags & FuriLogRecordFlagBinary) {
+        const uint8_t sync = 0;
+        furi_log_tx(&sync, sizeof(sync));
+        furi_log_tx((const uint8_t*)record, record->size);
+
+    } else {
+        if(!is_raw) {
+            furi_log_print_header(string, record->tick, record->level, (const char*)record->tag);
+        }
+        furi_log_unpack(string, (const char*)record->format, payload, payload_size);
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_reset(string);
+        if(!is_raw) furi_log_puts("\r\n");
+    }
+
+    furi_mutex_release(furi_log.mutex);
+}
+
+static int32_t furi_log_thread(void* context) {
+    UNUSED(context);
+
+    FuriString* string = furi_string_alloc();
+    uint32_t record_buffer[FURI_LOG_RECORD_SIZE_MAX / sizeof(uint32_t)];
+    FuriLogRecord* record = (FuriLogRecord*)record_buffer;
+
+    while(true) {
+        furi_thread_flags_wait(FURI_LOG_THREAD_FLAG_PENDING, FuriFlagWaitAny, FuriWaitForever);
+
+        while(furi_log.ring_tail != furi_log.ring_head) {
+            furi_log_ring_peek((uint8_t*)record_buffer, sizeof(record->size));
+            furi_log_ring_peek((uint8_t*)record_buffer, record->size);
+            furi_log_emit(string, record);
+
+            // Released after the output, furi_log_set_mode() waits for it
+            furi_log.ring_tail += record->size;
+        }
+
+        FURI_CRITICAL_ENTER();
+        const uint32_t dropped = furi_log.dropped;
+        furi_log.dropped = 0;
+        FURI_CRITICAL_EXIT();
+
+        if(dropped) {
+            furi_string_printf(string, "[log] %lu messages dropped\r\n", dropped);
+            furi_log_puts(furi_string_get_cstr(string));
+            furi_string_reset(string);
+        }
+    }
+
+    return 0;
+}
+
+/*****************************************************************************/
+
+static void furi_log_print_immediate(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    if(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+        FuriString* string;
+        string = furi_string_alloc();
+
+        if(tag) furi_log_print_header(string, furi_get_tick(), level, tag);
 
-        va_list args;
-        va_start(args, format);
         furi_string_vprintf(string, format, args);
-        va_end(args);
 
         furi_log_puts(furi_string_get_cstr(string));
         furi_string_free(string);
 
-        furi_log_puts("\r\n");
+        if(tag) furi_log_puts("\r\n");
 
         furi_mutex_release(furi_log.mutex);
     }
 }
 
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level <= furi_log.log_level) {
+        va_list args;
+        va_start(args, format);
+        if(furi_log.mode != FuriLogModeImmediate) {
+            furi_log_defer(level, tag, 0, format, args);
+        } else {
+            furi_log_print_immediate(level, tag, format, args);
+        }
+        va_end(args);
+    }
+}
+
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
-        FuriString* string;
-        string = furi_string_alloc();
+    if(level <= furi_log.log_level) {
         va_list args;
         va_start(args, format);
-        furi_string_vprintf(string, format, args);
+        if(furi_log.mode != FuriLogModeImmediate) {
+            furi_log_defer(level, NULL, FuriLogRecordFlagRaw, format, args);
+        } else {
+            furi_log_print_immediate(level, NULL, format, args);
+        }
         va_end(args);
+    }
+}
 
-        furi_log_puts(furi_string_get_cstr(string));
-        furi_string_free(string);
+void furi_log_set_mode(FuriLogMode mode) {
+    furi_check(mode <= FuriLogModeBinary);
+    furi_check(!FURI_IS_ISR());
 
-        furi_mutex_release(furi_log.mutex);
+    if(mode != FuriLogModeImmediate && furi_log.thread == NULL) {
+        furi_log.rom_start = furi_hal_flash_get_base();
+        furi_log.rom_end = (uintptr_t)furi_hal_flash_get_free_start_address();
+        furi_log.ring = malloc(FURI_LOG_RING_SIZE);
+
+        furi_log.thread = furi_thread_alloc_service(
+            "LogWorker", FURI_LOG_THREAD_STACK_SIZE, furi_log_thread, NULL);
+        furi_thread_set_priority(furi_log.thread, FuriThreadPriorityLow);
+        furi_thread_start(furi_log.thread);
+    }
+
+    if(mode == FuriLogModeImmediate && furi_log.thread) {
+        // Let queued messages out before the new ones, messages queued meanwhile are not awaited
+        const uint32_t head = furi_log.ring_head;
+        while((int32_t)(head - furi_log.ring_tail) > 0) {
+            furi_delay_tick(1);
+        }
     }
+
+    furi_log.mode = mode;
+}
+
+FuriLogMode furi_log_get_mode(void) {
+    return furi_log.mode;
 }
 
 void furi_log_set_level(FuriLogLevel level) {
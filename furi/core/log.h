@@ -39,6 +39,12 @@ typedef enum {
 #define _FURI_LOG_CLR_D _FURI_LOG_CLR(_FURI_LOG_CLR_BLUE)
 #define _FURI_LOG_CLR_T _FURI_LOG_CLR(_FURI_LOG_CLR_PURPLE)
 
+typedef enum {
+    FuriLogModeImmediate, /**< Format and transmit in the calling thread */
+    FuriLogModeDeferred, /**< Queue arguments, format and transmit in the log thread */
+    FuriLogModeBinary, /**< Queue arguments, transmit binary records from the log thread */
+} FuriLogMode;
+
 typedef void (*FuriLogHandlerCallback)(const uint8_t* data, size_t size, void* context);
 
 typedef struct {
@@ -109,6 +115,27 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level(void);
 
+/** Set log mode
+ *
+ * In deferred modes log calls copy the arguments to a ring buffer without
+ * blocking, which also works in interrupts. A low priority thread formats
+ * them later. Messages are dropped if the ring is full. In binary mode
+ * records are transmitted as is and must be decoded on the host with the
+ * firmware ELF, see scripts/log_decode.py. Messages with format or tag
+ * outside of the firmware image are formatted in place and sent as text.
+ * Queued messages keep the form of the mode they were queued in. Switching to
+ * immediate mode returns once the messages queued before the call are out.
+ *
+ * @param[in]  mode  The mode
+ */
+void furi_log_set_mode(FuriLogMode mode);
+
+/** Get log mode
+ *
+ * @return     The furi log mode.
+ */
+FuriLogMode furi_log_get_mode(void);
+
 /** Log level to string
  *
  * @param[in]  level  The level
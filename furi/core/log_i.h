@@ -0,0 +1,38 @@
+#pragma once
+
+#include "log.h"
+#include "string.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Pack arguments of a deferred message, as they are stored in the ring and sent in binary mode
+ *
+ * @param      buffer   buffer for the arguments
+ * @param      size     buffer size
+ * @param[out] packed   size of the packed arguments
+ * @param      format   printf format
+ * @param      args     arguments for the format
+ *
+ * @return     false if arguments don't fit or the format is not supported
+ */
+bool furi_log_pack(
+    uint8_t* buffer,
+    size_t size,
+    size_t* packed,
+    const char* format,
+    va_list args);
+
+/** Format a message from the arguments packed by furi_log_pack
+ *
+ * @param      string   string to append the message to
+ * @param      format   printf format the arguments were packed with
+ * @param      buffer   packed arguments
+ * @param      size     size of the packed arguments
+ */
+void furi_log_unpack(FuriString* string, const char* format, const uint8_t* buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -2,27 +2,22 @@
 #include <string.h>
 #include <furi_hal_memory.h>
 
-extern void* pvPortMalloc(size_t xSize);
+extern void* memmgr_heap_malloc(size_t size, const void* site);
 extern void vPortFree(void* pv);
 extern size_t xPortGetFreeHeapSize(void);
 extern size_t xPortGetTotalHeapSize(void);
 extern size_t xPortGetMinimumEverFreeHeapSize(void);
 
-void* malloc(size_t size) {
-    return pvPortMalloc(size);
-}
+// Allocation site is the caller of the public wrapper, not the wrapper itself
+#define MEMMGR_SITE() __builtin_return_address(0)
 
-void free(void* ptr) {
-    vPortFree(ptr);
-}
-
-void* realloc(void* ptr, size_t size) {
+static void* memmgr_realloc(void* ptr, size_t size, const void* site) {
     if(size == 0) {
         vPortFree(ptr);
         return NULL;
     }
 
-    void* p = pvPortMalloc(size);
+    void* p = memmgr_heap_malloc(size, site);
     if(ptr != NULL) {
         memcpy(p, ptr, size);
         vPortFree(ptr);
@@ -31,8 +26,20 @@ void* realloc(void* ptr, size_t size) {
     return p;
 }
 
+void* malloc(size_t size) {
+    return memmgr_heap_malloc(size, MEMMGR_SITE());
+}
+
+void free(void* ptr) {
+    vPortFree(ptr);
+}
+
+void* realloc(void* ptr, size_t size) {
+    return memmgr_realloc(ptr, size, MEMMGR_SITE());
+}
+
 void* calloc(size_t count, size_t size) {
-    return pvPortMalloc(count * size);
+    return memmgr_heap_malloc(count * size, MEMMGR_SITE());
 }
 
 char* strdup(const char* s) {
@@ -40,7 +47,7 @@ char* strdup(const char* s) {
     furi_check(((uint32_t)s << 2) != 0);
 
     size_t siz = strlen(s) + 1;
-    char* y = pvPortMalloc(siz);
+    char* y = memmgr_heap_malloc(siz, MEMMGR_SITE());
     memcpy(y, s, siz);
 
     return y;
@@ -60,7 +67,7 @@ size_t memmgr_get_minimum_free_heap(void) {
 
 void* __wrap__malloc_r(struct _reent* r, size_t size) {
     UNUSED(r);
-    return pvPortMalloc(size);
+    return memmgr_heap_malloc(size, MEMMGR_SITE());
 }
 
 void __wrap__free_r(struct _reent* r, void* ptr) {
@@ -70,12 +77,12 @@ void __wrap__free_r(struct _reent* r, void* ptr) {
 
 void* __wrap__calloc_r(struct _reent* r, size_t count, size_t size) {
     UNUSED(r);
-    return calloc(count, size);
+    return memmgr_heap_malloc(count * size, MEMMGR_SITE());
 }
 
 void* __wrap__realloc_r(struct _reent* r, void* ptr, size_t size) {
     UNUSED(r);
-    return realloc(ptr, size);
+    return memmgr_realloc(ptr, size, MEMMGR_SITE());
 }
 
 void* memmgr_alloc_from_pool(size_t size) {
@@ -219,12 +219,305 @@ static inline void traceFREE(void* pointer, size_t size) {
     }
 }
 
-size_t memmgr_heap_get_max_free_block(void) {
+/* Size-class slabs
+ *
+ * Requests up to MEMMGR_HEAP_SLAB_OBJECT_MAX bytes are served from fixed size
+ * objects carved out of MEMMGR_HEAP_SLAB_SIZE blocks of the first-fit heap.
+ * Every object keeps a BlockLink_t header, so thread tracing and vPortFree
+ * work the same way for both kinds of blocks. Allocated object header:
+ * - pxNextFreeBlock: NULL
+ * - xBlockSize: xBlockAllocatedBit | MEMMGR_HEAP_SLAB_OBJECT_BIT |
+ *   offset from the slab start << MEMMGR_HEAP_SLAB_OFFSET_SHIFT | object size
+ * Free objects are linked through pxNextFreeBlock. Free objects and empty
+ * slabs are accounted as free heap.
+ */
+#define MEMMGR_HEAP_SLAB_SIZE              (1024U)
+#define MEMMGR_HEAP_SLAB_OBJECT_MAX        (256U)
+#define MEMMGR_HEAP_SLAB_OBJECT_BIT        ((size_t)1 << 30)
+#define MEMMGR_HEAP_SLAB_OFFSET_SHIFT      (16U)
+#define MEMMGR_HEAP_SLAB_OFFSET_MASK       ((size_t)0x1FFF)
+#define MEMMGR_HEAP_SLAB_STRIDE_MASK       ((size_t)0xFFFF)
+#define MEMMGR_HEAP_SLAB_RECLAIM_THRESHOLD (8192U)
+
+typedef struct MemmgrHeapSlab MemmgrHeapSlab;
+
+struct MemmgrHeapSlab {
+    MemmgrHeapSlab* next;
+    MemmgrHeapSlab* prev;
+    BlockLink_t* free_objects;
+    uint16_t used;
+    uint16_t capacity;
+    uint16_t stride;
+    uint8_t size_class;
+};
+
+typedef struct {
+    MemmgrHeapSlab* partial; /* Slabs with free objects left */
+    MemmgrHeapSlab* empty; /* One cached empty slab, keeps churn off the first-fit list */
+} MemmgrHeapSlabClass;
+
+static const uint16_t memmgr_heap_slab_class_size[] = {16, 32, 48, 64, 96, 128, 192, 256};
+
+/* Size class by (size + 15) / 16 */
+static const uint8_t memmgr_heap_slab_class_lut[] =
+    {0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7};
+
+static MemmgrHeapSlabClass memmgr_heap_slab_classes[COUNT_OF(memmgr_heap_slab_class_size)];
+
+static const size_t memmgr_heap_slab_header_size =
+    (sizeof(MemmgrHeapSlab) + ((size_t)(portBYTE_ALIGNMENT - 1))) &
+    ~((size_t)portBYTE_ALIGNMENT_MASK);
+
+static void* prvHeapMalloc(size_t xWantedSize);
+static void prvHeapFree(BlockLink_t* pxLink);
+
+/* Allocation site tracing
+ *
+ * Traced blocks are 4 bytes larger than requested and keep the index of their
+ * site in the last word, MEMMGR_HEAP_SITE_TAG_BIT in xBlockSize marks them.
+ * Sites live in a small open addressing table, so tracing never allocates.
+ */
+#define MEMMGR_HEAP_SITE_TAG_BIT   ((size_t)1 << 29)
+#define MEMMGR_HEAP_SITES_MAX      (128U)
+#define MEMMGR_HEAP_SITES_PROBE    (8U)
+#define MEMMGR_HEAP_SITES_OTHER    (MEMMGR_HEAP_SITES_MAX)
+#define MEMMGR_HEAP_SAMPLE_PERIOD  (1000U)
+
+static volatile bool memmgr_heap_site_trace_enabled = false;
+/* Last entry collects sites that don't fit into the table */
+static MemmgrHeapSite memmgr_heap_sites[MEMMGR_HEAP_SITES_MAX + 1];
+static uint32_t memmgr_heap_site_histogram[MEMMGR_HEAP_HISTOGRAM_BUCKETS];
+static uint32_t memmgr_heap_site_tagged_blocks = 0;
+static MemmgrHeapSample memmgr_heap_samples[MEMMGR_HEAP_SAMPLES];
+static size_t memmgr_heap_samples_head = 0;
+static size_t memmgr_heap_samples_count = 0;
+
+static inline size_t memmgr_heap_block_size(const BlockLink_t* pxLink) {
+    if(pxLink->xBlockSize & MEMMGR_HEAP_SLAB_OBJECT_BIT) {
+        return pxLink->xBlockSize & MEMMGR_HEAP_SLAB_STRIDE_MASK;
+    } else {
+        return pxLink->xBlockSize & ~(xBlockAllocatedBit | MEMMGR_HEAP_SITE_TAG_BIT);
+    }
+}
+
+static inline size_t memmgr_heap_slab_overhead(const MemmgrHeapSlab* slab) {
+    return MEMMGR_HEAP_SLAB_SIZE - slab->capacity * slab->stride;
+}
+
+static void memmgr_heap_slab_list_push(MemmgrHeapSlab** head, MemmgrHeapSlab* slab) {
+    slab->prev = NULL;
+    slab->next = *head;
+    if(*head) (*head)->prev = slab;
+    *head = slab;
+}
+
+static void memmgr_heap_slab_list_remove(MemmgrHeapSlab** head, MemmgrHeapSlab* slab) {
+    if(slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        *head = slab->next;
+    }
+    if(slab->next) slab->next->prev = slab->prev;
+    slab->next = NULL;
+    slab->prev = NULL;
+}
+
+static MemmgrHeapSlab* memmgr_heap_slab_alloc(size_t size_class) {
+    MemmgrHeapSlab* slab = prvHeapMalloc(MEMMGR_HEAP_SLAB_SIZE - xHeapStructSize);
+    if(slab == NULL) return NULL;
+
+    const size_t stride = xHeapStructSize + memmgr_heap_slab_class_size[size_class];
+    slab->next = NULL;
+    slab->prev = NULL;
+    slab->free_objects = NULL;
+    slab->used = 0;
+    slab->capacity =
+        (MEMMGR_HEAP_SLAB_SIZE - xHeapStructSize - memmgr_heap_slab_header_size) / stride;
+    slab->stride = stride;
+    slab->size_class = size_class;
+
+    /* Link objects so that they are handed out in address order */
+    uint8_t* objects = ((uint8_t*)slab) + memmgr_heap_slab_header_size;
+    for(size_t i = slab->capacity; i > 0; i--) {
+        BlockLink_t* pxObject = (void*)(objects + (i - 1) * stride);
+        pxObject->xBlockSize = stride;
+        pxObject->pxNextFreeBlock = slab->free_objects;
+        slab->free_objects = pxObject;
+    }
+
+    /* Empty slab is free heap as a whole */
+    xFreeBytesRemaining += MEMMGR_HEAP_SLAB_SIZE;
+
+    return slab;
+}
+
+static void memmgr_heap_slab_release(MemmgrHeapSlab* slab) {
+    furi_assert(slab->used == 0);
+    xFreeBytesRemaining -= MEMMGR_HEAP_SLAB_SIZE;
+    prvHeapFree((BlockLink_t*)(((uint8_t*)slab) - xHeapStructSize));
+}
+
+/* Hand cached empty slabs back to the first-fit heap, returns true if any */
+static bool memmgr_heap_slab_reclaim(void) {
+    bool reclaimed = false;
+    for(size_t i = 0; i < COUNT_OF(memmgr_heap_slab_classes); i++) {
+        if(memmgr_heap_slab_classes[i].empty) {
+            memmgr_heap_slab_release(memmgr_heap_slab_classes[i].empty);
+            memmgr_heap_slab_classes[i].empty = NULL;
+            reclaimed = true;
+        }
+    }
+    return reclaimed;
+}
+
+static void* memmgr_heap_slab_malloc(size_t size) {
+    const size_t size_class = memmgr_heap_slab_class_lut[(size + 15) >> 4];
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[size_class];
+
+    MemmgrHeapSlab* slab = slab_class->partial;
+    if(slab == NULL) {
+        slab = slab_class->empty;
+        slab_class->empty = NULL;
+        if(slab == NULL) slab = memmgr_heap_slab_alloc(size_class);
+        /* Out of slabs, let the first-fit heap try with a smaller block */
+        if(slab == NULL) return NULL;
+        memmgr_heap_slab_list_push(&slab_class->partial, slab);
+    }
+
+    BlockLink_t* pxObject = slab->free_objects;
+    slab->free_objects = pxObject->pxNextFreeBlock;
+
+    const size_t offset = ((uint8_t*)pxObject) - ((uint8_t*)slab);
+    pxObject->pxNextFreeBlock = NULL;
+    pxObject->xBlockSize = xBlockAllocatedBit | MEMMGR_HEAP_SLAB_OBJECT_BIT |
+                           (offset << MEMMGR_HEAP_SLAB_OFFSET_SHIFT) | slab->stride;
+
+    if(slab->used == 0) xFreeBytesRemaining -= memmgr_heap_slab_overhead(slab);
+    slab->used++;
+    if(slab->used == slab->capacity) {
+        memmgr_heap_slab_list_remove(&slab_class->partial, slab);
+    }
+
+    xFreeBytesRemaining -= slab->stride;
+    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+    }
+
+    return ((uint8_t*)pxObject) + xHeapStructSize;
+}
+
+static void memmgr_heap_slab_free(BlockLink_t* pxObject) {
+    const size_t offset =
+        (pxObject->xBlockSize >> MEMMGR_HEAP_SLAB_OFFSET_SHIFT) & MEMMGR_HEAP_SLAB_OFFSET_MASK;
+    MemmgrHeapSlab* slab = (void*)(((uint8_t*)pxObject) - offset);
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[slab->size_class];
+
+    furi_assert(slab->used > 0);
+    furi_assert((pxObject->xBlockSize & MEMMGR_HEAP_SLAB_STRIDE_MASK) == slab->stride);
+
+    memset(((uint8_t*)pxObject) + xHeapStructSize, 0, slab->stride - xHeapStructSize);
+    pxObject->xBlockSize = slab->stride;
+    pxObject->pxNextFreeBlock = slab->free_objects;
+    slab->free_objects = pxObject;
+    xFreeBytesRemaining += slab->stride;
+
+    if(slab->used == slab->capacity) {
+        memmgr_heap_slab_list_push(&slab_class->partial, slab);
+    }
+    slab->used--;
+
+    if(slab->used == 0) {
+        xFreeBytesRemaining += memmgr_heap_slab_overhead(slab);
+        memmgr_heap_slab_list_remove(&slab_class->partial, slab);
+        const bool heap_is_low = xFreeBytesRemaining < MEMMGR_HEAP_SLAB_RECLAIM_THRESHOLD;
+        if(slab_class->empty == NULL && !heap_is_low) {
+            slab_class->empty = slab;
+        } else {
+            memmgr_heap_slab_release(slab);
+        }
+    }
+}
+
+static inline size_t memmgr_heap_site_bucket(size_t size) {
+    if(size <= 16) return 0;
+    size_t bucket = (32 - __builtin_clz(size - 1)) - 4;
+    return MIN(bucket, (size_t)(MEMMGR_HEAP_HISTOGRAM_BUCKETS - 1));
+}
+
+static inline uint32_t* memmgr_heap_site_tag_get(BlockLink_t* pxBlock) {
+    return (uint32_t*)(((uint8_t*)pxBlock) + memmgr_heap_block_size(pxBlock) - sizeof(uint32_t));
+}
+
+static size_t memmgr_heap_site_get_index(uint32_t address) {
+    const size_t hash = (address * 2654435761UL) >> 25;
+    size_t free_index = MEMMGR_HEAP_SITES_OTHER;
+
+    for(size_t i = 0; i < MEMMGR_HEAP_SITES_PROBE; i++) {
+        const size_t index = (hash + i) & (MEMMGR_HEAP_SITES_MAX - 1);
+        if(memmgr_heap_sites[index].address == address) return index;
+        /* Sites without live blocks are not referenced by any tag */
+        if(memmgr_heap_sites[index].live_blocks == 0 && free_index == MEMMGR_HEAP_SITES_OTHER) {
+            free_index = index;
+        }
+    }
+
+    if(free_index != MEMMGR_HEAP_SITES_OTHER) {
+        memmgr_heap_sites[free_index].address = address;
+        memmgr_heap_sites[free_index].live_bytes = 0;
+    }
+
+    return free_index;
+}
+
+static void memmgr_heap_site_tag(BlockLink_t* pxBlock, const void* pvSite) {
+    const size_t size = memmgr_heap_block_size(pxBlock);
+    const size_t index = memmgr_heap_site_get_index((uint32_t)pvSite);
+
+    *memmgr_heap_site_tag_get(pxBlock) = index;
+    pxBlock->xBlockSize |= MEMMGR_HEAP_SITE_TAG_BIT;
+
+    memmgr_heap_sites[index].live_bytes += size;
+    memmgr_heap_sites[index].live_blocks++;
+    memmgr_heap_site_histogram[memmgr_heap_site_bucket(size)]++;
+    memmgr_heap_site_tagged_blocks++;
+}
+
+static void memmgr_heap_site_untag(BlockLink_t* pxBlock) {
+    const size_t size = memmgr_heap_block_size(pxBlock);
+    const size_t index = *memmgr_heap_site_tag_get(pxBlock);
+    furi_assert(index <= MEMMGR_HEAP_SITES_OTHER);
+    furi_assert(memmgr_heap_sites[index].live_blocks > 0);
+
+    memmgr_heap_sites[index].live_bytes -= size;
+    memmgr_heap_sites[index].live_blocks--;
+    memmgr_heap_site_histogram[memmgr_heap_site_bucket(size)]--;
+    memmgr_heap_site_tagged_blocks--;
+
+    pxBlock->xBlockSize &= ~MEMMGR_HEAP_SITE_TAG_BIT;
+}
+
+static void memmgr_heap_site_sample(size_t max_free_block, bool force) {
+    const uint32_t tick = xTaskGetTickCount();
+
+    if(!force && memmgr_heap_samples_count) {
+        const size_t last = (memmgr_heap_samples_head + MEMMGR_HEAP_SAMPLES - 1) %
+                            MEMMGR_HEAP_SAMPLES;
+        if(tick - memmgr_heap_samples[last].tick < MEMMGR_HEAP_SAMPLE_PERIOD) return;
+    }
+
+    MemmgrHeapSample* sample = &memmgr_heap_samples[memmgr_heap_samples_head];
+    sample->tick = tick;
+    sample->free_heap = xFreeBytesRemaining;
+    sample->max_free_block = max_free_block;
+
+    memmgr_heap_samples_head = (memmgr_heap_samples_head + 1) % MEMMGR_HEAP_SAMPLES;
+    if(memmgr_heap_samples_count < MEMMGR_HEAP_SAMPLES) memmgr_heap_samples_count++;
+}
+
+static size_t prvHeapGetMaxFreeBlock(void) {
     size_t max_free_size = 0;
-    BlockLink_t* pxBlock;
-    vTaskSuspendAll();
+    BlockLink_t* pxBlock = xStart.pxNextFreeBlock;
 
-    pxBlock = xStart.pxNextFreeBlock;
     while(pxBlock->pxNextFreeBlock != NULL) {
         if(pxBlock->xBlockSize > max_free_size) {
             max_free_size = pxBlock->xBlockSize;
@@ -232,10 +525,92 @@ size_t memmgr_heap_get_max_free_block(void) {
         pxBlock = pxBlock->pxNextFreeBlock;
     }
 
+    return max_free_size;
+}
+
+size_t memmgr_heap_get_max_free_block(void) {
+    size_t max_free_size = 0;
+    vTaskSuspendAll();
+
+    max_free_size = prvHeapGetMaxFreeBlock();
+    /* Heap is getting tight, give cached empty slabs back */
+    if(max_free_size < MEMMGR_HEAP_SLAB_RECLAIM_THRESHOLD && memmgr_heap_slab_reclaim()) {
+        max_free_size = prvHeapGetMaxFreeBlock();
+    }
+
+    if(memmgr_heap_site_trace_enabled) {
+        memmgr_heap_site_sample(max_free_size, false);
+    }
+
     xTaskResumeAll();
     return max_free_size;
 }
 
+void memmgr_heap_enable_site_trace(void) {
+    vTaskSuspendAll();
+    {
+        /* Start over unless traced blocks still refer to the table */
+        if(memmgr_heap_site_tagged_blocks == 0) {
+            memset(memmgr_heap_sites, 0, sizeof(memmgr_heap_sites));
+            memset(memmgr_heap_site_histogram, 0, sizeof(memmgr_heap_site_histogram));
+            memmgr_heap_samples_head = 0;
+            memmgr_heap_samples_count = 0;
+        }
+        memmgr_heap_site_trace_enabled = true;
+    }
+    (void)xTaskResumeAll();
+}
+
+void memmgr_heap_disable_site_trace(void) {
+    memmgr_heap_site_trace_enabled = false;
+}
+
+void memmgr_heap_get_sites_snapshot(MemmgrHeapSitesSnapshot* snapshot) {
+    furi_check(snapshot);
+    memset(snapshot, 0, sizeof(MemmgrHeapSitesSnapshot));
+
+    vTaskSuspendAll();
+    {
+        snapshot->enabled = memmgr_heap_site_trace_enabled;
+        snapshot->free_heap = xFreeBytesRemaining;
+        snapshot->max_free_block = prvHeapGetMaxFreeBlock();
+        if(snapshot->free_heap) {
+            snapshot->fragmentation =
+                1000 - (uint64_t)snapshot->max_free_block * 1000 / snapshot->free_heap;
+        }
+        memcpy(
+            snapshot->histogram, memmgr_heap_site_histogram, sizeof(memmgr_heap_site_histogram));
+
+        /* Keep the top sites sorted by live bytes */
+        for(size_t i = 0; i < COUNT_OF(memmgr_heap_sites); i++) {
+            const MemmgrHeapSite* site = &memmgr_heap_sites[i];
+            if(site->live_blocks == 0) continue;
+
+            size_t position = snapshot->sites_count;
+            while(position > 0 && snapshot->sites[position - 1].live_bytes < site->live_bytes) {
+                if(position < MEMMGR_HEAP_SITES_TOP) {
+                    snapshot->sites[position] = snapshot->sites[position - 1];
+                }
+                position--;
+            }
+            if(position < MEMMGR_HEAP_SITES_TOP) {
+                snapshot->sites[position] = *site;
+                if(snapshot->sites_count < MEMMGR_HEAP_SITES_TOP) snapshot->sites_count++;
+            }
+        }
+
+        memmgr_heap_site_sample(snapshot->max_free_block, true);
+        for(size_t i = 0; i < memmgr_heap_samples_count; i++) {
+            const size_t index = (memmgr_heap_samples_head + MEMMGR_HEAP_SAMPLES -
+                                  memmgr_heap_samples_count + i) %
+                                 MEMMGR_HEAP_SAMPLES;
+            snapshot->samples[i] = memmgr_heap_samples[index];
+        }
+        snapshot->samples_count = memmgr_heap_samples_count;
+    }
+    (void)xTaskResumeAll();
+}
+
 void memmgr_heap_printf_free_blocks(void) {
     BlockLink_t* pxBlock;
     //can be enabled once we can do printf with a locked scheduler
@@ -336,9 +711,120 @@ static void print_heap_free(void* ptr) {
 #endif
 /*-----------------------------------------------------------*/
 
-void* pvPortMalloc(size_t xWantedSize) {
+static void* prvHeapMalloc(size_t xWantedSize) {
     BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
     void* pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top bit is
+    set.  The top bit of the block size member of the BlockLink_t structure
+    is used to determine who owns the block - the application or the
+    kernel, so it must be free. */
+    if((xWantedSize & xBlockAllocatedBit) == 0) {
+        /* The wanted size is increased so it can contain a BlockLink_t
+        structure in addition to the requested amount of bytes. */
+        if(xWantedSize > 0) {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+            of bytes. */
+            if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+                /* Byte alignment required. */
+                xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+                configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
+            /* Traverse the list from the start (lowest address) block until
+            one of adequate size is found. */
+            pxPreviousBlock = &xStart;
+            pxBlock = xStart.pxNextFreeBlock;
+            while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            /* If the end marker was reached then a block of adequate size
+            was not found. */
+            if(pxBlock != pxEnd) {
+                /* Return the memory space pointed to - jumping over the
+                BlockLink_t structure at its start. */
+                pvReturn = (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
+
+                /* This block is being returned for use so must be taken out
+                of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                two. */
+                if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+                    /* This block is to be split into two.  Create a new
+                    block following the number of bytes requested. The void
+                    cast is used to prevent byte alignment warnings from the
+                    compiler. */
+                    pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+                    configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+                    /* Calculate the sizes of two blocks split from the
+                    single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    prvInsertBlockIntoFreeList(pxNewBlockLink);
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block is being returned - it is allocated and owned
+                by the application and has no "next" block. */
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapFree(BlockLink_t* pxLink) {
+    /* The block is being returned to the heap - it is no longer
+    allocated. */
+    pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+    furi_assert((size_t)pxLink >= SRAM_BASE);
+    furi_assert((size_t)pxLink < SRAM_BASE + 1024 * 256);
+    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
+    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
+
+    /* Add this block to the list of free blocks. */
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    memset(((uint8_t*)pxLink) + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize);
+    prvInsertBlockIntoFreeList(pxLink);
+}
+/*-----------------------------------------------------------*/
+
+void* memmgr_heap_malloc(size_t xWantedSize, const void* pvSite) {
+    void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
 
     if(FURI_IS_IRQ_MODE()) {
@@ -368,104 +854,39 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
-        /* Check the requested block size is not so large that the top bit is
-        set.  The top bit of the block size member of the BlockLink_t structure
-        is used to determine who owns the block - the application or the
-        kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
-            /* The wanted size is increased so it can contain a BlockLink_t
-            structure in addition to the requested amount of bytes. */
-            if(xWantedSize > 0) {
-                xWantedSize += xHeapStructSize;
-
-                /* Ensure that blocks are always aligned to the required number
-                of bytes. */
-                if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
-                    /* Byte alignment required. */
-                    xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
-                    configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        /* Traced blocks carry the site tag in their last word */
+        const bool site_trace = memmgr_heap_site_trace_enabled && (xWantedSize > 0);
+        const size_t xAllocSize = site_trace ? xWantedSize + sizeof(uint32_t) : xWantedSize;
 
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
-                /* Traverse the list from the start (lowest address) block until
-                one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
-                while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
-
-                /* If the end marker was reached then a block of adequate size
-                was not found. */
-                if(pxBlock != pxEnd) {
-                    /* Return the memory space pointed to - jumping over the
-                    BlockLink_t structure at its start. */
-                    pvReturn =
-                        (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
-
-                    /* This block is being returned for use so must be taken out
-                    of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                    two. */
-                    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
-                        /* This block is to be split into two.  Create a new
-                        block following the number of bytes requested. The void
-                        cast is used to prevent byte alignment warnings from the
-                        compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                        single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList(pxNewBlockLink);
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+        /* Small blocks come from the size-class slabs */
+        if((xAllocSize > 0) && (xAllocSize <= MEMMGR_HEAP_SLAB_OBJECT_MAX)) {
+            pvReturn = memmgr_heap_slab_malloc(xAllocSize);
+        }
 
-                    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+        if(pvReturn == NULL) {
+            pvReturn = prvHeapMalloc(xAllocSize);
+        }
 
-                    /* The block is being returned - it is allocated and owned
-                    by the application and has no "next" block. */
-                    pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
+        /* Cached empty slabs may be just what the first-fit heap is missing */
+        if((pvReturn == NULL) && (xAllocSize > 0) && memmgr_heap_slab_reclaim()) {
+            pvReturn = prvHeapMalloc(xAllocSize);
+        }
 
+        if(pvReturn != NULL) {
+            BlockLink_t* pxBlock = (void*)(((uint8_t*)pvReturn) - xHeapStructSize);
+            if(site_trace) {
+                memmgr_heap_site_tag(pxBlock, pvSite);
+            }
+            traceMALLOC(pvReturn, memmgr_heap_block_size(pxBlock));
 #ifdef HEAP_PRINT_DEBUG
-                    print_heap_block = pxBlock;
+            print_heap_block = pxBlock;
 #endif
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        } else {
-            mtCOVERAGE_TEST_MARKER();
         }
-
-        traceMALLOC(pvReturn, xWantedSize);
     }
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
-    print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
+    print_heap_malloc(print_heap_block, memmgr_heap_block_size(print_heap_block));
 #endif
 
 #if(configUSE_MALLOC_FAILED_HOOK == 1)
@@ -487,6 +908,11 @@ void* pvPortMalloc(size_t xWantedSize) {
 }
 /*-----------------------------------------------------------*/
 
+void* pvPortMalloc(size_t xWantedSize) {
+    return memmgr_heap_malloc(xWantedSize, __builtin_return_address(0));
+}
+/*-----------------------------------------------------------*/
+
 void vPortFree(void* pv) {
     uint8_t* puc = (uint8_t*)pv;
     BlockLink_t* pxLink;
@@ -509,26 +935,23 @@ void vPortFree(void* pv) {
 
         if((pxLink->xBlockSize & xBlockAllocatedBit) != 0) {
             if(pxLink->pxNextFreeBlock == NULL) {
-                /* The block is being returned to the heap - it is no longer
-                allocated. */
-                pxLink->xBlockSize &= ~xBlockAllocatedBit;
-
 #ifdef HEAP_PRINT_DEBUG
                 print_heap_free(pxLink);
 #endif
 
                 vTaskSuspendAll();
                 {
-                    furi_assert((size_t)pv >= SRAM_BASE);
-                    furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
-                    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
-                    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
-
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE(pv, pxLink->xBlockSize);
-                    memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
-                    prvInsertBlockIntoFreeList((BlockLink_t*)pxLink);
+                    traceFREE(pv, memmgr_heap_block_size(pxLink));
+
+                    if(pxLink->xBlockSize & MEMMGR_HEAP_SITE_TAG_BIT) {
+                        memmgr_heap_site_untag(pxLink);
+                    }
+
+                    if(pxLink->xBlockSize & MEMMGR_HEAP_SLAB_OBJECT_BIT) {
+                        memmgr_heap_slab_free(pxLink);
+                    } else {
+                        prvHeapFree(pxLink);
+                    }
                 }
                 (void)xTaskResumeAll();
             } else {
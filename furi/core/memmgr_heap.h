@@ -6,6 +6,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 #include <core/thread.h>
 
 #ifdef __cplusplus
@@ -14,6 +15,37 @@ extern "C" {
 
 #define MEMMGR_HEAP_UNKNOWN 0xFFFFFFFF
 
+#define MEMMGR_HEAP_HISTOGRAM_BUCKETS (12U) /**< Live block sizes, 16 bytes to 16K and above */
+#define MEMMGR_HEAP_SITES_TOP         (10U) /**< Sites in the snapshot, by live bytes */
+#define MEMMGR_HEAP_SAMPLES           (16U) /**< Largest free block history length */
+
+/** Allocation site: code address that called malloc */
+typedef struct {
+    uint32_t address; /**< Return address of the allocation call, 0 for untracked sites */
+    uint32_t live_bytes; /**< Bytes taken by live blocks, with heap overhead */
+    uint32_t live_blocks; /**< Number of live blocks */
+} MemmgrHeapSite;
+
+/** Largest free block sample */
+typedef struct {
+    uint32_t tick; /**< Kernel tick of the sample */
+    uint32_t free_heap; /**< Free heap bytes */
+    uint32_t max_free_block; /**< Largest contiguous free block */
+} MemmgrHeapSample;
+
+/** Heap allocation site snapshot */
+typedef struct {
+    bool enabled; /**< Site tracing is on */
+    uint32_t free_heap; /**< Free heap bytes */
+    uint32_t max_free_block; /**< Largest contiguous free block */
+    uint32_t fragmentation; /**< Share of free heap outside the largest block, per mille */
+    uint32_t histogram[MEMMGR_HEAP_HISTOGRAM_BUCKETS]; /**< Traced live blocks, up to 16 << n */
+    size_t sites_count; /**< Number of valid sites */
+    MemmgrHeapSite sites[MEMMGR_HEAP_SITES_TOP]; /**< Top sites, largest live bytes first */
+    size_t samples_count; /**< Number of valid samples */
+    MemmgrHeapSample samples[MEMMGR_HEAP_SAMPLES]; /**< Largest free block history, oldest first */
+} MemmgrHeapSitesSnapshot;
+
 /** Memmgr heap enable thread allocation tracking
  *
  * @param      thread_id  - thread id to track
@@ -44,6 +76,27 @@ size_t memmgr_heap_get_max_free_block(void);
  */
 void memmgr_heap_printf_free_blocks(void);
 
+/** Memmgr heap enable allocation site tracing
+ *
+ * Every block allocated from now on is tagged with the caller address and
+ * accounted to its site. Costs 4 bytes per traced block.
+ */
+void memmgr_heap_enable_site_trace(void);
+
+/** Memmgr heap disable allocation site tracing
+ *
+ * Blocks that are already traced stay accounted until they are freed.
+ */
+void memmgr_heap_disable_site_trace(void);
+
+/** Memmgr heap get allocation site snapshot
+ *
+ * Also records a largest free block sample.
+ *
+ * @param      snapshot  - snapshot to fill
+ */
+void memmgr_heap_get_sites_snapshot(MemmgrHeapSitesSnapshot* snapshot);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,12 +1,20 @@
 #include "pubsub.h"
 #include "check.h"
+#include "common_defines.h"
+#include "kernel.h"
+#include "message_queue.h"
 #include "mutex.h"
 
+#include <string.h>
 #include <m-list.h>
 
+typedef struct FuriPubSubQueue FuriPubSubQueue;
+
 struct FuriPubSubSubscription {
     FuriPubSubCallback callback;
     void* callback_context;
+    // Queued delivery state, NULL if the callback is called by the publisher
+    FuriPubSubQueue* queue;
 };
 
 LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
@@ -14,8 +22,108 @@ LIST_DEF(FuriPubSubSubscriptionList, FuriPubSubSubscription, M_POD_OPLIST);
 struct FuriPubSub {
     FuriPubSubSubscriptionList_t items;
     FuriMutex* mutex;
+    FuriPubSubStats stats;
+};
+
+typedef struct {
+    uint32_t tick;
+    uint8_t message[];
+} FuriPubSubQueueItem;
+
+struct FuriPubSubQueue {
+    FuriPubSubCallback callback;
+    void* callback_context;
+
+    FuriEventLoop* event_loop;
+    FuriPubSubQueuePolicy policy;
+    size_t message_size;
+
+    // FIFO: queued messages, latest: a token while the latest message is pending
+    FuriMessageQueue* message_queue;
+    // FIFO: staging item, latest: the latest message
+    FuriPubSubQueueItem* item;
+    // Item handed to the callback
+    FuriPubSubQueueItem* delivery;
+    bool pending;
+
+    uint32_t latency_max;
 };
 
+static void furi_pubsub_queue_update_latency(FuriPubSubQueue* queue) {
+    const uint32_t latency = furi_get_tick() - queue->delivery->tick;
+    queue->latency_max = MAX(queue->latency_max, latency);
+}
+
+static bool furi_pubsub_queue_take_latest(FuriPubSubQueue* queue) {
+    FURI_CRITICAL_ENTER();
+    const bool pending = queue->pending;
+    if(pending) {
+        memcpy(queue->delivery, queue->item, sizeof(FuriPubSubQueueItem) + queue->message_size);
+        queue->pending = false;
+    }
+    FURI_CRITICAL_EXIT();
+
+    return pending;
+}
+
+static bool furi_pubsub_queue_put_latest(FuriPubSubQueue* queue, const void* message) {
+    FURI_CRITICAL_ENTER();
+    const bool pending = queue->pending;
+    queue->item->tick = furi_get_tick();
+    memcpy(queue->item->message, message, queue->message_size);
+    queue->pending = true;
+    FURI_CRITICAL_EXIT();
+
+    return pending;
+}
+
+static bool furi_pubsub_queue_event_callback(FuriEventLoopObject* object, void* context) {
+    FuriPubSubQueue* queue = context;
+    furi_assert(queue->message_queue == object);
+
+    if(queue->policy == FuriPubSubQueuePolicyLatest) {
+        uint8_t token;
+        furi_check(furi_message_queue_get(queue->message_queue, &token, 0) == FuriStatusOk);
+        if(!furi_pubsub_queue_take_latest(queue)) return true;
+    } else {
+        furi_check(
+            furi_message_queue_get(queue->message_queue, queue->delivery, 0) == FuriStatusOk);
+    }
+
+    furi_pubsub_queue_update_latency(queue);
+    queue->callback(queue->delivery->message, queue->callback_context);
+
+    return true;
+}
+
+// Called by the publisher with the pubsub mutex held, never blocks
+static void
+    furi_pubsub_queue_put(FuriPubSub* pubsub, FuriPubSubQueue* queue, const void* message) {
+    if(queue->policy == FuriPubSubQueuePolicyLatest) {
+        if(furi_pubsub_queue_put_latest(queue, message)) {
+            pubsub->stats.coalesced++;
+        } else {
+            const uint8_t token = 0;
+            furi_check(furi_message_queue_put(queue->message_queue, &token, 0) == FuriStatusOk);
+        }
+    } else {
+        queue->item->tick = furi_get_tick();
+        memcpy(queue->item->message, message, queue->message_size);
+        if(furi_message_queue_put(queue->message_queue, queue->item, 0) != FuriStatusOk) {
+            pubsub->stats.dropped++;
+        }
+    }
+}
+
+static void furi_pubsub_queue_free(FuriPubSubQueue* queue) {
+    furi_event_loop_unsubscribe(queue->event_loop, queue->message_queue);
+    furi_message_queue_free(queue->message_queue);
+
+    free(queue->item);
+    free(queue->delivery);
+    free(queue);
+}
+
 FuriPubSub* furi_pubsub_alloc(void) {
     FuriPubSub* pubsub = malloc(sizeof(FuriPubSub));
 
@@ -50,6 +158,58 @@ FuriPubSubSubscription*
     // initialize item
     item->callback = callback;
     item->callback_context = callback_context;
+    item->queue = NULL;
+
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+
+    return item;
+}
+
+FuriPubSubSubscription* furi_pubsub_subscribe_queued(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubQueuePolicy policy,
+    FuriPubSubCallback callback,
+    void* callback_context) {
+    furi_check(pubsub);
+    furi_check(event_loop);
+    furi_check(message_size);
+    furi_check(queue_size || policy == FuriPubSubQueuePolicyLatest);
+    furi_check(policy <= FuriPubSubQueuePolicyLatest);
+    furi_check(callback);
+
+    FuriPubSubQueue* queue = malloc(sizeof(FuriPubSubQueue));
+    const size_t item_size = sizeof(FuriPubSubQueueItem) + message_size;
+
+    queue->callback = callback;
+    queue->callback_context = callback_context;
+    queue->event_loop = event_loop;
+    queue->policy = policy;
+    queue->message_size = message_size;
+    queue->item = malloc(item_size);
+    queue->delivery = malloc(item_size);
+
+    if(policy == FuriPubSubQueuePolicyLatest) {
+        queue->message_queue = furi_message_queue_alloc(1, sizeof(uint8_t));
+    } else {
+        queue->message_queue = furi_message_queue_alloc(queue_size, item_size);
+    }
+
+    furi_event_loop_subscribe_message_queue(
+        event_loop,
+        queue->message_queue,
+        FuriEventLoopEventIn,
+        furi_pubsub_queue_event_callback,
+        queue);
+
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+
+    FuriPubSubSubscription* item = FuriPubSubSubscriptionList_push_raw(pubsub->items);
+    item->callback = callback;
+    item->callback_context = callback_context;
+    item->queue = queue;
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
 
@@ -61,6 +221,7 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
     furi_assert(pubsub_subscription);
 
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+    FuriPubSubQueue* queue = NULL;
     bool result = false;
 
     // iterate over items
@@ -71,6 +232,10 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
         // if the iterator is equal to our element
         if(item == pubsub_subscription) {
+            queue = item->queue;
+            if(queue) {
+                pubsub->stats.latency_max = MAX(pubsub->stats.latency_max, queue->latency_max);
+            }
             FuriPubSubSubscriptionList_remove(pubsub->items, it);
             result = true;
             break;
@@ -79,6 +244,11 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
     furi_check(result);
+
+    // Not reachable by publishers anymore, undelivered messages are discarded
+    if(queue) {
+        furi_pubsub_queue_free(queue);
+    }
 }
 
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
@@ -86,12 +256,38 @@ void furi_pubsub_publish(FuriPubSub* pubsub, void* message) {
 
     furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
 
+    pubsub->stats.published++;
+
     // iterate over subscribers
     FuriPubSubSubscriptionList_it_t it;
     for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
         FuriPubSubSubscriptionList_next(it)) {
         const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
-        item->callback(message, item->callback_context);
+        if(item->queue) {
+            furi_pubsub_queue_put(pubsub, item->queue, message);
+        } else {
+            item->callback(message, item->callback_context);
+        }
+    }
+
+    furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
+}
+
+void furi_pubsub_get_stats(FuriPubSub* pubsub, FuriPubSubStats* stats) {
+    furi_check(pubsub);
+    furi_check(stats);
+
+    furi_check(furi_mutex_acquire(pubsub->mutex, FuriWaitForever) == FuriStatusOk);
+
+    *stats = pubsub->stats;
+
+    FuriPubSubSubscriptionList_it_t it;
+    for(FuriPubSubSubscriptionList_it(it, pubsub->items); !FuriPubSubSubscriptionList_end_p(it);
+        FuriPubSubSubscriptionList_next(it)) {
+        const FuriPubSubSubscription* item = FuriPubSubSubscriptionList_cref(it);
+        if(item->queue) {
+            stats->latency_max = MAX(stats->latency_max, item->queue->latency_max);
+        }
     }
 
     furi_check(furi_mutex_release(pubsub->mutex) == FuriStatusOk);
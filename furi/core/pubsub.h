@@ -4,6 +4,8 @@
  */
 #pragma once
 
+#include "event_loop.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +19,20 @@ typedef struct FuriPubSub FuriPubSub;
 /** FuriPubSubSubscription type */
 typedef struct FuriPubSubSubscription FuriPubSubSubscription;
 
+/** Queued subscription delivery policy */
+typedef enum {
+    FuriPubSubQueuePolicyFifo, /**< Deliver every message in order, drop new ones when full */
+    FuriPubSubQueuePolicyLatest, /**< Deliver only the latest message, for state topics */
+} FuriPubSubQueuePolicy;
+
+/** FuriPubSub delivery statistics */
+typedef struct {
+    uint32_t published; /**< Messages published */
+    uint32_t dropped; /**< Messages lost because a subscriber queue was full */
+    uint32_t coalesced; /**< Messages replaced by a newer one before delivery */
+    uint32_t latency_max; /**< Max ticks between publishing and queued delivery */
+} FuriPubSubStats;
+
 /** Allocate FuriPubSub
  *
  * Reentrable, Not threadsafe, one owner
@@ -44,6 +60,34 @@ void furi_pubsub_free(FuriPubSub* pubsub);
 FuriPubSubSubscription*
     furi_pubsub_subscribe(FuriPubSub* pubsub, FuriPubSubCallback callback, void* callback_context);
 
+/** Subscribe to FuriPubSub with queued delivery
+ *
+ * Published messages are copied to the subscription queue and the callback is
+ * called by the given event loop, so the publisher never waits for the subscriber.
+ * Must be called and unsubscribed from the event loop thread.
+ *
+ * Threadsafe, Reentrable
+ *
+ * @param      pubsub            pointer to FuriPubSub instance
+ * @param      event_loop        pointer to FuriEventLoop instance to deliver messages
+ * @param[in]  message_size      size of the published messages
+ * @param[in]  queue_size        max number of undelivered messages, ignored by
+ *                               FuriPubSubQueuePolicyLatest
+ * @param[in]  policy            delivery policy
+ * @param[in]  callback          The callback
+ * @param      callback_context  The callback context
+ *
+ * @return     pointer to FuriPubSubSubscription instance
+ */
+FuriPubSubSubscription* furi_pubsub_subscribe_queued(
+    FuriPubSub* pubsub,
+    FuriEventLoop* event_loop,
+    size_t message_size,
+    size_t queue_size,
+    FuriPubSubQueuePolicy policy,
+    FuriPubSubCallback callback,
+    void* callback_context);
+
 /** Unsubscribe from FuriPubSub
  * 
  * No use of `pubsub_subscription` allowed after call of this method
@@ -63,6 +107,15 @@ void furi_pubsub_unsubscribe(FuriPubSub* pubsub, FuriPubSubSubscription* pubsub_
  */
 void furi_pubsub_publish(FuriPubSub* pubsub, void* message);
 
+/** Get FuriPubSub delivery statistics
+ *
+ * Threadsafe, Reentrable.
+ *
+ * @param      pubsub  pointer to FuriPubSub instance
+ * @param[out] stats   pointer to statistics to fill
+ */
+void furi_pubsub_get_stats(FuriPubSub* pubsub, FuriPubSubStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
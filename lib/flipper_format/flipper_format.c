@@ -8,16 +8,134 @@
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
 
+#include <stdlib.h>
+#include <m-array.h>
+
 /********************************** Private **********************************/
+typedef struct {
+    uint32_t hash;
+    uint32_t offset;
+} FlipperFormatKeyIndexEntry;
+
+ARRAY_DEF(FlipperFormatKeyIndex, FlipperFormatKeyIndexEntry, M_POD_OPLIST); // NOLINT
+
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+
+    bool key_index_enabled;
+    bool key_index_valid;
+    size_t key_index_stream_size;
+    FlipperFormatKeyIndex_t key_index;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
 static const char* const flipper_format_version_key = "Version";
 
+static uint32_t flipper_format_key_hash(const char* key) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    while(*key) {
+        hash ^= (uint8_t)*key++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static int flipper_format_key_index_compare(const void* a, const void* b) {
+    const FlipperFormatKeyIndexEntry* entry_a = a;
+    const FlipperFormatKeyIndexEntry* entry_b = b;
+
+    if(entry_a->hash != entry_b->hash) return entry_a->hash < entry_b->hash ? -1 : 1;
+    if(entry_a->offset != entry_b->offset) return entry_a->offset < entry_b->offset ? -1 : 1;
+    return 0;
+}
+
+static inline void flipper_format_key_index_reset(FlipperFormat* flipper_format) {
+    flipper_format->key_index_valid = false;
+}
+
+static bool flipper_format_key_index_build(FlipperFormat* flipper_format) {
+    Stream* stream = flipper_format->stream;
+    FlipperFormatKeyIndex_reset(flipper_format->key_index);
+
+    FuriString* key = furi_string_alloc();
+    size_t position = stream_tell(stream);
+    bool result = stream_rewind(stream);
+
+    // One pass over the file, same key parser as the sequential lookup
+    while(result && flipper_format_stream_read_next_key(stream, key)) {
+        FlipperFormatKeyIndexEntry* entry =
+            FlipperFormatKeyIndex_push_new(flipper_format->key_index);
+        entry->hash = flipper_format_key_hash(furi_string_get_cstr(key));
+        entry->offset = stream_tell(stream) - furi_string_size(key) - 2;
+    }
+
+    if(!stream_seek(stream, position, StreamOffsetFromStart)) result = false;
+    furi_string_free(key);
+
+    // Same hash keys are ordered by position
+    const size_t count = FlipperFormatKeyIndex_size(flipper_format->key_index);
+    if(count > 1) {
+        qsort(
+            FlipperFormatKeyIndex_get(flipper_format->key_index, 0),
+            count,
+            sizeof(FlipperFormatKeyIndexEntry),
+            flipper_format_key_index_compare);
+    }
+
+    flipper_format->key_index_stream_size = stream_size(stream);
+    flipper_format->key_index_valid = result;
+
+    return result;
+}
+
+/**
+ * Move the stream to the first occurrence of the key at or after the current
+ * position, or to the end of the stream if there is none. The sequential lookup
+ * that follows then finds the key right away. Hash collisions are harmless: the
+ * candidate is never past the wanted key, the lookup just reads a few more keys.
+ */
+static void flipper_format_key_index_seek(FlipperFormat* flipper_format, const char* key) {
+    if(!flipper_format->key_index_enabled || flipper_format->strict_mode) return;
+
+    Stream* stream = flipper_format->stream;
+    if(!flipper_format->key_index_valid ||
+       flipper_format->key_index_stream_size != stream_size(stream)) {
+        if(!flipper_format_key_index_build(flipper_format)) return;
+    }
+
+    const FlipperFormatKeyIndexEntry wanted = {
+        .hash = flipper_format_key_hash(key),
+        .offset = stream_tell(stream),
+    };
+
+    // Lower bound of (hash, position)
+    const size_t count = FlipperFormatKeyIndex_size(flipper_format->key_index);
+    size_t low = 0;
+    size_t high = count;
+    while(low < high) {
+        size_t middle = (low + high) / 2;
+        if(flipper_format_key_index_compare(
+               FlipperFormatKeyIndex_cget(flipper_format->key_index, middle), &wanted) < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    const FlipperFormatKeyIndexEntry* entry =
+        (low < count) ? FlipperFormatKeyIndex_cget(flipper_format->key_index, low) : NULL;
+    if(entry && entry->hash == wanted.hash) {
+        stream_seek(stream, entry->offset, StreamOffsetFromStart);
+    } else {
+        stream_seek(stream, 0, StreamOffsetFromEnd);
+    }
+}
+
 Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
+    // Raw access may change the contents behind our back
+    flipper_format_key_index_reset(flipper_format);
     return flipper_format->stream;
 }
 
@@ -27,6 +145,7 @@ FlipperFormat* flipper_format_string_alloc(void) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = string_stream_alloc();
     flipper_format->strict_mode = false;
+    FlipperFormatKeyIndex_init(flipper_format->key_index);
     return flipper_format;
 }
 
@@ -34,6 +153,7 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    FlipperFormatKeyIndex_init(flipper_format->key_index);
     return flipper_format;
 }
 
@@ -41,22 +161,26 @@ FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    FlipperFormatKeyIndex_init(flipper_format->key_index);
     return flipper_format;
 }
 
 bool flipper_format_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_buffered_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
 
     bool result =
         file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND);
@@ -88,33 +212,39 @@ bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char*
 
 bool flipper_format_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_buffered_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* path) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW);
 }
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
     stream_free(flipper_format->stream);
+    FlipperFormatKeyIndex_clear(flipper_format->key_index);
     free(flipper_format);
 }
 
@@ -122,6 +252,13 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable) {
+    furi_check(flipper_format);
+    flipper_format->key_index_enabled = enable;
+    flipper_format_key_index_reset(flipper_format);
+    if(!enable) FlipperFormatKeyIndex_reset(flipper_format->key_index);
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -135,6 +272,7 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
+    flipper_format_key_index_seek(flipper_format, key);
     bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
@@ -174,12 +312,17 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_check(flipper_format);
-    return flipper_format_stream_get_value_count(
+    size_t position = stream_tell(flipper_format->stream);
+    flipper_format_key_index_seek(flipper_format, key);
+    bool result = flipper_format_stream_get_value_count(
         flipper_format->stream, key, count, flipper_format->strict_mode);
+    stream_seek(flipper_format->stream, position, StreamOffsetFromStart);
+    return result;
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_check(flipper_format);
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
 }
@@ -192,6 +335,7 @@ bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key,
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -207,6 +351,7 @@ bool flipper_format_write_string_cstr(
         .data = data,
         .data_size = 1,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -217,6 +362,7 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -238,6 +384,7 @@ bool flipper_format_write_hex_uint64(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -248,6 +395,7 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -269,6 +417,7 @@ bool flipper_format_write_uint32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -278,6 +427,7 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -299,6 +449,7 @@ bool flipper_format_write_int32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -308,6 +459,7 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -329,6 +481,7 @@ bool flipper_format_write_bool(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -338,6 +491,7 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -359,6 +513,7 @@ bool flipper_format_write_float(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -368,6 +523,7 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
+    flipper_format_key_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -389,6 +545,7 @@ bool flipper_format_write_hex(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -400,6 +557,7 @@ bool flipper_format_write_comment(FlipperFormat* flipper_format, FuriString* dat
 
 bool flipper_format_write_comment_cstr(FlipperFormat* flipper_format, const char* data) {
     furi_check(flipper_format);
+    flipper_format_key_index_reset(flipper_format);
     return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
 }
 
@@ -411,6 +569,7 @@ bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
         .data = NULL,
         .data_size = 0,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -424,6 +583,7 @@ bool flipper_format_update_string(FlipperFormat* flipper_format, const char* key
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -440,6 +600,7 @@ bool flipper_format_update_string_cstr(
         .data = data,
         .data_size = 1,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -457,6 +618,7 @@ bool flipper_format_update_uint32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -473,6 +635,7 @@ bool flipper_format_update_int32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -489,6 +652,7 @@ bool flipper_format_update_bool(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -505,6 +669,7 @@ bool flipper_format_update_float(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -521,6 +686,7 @@ bool flipper_format_update_hex(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_key_index_reset(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
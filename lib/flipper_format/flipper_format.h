@@ -208,6 +208,18 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/** Enable key index.
+ *
+ * Lookups in non-strict mode seek straight to the key instead of reading the
+ * file line by line. The index is built on the first lookup, takes 8 bytes per
+ * key and is rebuilt after writes. Worth it for large files read out of order.
+ * Disabled by default.
+ *
+ * @param      flipper_format  Pointer to a FlipperFormat instance
+ * @param      enable          True to enable key index
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool enable);
+
 /** Rewind the RW pointer.
  *
  * @param      flipper_format  Pointer to a FlipperFormat instance
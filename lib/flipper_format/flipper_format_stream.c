@@ -122,6 +122,19 @@ bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool str
     return found;
 }
 
+bool flipper_format_stream_read_next_key(Stream* stream, FuriString* key) {
+    bool found = false;
+
+    while(!stream_eof(stream)) {
+        if(flipper_format_stream_read_valid_key(stream, key)) {
+            found = stream_seek(stream, 2, StreamOffsetFromCurrent);
+            break;
+        }
+    }
+
+    return found;
+}
+
 static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
     enum {
         LeadingSpace,
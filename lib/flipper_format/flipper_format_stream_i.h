@@ -29,6 +29,16 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+/**
+ * Read the next key from the current position of the stream.
+ * Position will be at the beginning of the value corresponding to the key, if the key is found, or at the end of the stream.
+ * @param stream 
+ * @param key 
+ * @return true key is found
+ * @return false end of the stream
+ */
+bool flipper_format_stream_read_next_key(Stream* stream, FuriString* key);
+
 #ifdef __cplusplus
 }
 #endif
@@ -98,6 +98,12 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs);
  */
 MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs);
 
+/*
+ * Adds a complete bcode part taking ownership of `data`, which must be
+ * allocated with `malloc()`
+ */
+MJS_PRIVATE void mjs_bcode_commit_data(struct mjs* mjs, char* data, size_t len);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -0,0 +1,140 @@
+#include <furi.h>
+#include <storage/storage.h>
+#include <toolbox/crc32_calc.h>
+
+#include "mjs_bcode.h"
+#include "mjs_bcode_cache.h"
+#include "mjs_core.h"
+#include "mjs_internal.h"
+
+#define TAG "MjsBcodeCache"
+
+#define MJS_BCODE_CACHE_MAGIC (0x43534A4DUL) /* "MJSC" */
+/* Must be incremented on any change of the header or of the bcode format */
+#define MJS_BCODE_CACHE_FORMAT (1UL)
+
+#define MJS_BCODE_NAME_OFFSET \
+    (1 /* OP_BCODE_HEADER */ + sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT)
+
+struct mjs_bcode_cache_header {
+    uint32_t magic;
+    uint32_t format;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t bcode_size;
+};
+
+static void mjs_bcode_cache_get_path(struct mjs* mjs, const char* path, FuriString* cache_path) {
+    furi_string_printf(
+        cache_path,
+        "%s/%08lX.jsc",
+        mjs->bcode_cache_dir,
+        crc32_calc_buffer(0, path, strlen(path)));
+}
+
+/* Different paths may share a cache file, the embedded file name tells them apart */
+static int mjs_bcode_cache_check(const char* bcode, size_t size, const char* path) {
+    mjs_header_item_t total_size;
+    size_t path_size = strlen(path) + 1;
+
+    if(size <= MJS_BCODE_NAME_OFFSET + path_size) return 0;
+    if(bcode[0] != OP_BCODE_HEADER) return 0;
+
+    memcpy(
+        &total_size,
+        bcode + 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEM_TOTAL_SIZE,
+        sizeof(mjs_header_item_t));
+    if(total_size + 1 != size) return 0;
+
+    return memcmp(bcode + MJS_BCODE_NAME_OFFSET, path, path_size) == 0;
+}
+
+MJS_PRIVATE int mjs_bcode_cache_load(struct mjs* mjs, const char* path) {
+    if(mjs->bcode_cache_dir == NULL) return 0;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* cache_file = storage_file_alloc(storage);
+    File* source_file = storage_file_alloc(storage);
+    FuriString* cache_path = furi_string_alloc();
+    struct mjs_bcode_cache_header header;
+    char* bcode = NULL;
+    int loaded = 0;
+
+    mjs_bcode_cache_get_path(mjs, path, cache_path);
+
+    do {
+        if(!storage_file_open(
+               cache_file, furi_string_get_cstr(cache_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        if(storage_file_read(cache_file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != MJS_BCODE_CACHE_MAGIC || header.format != MJS_BCODE_CACHE_FORMAT ||
+           header.version != mjs->bcode_cache_version)
+            break;
+        if(storage_file_size(cache_file) != sizeof(header) + header.bcode_size) break;
+
+        /* Validate the source before allocating anything */
+        if(!storage_file_open(source_file, path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        if(storage_file_size(source_file) != header.source_size) break;
+        if(crc32_calc_file(source_file, NULL, NULL) != header.source_crc) break;
+
+        bcode = malloc(header.bcode_size);
+        if(storage_file_read(cache_file, bcode, header.bcode_size) != header.bcode_size) break;
+        if(!mjs_bcode_cache_check(bcode, header.bcode_size, path)) break;
+
+        mjs_bcode_commit_data(mjs, bcode, header.bcode_size);
+        bcode = NULL;
+        loaded = 1;
+    } while(0);
+
+    if(!loaded) {
+        FURI_LOG_D(TAG, "Miss: %s", path);
+    }
+
+    free(bcode);
+    furi_string_free(cache_path);
+    storage_file_free(source_file);
+    storage_file_free(cache_file);
+    furi_record_close(RECORD_STORAGE);
+
+    return loaded;
+}
+
+MJS_PRIVATE void
+    mjs_bcode_cache_save(struct mjs* mjs, const char* path, const char* src, size_t src_len) {
+    if(mjs->bcode_cache_dir == NULL) return;
+
+    struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    const struct mjs_bcode_cache_header header = {
+        .magic = MJS_BCODE_CACHE_MAGIC,
+        .format = MJS_BCODE_CACHE_FORMAT,
+        .version = mjs->bcode_cache_version,
+        .source_size = src_len,
+        .source_crc = crc32_calc_buffer(0, src, src_len),
+        .bcode_size = bp->data.len,
+    };
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* cache_path = furi_string_alloc();
+    bool success = false;
+
+    mjs_bcode_cache_get_path(mjs, path, cache_path);
+    storage_simply_mkdir(storage, mjs->bcode_cache_dir);
+
+    if(storage_file_open(file, furi_string_get_cstr(cache_path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        success = storage_file_write(file, &header, sizeof(header)) == sizeof(header) &&
+                  storage_file_write(file, bp->data.p, bp->data.len) == bp->data.len;
+    }
+    storage_file_close(file);
+
+    if(!success) {
+        /* Truncated file would be rejected on load anyway, but takes space */
+        FURI_LOG_W(TAG, "Failed to write %s", furi_string_get_cstr(cache_path));
+        storage_simply_remove(storage, furi_string_get_cstr(cache_path));
+    }
+
+    furi_string_free(cache_path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "mjs_internal.h"
+#include "mjs_core.h"
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*
+ * Bcode cache: every successfully parsed file is stored as
+ * `<dir>/<crc32 of path>.jsc`, see `mjs_set_bcode_cache()`. Cache file is
+ * a header followed by the bcode part exactly as it is kept in memory, so it
+ * is read straight into the bcode part buffer.
+ */
+
+/*
+ * Loads bcode of the given file from the cache and commits it as a next bcode
+ * part. Returns 1 on success, 0 if the cache is disabled, missing or stale.
+ */
+MJS_PRIVATE int mjs_bcode_cache_load(struct mjs* mjs, const char* path);
+
+/*
+ * Stores the last bcode part to the cache. `src` and `src_len` are the source
+ * the part was parsed from.
+ */
+MJS_PRIVATE void
+    mjs_bcode_cache_save(struct mjs* mjs, const char* path, const char* src, size_t src_len);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
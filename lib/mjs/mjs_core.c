@@ -63,6 +63,7 @@ void mjs_destroy(struct mjs* mjs) {
     mbuf_free(&mjs->array_buffers);
     free(mjs->error_msg);
     free(mjs->stack_trace);
+    free(mjs->bcode_cache_dir);
     mjs_ffi_args_free_list(mjs);
     gc_arena_destroy(mjs, &mjs->object_arena);
     gc_arena_destroy(mjs, &mjs->property_arena);
@@ -230,6 +231,15 @@ const char* mjs_get_stack_trace(struct mjs* mjs) {
     return mjs->stack_trace;
 }
 
+MJS_PRIVATE void mjs_inline_cache_reset(struct mjs* mjs) {
+#if MJS_INLINE_CACHE_SIZE > 0
+    memset(mjs->prop_cache, 0, sizeof(mjs->prop_cache));
+    memset(mjs->str_cache, 0, sizeof(mjs->str_cache));
+#else
+    (void)mjs;
+#endif
+}
+
 MJS_PRIVATE size_t mjs_get_func_addr(mjs_val_t v) {
     return v & ~MJS_TAG_MASK;
 }
@@ -420,3 +430,9 @@ MJS_PRIVATE void mjs_push(struct mjs* mjs, mjs_val_t v) {
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc) {
     mjs->generate_jsc = generate_jsc;
 }
+
+void mjs_set_bcode_cache(struct mjs* mjs, const char* dir, uint32_t version) {
+    free(mjs->bcode_cache_dir);
+    mjs->bcode_cache_dir = dir ? strdup(dir) : NULL;
+    mjs->bcode_cache_version = version;
+}
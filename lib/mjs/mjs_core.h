@@ -60,6 +60,22 @@ struct mjs_bcode_part {
     unsigned in_rom : 1;
 };
 
+/*
+ * Inline cache entries, keyed by bcode offset of the instruction. Caches are
+ * cleared on GC, which may free properties and move owned strings, and on
+ * property deletion.
+ */
+struct mjs_prop_cache_entry {
+    size_t site;
+    struct mjs_object* obj;
+    struct mjs_property* prop;
+};
+
+struct mjs_str_cache_entry {
+    size_t site;
+    mjs_val_t str;
+};
+
 struct mjs {
     struct mbuf bcode_gen;
     struct mbuf bcode_parts;
@@ -84,11 +100,18 @@ struct mjs {
     size_t cur_bcode_offset;
     mjs_flags_poller_t exec_flags_poller;
     void* context;
+    char* bcode_cache_dir; /* NULL if bcode cache is disabled */
+    uint32_t bcode_cache_version;
 
     struct gc_arena object_arena;
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
 
+#if MJS_INLINE_CACHE_SIZE > 0
+    struct mjs_prop_cache_entry prop_cache[MJS_INLINE_CACHE_SIZE];
+    struct mjs_str_cache_entry str_cache[MJS_INLINE_CACHE_SIZE];
+#endif
+
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
     unsigned generate_jsc : 1;
@@ -130,6 +153,12 @@ MJS_PRIVATE mjs_val_t mjs_pop(struct mjs* mjs);
 MJS_PRIVATE void mjs_push(struct mjs* mjs, mjs_val_t v);
 MJS_PRIVATE void mjs_die(struct mjs* mjs);
 
+/*
+ * Forget everything inline caches hold, must be called whenever a property
+ * may be freed or an owned string moved.
+ */
+MJS_PRIVATE void mjs_inline_cache_reset(struct mjs* mjs);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -262,6 +262,15 @@ const char* mjs_get_stack_trace(struct mjs* mjs);
  */
 void mjs_set_generate_jsc(struct mjs* mjs, int generate_jsc);
 
+/*
+ * Enables bcode cache for `mjs_exec_file()`: bcode of every parsed file is
+ * stored in the `dir` directory, and is used instead of parsing the file
+ * again while the file contents and `version` stay the same. `version` should
+ * change whenever cached bcode may become incompatible, e.g. with firmware API.
+ * Pass NULL `dir` to disable the cache, which is the default.
+ */
+void mjs_set_bcode_cache(struct mjs* mjs, const char* dir, uint32_t version);
+
 /*
  * When invoked from a cfunction, returns number of arguments passed to the
  * current JS function call.
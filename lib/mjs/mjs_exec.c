@@ -8,6 +8,7 @@
 
 #include "mjs_array.h"
 #include "mjs_bcode.h"
+#include "mjs_bcode_cache.h"
 #include "mjs_core.h"
 #include "mjs_exec.h"
 #include "mjs_internal.h"
@@ -741,10 +742,20 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             mjs_val_t obj = mjs_pop(mjs);
             mjs_val_t key = mjs_pop(mjs);
             mjs_val_t val = MJS_UNDEFINED;
+            size_t site = bp.start_idx + i;
+            struct mjs_property* p = mjs_prop_cache_get(mjs, site, obj, key);
 
-            if(!getprop_builtin(mjs, obj, key, &val)) {
+            if(p != NULL) {
+                val = p->value;
+            } else if(!getprop_builtin(mjs, obj, key, &val)) {
                 if(mjs_is_object(obj)) {
-                    val = mjs_get_v_proto(mjs, obj, key);
+                    p = mjs_get_own_property_v(mjs, obj, key);
+                    if(p != NULL) {
+                        mjs_prop_cache_put(mjs, site, obj, p);
+                        val = p->value;
+                    } else {
+                        val = mjs_get_v_proto(mjs, obj, key);
+                    }
                 } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
                     val = mjs_dataview_get_prop(mjs, obj, key);
                 } else {
@@ -784,7 +795,8 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             break;
         case OP_PUSH_STR: {
             int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
-            mjs_push(mjs, mjs_mk_string(mjs, (char*)code + i + 1 + llen, n, 1));
+            mjs_push(
+                mjs, mjs_mk_string_cached(mjs, bp.start_idx + i, (char*)code + i + 1 + llen, n));
             i += llen + n;
             break;
         }
@@ -1149,11 +1161,48 @@ mjs_err_t mjs_exec(struct mjs* mjs, const char* src, mjs_val_t* res) {
     return mjs_exec_internal(mjs, "<stdin>", src, 0 /* generate_jsc */, res);
 }
 
+/*
+ * Same as `mjs_exec_internal()`, but takes bcode from the cache if it's up to
+ * date. Otherwise the file is parsed and cached, and its source is freed
+ * before execution.
+ */
+static mjs_err_t mjs_exec_file_cached(struct mjs* mjs, const char* path, mjs_val_t* res) {
+    size_t off = mjs->bcode_len;
+
+    if(!mjs_bcode_cache_load(mjs, path)) {
+        size_t size;
+        char* source_code = cs_read_file(path, &size);
+
+        if(source_code == NULL) {
+            mjs_prepend_errorf(mjs, MJS_FILE_READ_ERROR, "failed to read file \"%s\"", path);
+            return MJS_FILE_READ_ERROR;
+        }
+
+        mjs->error = mjs_parse(path, source_code, mjs);
+        if(mjs->error == MJS_OK) {
+            mjs_bcode_cache_save(mjs, path, source_code, size);
+        }
+        free(source_code);
+
+        if(mjs->error != MJS_OK) return mjs->error;
+    }
+
+    mjs_execute(mjs, off, res);
+    return mjs->error;
+}
+
 mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     mjs_err_t error = MJS_FILE_READ_ERROR;
     mjs_val_t r = MJS_UNDEFINED;
     size_t size;
-    char* source_code = cs_read_file(path, &size);
+    char* source_code;
+
+    if(mjs->bcode_cache_dir != NULL) {
+        error = mjs_exec_file_cached(mjs, path, &r);
+        goto clean;
+    }
+
+    source_code = cs_read_file(path, &size);
 
     if(source_code == NULL) {
         error = MJS_FILE_READ_ERROR;
@@ -14,6 +14,16 @@
 #define MJS_MEMORY_STATS 0
 #endif
 
+/*
+ * MJS_INLINE_CACHE_SIZE: number of entries in each of the inline caches, must
+ * be a power of two, 0 disables the caches. Every OP_GET site in bcode maps to
+ * an entry which remembers the last object and its own property found there,
+ * and every OP_PUSH_STR site to an entry which keeps the long string it made.
+ */
+#if !defined(MJS_INLINE_CACHE_SIZE)
+#define MJS_INLINE_CACHE_SIZE 32
+#endif
+
 /*
  * MJS_GENERATE_JSC: if enabled, and if mmapping is also enabled (CS_MMAP),
  * then execution of any .js file will result in creation of a .jsc file with
@@ -494,6 +494,9 @@ void mjs_gc(struct mjs* mjs, int full) {
 
     gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
 
+    /* Cached properties may be freed, and strings moved by compaction */
+    mjs_inline_cache_reset(mjs);
+
     gc_compact_strings(mjs);
 
     gc_sweep(mjs, &mjs->object_arena, 0);
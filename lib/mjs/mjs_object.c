@@ -90,6 +90,52 @@ MJS_PRIVATE struct mjs_property*
     return p;
 }
 
+#if MJS_INLINE_CACHE_SIZE > 0
+static struct mjs_prop_cache_entry* mjs_prop_cache_entry(struct mjs* mjs, size_t site) {
+    return &mjs->prop_cache[site & (MJS_INLINE_CACHE_SIZE - 1)];
+}
+#endif
+
+MJS_PRIVATE struct mjs_property*
+    mjs_prop_cache_get(struct mjs* mjs, size_t site, mjs_val_t obj, mjs_val_t key) {
+#if MJS_INLINE_CACHE_SIZE > 0
+    struct mjs_prop_cache_entry* e = mjs_prop_cache_entry(mjs, site);
+    size_t n;
+    const char* s;
+
+    /* Arrays and other object based values have builtin properties */
+    if((obj & MJS_TAG_MASK) != MJS_TAG_OBJECT || !mjs_is_string(key)) return NULL;
+    if(e->site != site || e->obj == NULL || e->obj != get_object_struct(obj)) return NULL;
+
+    /* Short names are inlined into the value, longer ones have to be compared */
+    if(e->prop->name == key) return e->prop;
+    s = mjs_get_string(mjs, &key, &n);
+    if(n > 5 && mjs_strcmp(mjs, &e->prop->name, s, n) == 0) return e->prop;
+#else
+    (void)mjs;
+    (void)site;
+    (void)obj;
+    (void)key;
+#endif
+    return NULL;
+}
+
+MJS_PRIVATE void
+    mjs_prop_cache_put(struct mjs* mjs, size_t site, mjs_val_t obj, struct mjs_property* p) {
+#if MJS_INLINE_CACHE_SIZE > 0
+    struct mjs_prop_cache_entry* e = mjs_prop_cache_entry(mjs, site);
+    if((obj & MJS_TAG_MASK) != MJS_TAG_OBJECT) return;
+    e->site = site;
+    e->obj = get_object_struct(obj);
+    e->prop = p;
+#else
+    (void)mjs;
+    (void)site;
+    (void)obj;
+    (void)p;
+#endif
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_mk_property(struct mjs* mjs, mjs_val_t name, mjs_val_t value) {
     struct mjs_property* p = new_property(mjs);
@@ -238,6 +284,7 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
                 get_object_struct(obj)->properties = prop->next;
             }
             mjs_destroy_property(&prop);
+            mjs_inline_cache_reset(mjs);
             return 0;
         }
     }
@@ -45,6 +45,19 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
     size_t name_len,
     mjs_val_t val);
 
+/*
+ * Property lookup cache for OP_GET: returns own property of a plain object
+ * found at the same bcode site before, or NULL if it has to be looked up.
+ */
+MJS_PRIVATE struct mjs_property*
+    mjs_prop_cache_get(struct mjs* mjs, size_t site, mjs_val_t obj, mjs_val_t key);
+
+/*
+ * Remember own property of a plain object found at the bcode site.
+ */
+MJS_PRIVATE void
+    mjs_prop_cache_put(struct mjs* mjs, size_t site, mjs_val_t obj, struct mjs_property* p);
+
 /*
  * Implementation of `Object.create(proto)`
  */
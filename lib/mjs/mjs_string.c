@@ -132,6 +132,24 @@ mjs_val_t mjs_mk_string(struct mjs* mjs, const char* p, size_t len, int copy) {
     return (offset & ~MJS_TAG_MASK) | tag;
 }
 
+MJS_PRIVATE mjs_val_t
+    mjs_mk_string_cached(struct mjs* mjs, size_t site, const char* p, size_t len) {
+#if MJS_INLINE_CACHE_SIZE > 0
+    struct mjs_str_cache_entry* e = &mjs->str_cache[site & (MJS_INLINE_CACHE_SIZE - 1)];
+
+    /* Short strings are inlined into the value and cost nothing to make */
+    if(len <= 5) return mjs_mk_string(mjs, p, len, 1);
+    if(e->site != site || !mjs_is_string(e->str)) {
+        e->site = site;
+        e->str = mjs_mk_string(mjs, p, len, 1);
+    }
+    return e->str;
+#else
+    (void)site;
+    return mjs_mk_string(mjs, p, len, 1);
+#endif
+}
+
 /* Get a pointer to string and string length. */
 const char* mjs_get_string(struct mjs* mjs, mjs_val_t* v, size_t* sizep) {
     uint64_t tag = v[0] & MJS_TAG_MASK;
@@ -33,6 +33,14 @@ MJS_PRIVATE void embed_string(
 
 MJS_PRIVATE void mjs_mkstr(struct mjs* mjs);
 
+/*
+ * Make an owned string for OP_PUSH_STR at the given bcode site. Strings that
+ * don't fit into mjs_val_t are reused until the next GC instead of being copied
+ * on every execution.
+ */
+MJS_PRIVATE mjs_val_t
+    mjs_mk_string_cached(struct mjs* mjs, size_t site, const char* p, size_t len);
+
 MJS_PRIVATE void mjs_string_slice(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_index_of(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_char_code_at(struct mjs* mjs);
@@ -333,6 +333,8 @@ bool nfc_device_load(NfcDevice* instance, const char* path) {
 
     do {
         if(!flipper_format_buffered_file_open_existing(ff, path)) break;
+        // Large dumps have hundreds of keys
+        flipper_format_set_key_index(ff, true);
 
         // Read and verify file header
         uint32_t version = 0;
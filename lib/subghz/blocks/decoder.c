@@ -25,3 +25,21 @@ uint8_t subghz_protocol_blocks_get_hash_data(SubGhzBlockDecoder* decoder, size_t
     }
     return hash;
 }
+
+void subghz_protocol_blocks_get_preamble(
+    SubGhzBlockDecoder* decoder,
+    bool level,
+    uint32_t te,
+    uint32_t te_delta,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    preamble->parser_step = &decoder->parser_step;
+    preamble->level = level;
+    if(te_delta == 0) {
+        // Empty window, the decoder never leaves its reset step
+        preamble->duration_min = 1;
+        preamble->duration_max = 0;
+    } else {
+        preamble->duration_min = (te >= te_delta) ? (te - te_delta + 1) : 0;
+        preamble->duration_max = te + te_delta - 1;
+    }
+}
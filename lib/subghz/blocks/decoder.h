@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "../types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -42,6 +44,22 @@ void subghz_protocol_blocks_add_to_128_bit(
  */
 uint8_t subghz_protocol_blocks_get_hash_data(SubGhzBlockDecoder* decoder, size_t len);
 
+/**
+ * Fill the preamble window of a decoder.
+ * The window matches durations for which DURATION_DIFF(duration, te) < te_delta.
+ * @param decoder Pointer to a SubGhzBlockDecoder instance
+ * @param level Level of the pulse that starts the preamble
+ * @param te Nominal duration of the pulse that starts the preamble, us
+ * @param te_delta Allowed deviation from te, us
+ * @param preamble Pointer to a SubGhzProtocolDecoderPreamble to fill
+ */
+void subghz_protocol_blocks_get_preamble(
+    SubGhzBlockDecoder* decoder,
+    bool level,
+    uint32_t te,
+    uint32_t te_delta,
+    SubGhzProtocolDecoderPreamble* preamble);
+
 #ifdef __cplusplus
 }
 #endif
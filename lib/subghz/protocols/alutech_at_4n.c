@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
 
     .feed = subghz_protocol_decoder_alutech_at_4n_feed,
     .reset = subghz_protocol_decoder_alutech_at_4n_reset,
+    .get_preamble = subghz_protocol_decoder_alutech_at_4n_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_alutech_at_4n_get_hash_data,
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
@@ -331,6 +332,19 @@ void subghz_protocol_decoder_alutech_at_4n_feed(void* context, bool level, uint3
     }
 }
 
+void subghz_protocol_decoder_alutech_at_4n_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAlutech_at_4n* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_alutech_at_4n_const.te_short,
+        subghz_protocol_alutech_at_4n_const.te_delta,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -48,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
 
     .feed = subghz_protocol_decoder_ansonic_feed,
     .reset = subghz_protocol_decoder_ansonic_reset,
+    .get_preamble = subghz_protocol_decoder_ansonic_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_ansonic_get_hash_data,
     .serialize = subghz_protocol_decoder_ansonic_serialize,
@@ -279,6 +280,19 @@ void subghz_protocol_decoder_ansonic_feed(void* context, bool level, uint32_t du
     }
 }
 
+void subghz_protocol_decoder_ansonic_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderAnsonic* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_ansonic_const.te_short * 35,
+        subghz_protocol_ansonic_const.te_delta * 35,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
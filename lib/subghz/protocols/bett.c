@@ -58,6 +58,7 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
 
     .feed = subghz_protocol_decoder_bett_feed,
     .reset = subghz_protocol_decoder_bett_reset,
+    .get_preamble = subghz_protocol_decoder_bett_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_bett_get_hash_data,
     .serialize = subghz_protocol_decoder_bett_serialize,
@@ -289,6 +290,19 @@ void subghz_protocol_decoder_bett_feed(void* context, bool level, uint32_t durat
     }
 }
 
+void subghz_protocol_decoder_bett_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderBETT* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_bett_const.te_short * 44,
+        subghz_protocol_bett_const.te_delta * 15,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_bett_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderBETT* instance = context;
@@ -73,6 +73,15 @@ void subghz_protocol_decoder_bett_reset(void* context);
  */
 void subghz_protocol_decoder_bett_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Get the window of the first preamble pulse, used to skip the decoder while it is idle.
+ * @param context Pointer to a SubGhzProtocolDecoderBETT instance
+ * @param preamble Pointer to a SubGhzProtocolDecoderPreamble to fill
+ */
+void subghz_protocol_decoder_bett_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderBETT instance
@@ -55,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
 
     .feed = subghz_protocol_decoder_came_feed,
     .reset = subghz_protocol_decoder_came_reset,
+    .get_preamble = subghz_protocol_decoder_came_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_came_get_hash_data,
     .serialize = subghz_protocol_decoder_came_serialize,
@@ -311,6 +312,19 @@ void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t durat
     }
 }
 
+void subghz_protocol_decoder_came_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_came_const.te_short * 56,
+        subghz_protocol_came_const.te_delta * 47,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_came_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -73,6 +73,15 @@ void subghz_protocol_decoder_came_reset(void* context);
  */
 void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Get the window of the first preamble pulse, used to skip the decoder while it is idle.
+ * @param context Pointer to a SubGhzProtocolDecoderCame instance
+ * @param preamble Pointer to a SubGhzProtocolDecoderPreamble to fill
+ */
+void subghz_protocol_decoder_came_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderCame instance
@@ -45,6 +45,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
 
     .feed = subghz_protocol_decoder_came_atomo_feed,
     .reset = subghz_protocol_decoder_came_atomo_reset,
+    .get_preamble = subghz_protocol_decoder_came_atomo_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_came_atomo_get_hash_data,
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
@@ -186,6 +187,19 @@ void subghz_protocol_decoder_came_atomo_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_came_atomo_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameAtomo* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_came_atomo_const.te_long * 60,
+        subghz_protocol_came_atomo_const.te_delta * 40,
+        preamble);
+}
+
 /** 
  * Read bytes from rainbow table
  * @param file_name Full path to rainbow table the file 
@@ -76,6 +76,7 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
 
     .feed = subghz_protocol_decoder_came_twee_feed,
     .reset = subghz_protocol_decoder_came_twee_reset,
+    .get_preamble = subghz_protocol_decoder_came_twee_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_came_twee_get_hash_data,
     .serialize = subghz_protocol_decoder_came_twee_serialize,
@@ -409,6 +410,19 @@ void subghz_protocol_decoder_came_twee_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_came_twee_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCameTwee* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_came_twee_const.te_long * 51,
+        subghz_protocol_came_twee_const.te_delta * 20,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_came_twee_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCameTwee* instance = context;
@@ -72,6 +72,7 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
 
     .feed = subghz_protocol_decoder_chamb_code_feed,
     .reset = subghz_protocol_decoder_chamb_code_reset,
+    .get_preamble = subghz_protocol_decoder_chamb_code_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_chamb_code_get_hash_data,
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
@@ -422,6 +423,19 @@ void subghz_protocol_decoder_chamb_code_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_chamb_code_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderChamb_Code* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_chamb_code_const.te_short * 39,
+        subghz_protocol_chamb_code_const.te_delta * 20,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_chamb_code_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderChamb_Code* instance = context;
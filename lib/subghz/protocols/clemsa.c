@@ -57,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
 
     .feed = subghz_protocol_decoder_clemsa_feed,
     .reset = subghz_protocol_decoder_clemsa_reset,
+    .get_preamble = subghz_protocol_decoder_clemsa_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_clemsa_get_hash_data,
     .serialize = subghz_protocol_decoder_clemsa_serialize,
@@ -300,6 +301,19 @@ void subghz_protocol_decoder_clemsa_feed(void* context, bool level, uint32_t dur
     }
 }
 
+void subghz_protocol_decoder_clemsa_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderClemsa* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_clemsa_const.te_short * 51,
+        subghz_protocol_clemsa_const.te_delta * 25,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
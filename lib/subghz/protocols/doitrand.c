@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
 
     .feed = subghz_protocol_decoder_doitrand_feed,
     .reset = subghz_protocol_decoder_doitrand_reset,
+    .get_preamble = subghz_protocol_decoder_doitrand_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_doitrand_get_hash_data,
     .serialize = subghz_protocol_decoder_doitrand_serialize,
@@ -276,6 +277,19 @@ void subghz_protocol_decoder_doitrand_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_doitrand_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDoitrand* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_doitrand_const.te_short * 62,
+        subghz_protocol_doitrand_const.te_delta * 30,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
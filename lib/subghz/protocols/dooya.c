@@ -43,6 +43,7 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
 
     .feed = subghz_protocol_decoder_dooya_feed,
     .reset = subghz_protocol_decoder_dooya_reset,
+    .get_preamble = subghz_protocol_decoder_dooya_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_dooya_get_hash_data,
     .serialize = subghz_protocol_decoder_dooya_serialize,
@@ -304,6 +305,19 @@ void subghz_protocol_decoder_dooya_feed(void* context, bool level, uint32_t dura
     }
 }
 
+void subghz_protocol_decoder_dooya_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderDooya* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_dooya_const.te_long * 12,
+        subghz_protocol_dooya_const.te_delta * 20,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -42,6 +42,7 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
 
     .feed = subghz_protocol_decoder_faac_slh_feed,
     .reset = subghz_protocol_decoder_faac_slh_reset,
+    .get_preamble = subghz_protocol_decoder_faac_slh_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_faac_slh_get_hash_data,
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
@@ -160,6 +161,19 @@ void subghz_protocol_decoder_faac_slh_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_faac_slh_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderFaacSLH* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_faac_slh_const.te_long * 2,
+        subghz_protocol_faac_slh_const.te_delta * 3,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
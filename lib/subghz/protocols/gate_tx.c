@@ -42,6 +42,7 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
 
     .feed = subghz_protocol_decoder_gate_tx_feed,
     .reset = subghz_protocol_decoder_gate_tx_reset,
+    .get_preamble = subghz_protocol_decoder_gate_tx_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_gate_tx_get_hash_data,
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
@@ -269,6 +270,19 @@ void subghz_protocol_decoder_gate_tx_feed(void* context, bool level, uint32_t du
     }
 }
 
+void subghz_protocol_decoder_gate_tx_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderGateTx* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_gate_tx_const.te_short * 47,
+        subghz_protocol_gate_tx_const.te_delta * 47,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
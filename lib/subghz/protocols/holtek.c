@@ -52,6 +52,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
 
     .feed = subghz_protocol_decoder_holtek_feed,
     .reset = subghz_protocol_decoder_holtek_reset,
+    .get_preamble = subghz_protocol_decoder_holtek_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_holtek_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_serialize,
@@ -288,6 +289,19 @@ void subghz_protocol_decoder_holtek_feed(void* context, bool level, uint32_t dur
     }
 }
 
+void subghz_protocol_decoder_holtek_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_holtek_const.te_short * 36,
+        subghz_protocol_holtek_const.te_delta * 36,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
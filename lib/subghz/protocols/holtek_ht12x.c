@@ -59,6 +59,7 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
 
     .feed = subghz_protocol_decoder_holtek_th12x_feed,
     .reset = subghz_protocol_decoder_holtek_th12x_reset,
+    .get_preamble = subghz_protocol_decoder_holtek_th12x_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_holtek_th12x_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
@@ -313,6 +314,19 @@ void subghz_protocol_decoder_holtek_th12x_feed(void* context, bool level, uint32
     }
 }
 
+void subghz_protocol_decoder_holtek_th12x_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoltek_HT12X* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_holtek_th12x_const.te_short * 36,
+        subghz_protocol_holtek_th12x_const.te_delta * 36,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -53,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
 
     .feed = subghz_protocol_decoder_honeywell_wdb_feed,
     .reset = subghz_protocol_decoder_honeywell_wdb_reset,
+    .get_preamble = subghz_protocol_decoder_honeywell_wdb_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_honeywell_wdb_get_hash_data,
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
@@ -278,6 +279,19 @@ void subghz_protocol_decoder_honeywell_wdb_feed(void* context, bool level, uint3
     }
 }
 
+void subghz_protocol_decoder_honeywell_wdb_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHoneywell_WDB* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_honeywell_wdb_const.te_short * 3,
+        subghz_protocol_honeywell_wdb_const.te_delta,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzProtocolDecoderHoneywell_WDB* instance
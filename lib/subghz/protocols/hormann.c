@@ -46,6 +46,7 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
 
     .feed = subghz_protocol_decoder_hormann_feed,
     .reset = subghz_protocol_decoder_hormann_reset,
+    .get_preamble = subghz_protocol_decoder_hormann_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_hormann_get_hash_data,
     .serialize = subghz_protocol_decoder_hormann_serialize,
@@ -280,6 +281,19 @@ void subghz_protocol_decoder_hormann_feed(void* context, bool level, uint32_t du
     }
 }
 
+void subghz_protocol_decoder_hormann_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderHormann* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_hormann_const.te_short * 24,
+        subghz_protocol_hormann_const.te_delta * 24,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -42,6 +42,7 @@ const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
 
     .feed = subghz_protocol_decoder_ido_feed,
     .reset = subghz_protocol_decoder_ido_reset,
+    .get_preamble = subghz_protocol_decoder_ido_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_ido_get_hash_data,
     .deserialize = subghz_protocol_decoder_ido_deserialize,
@@ -159,6 +160,19 @@ void subghz_protocol_decoder_ido_feed(void* context, bool level, uint32_t durati
     }
 }
 
+void subghz_protocol_decoder_ido_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIDo* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_ido_const.te_short * 10,
+        subghz_protocol_ido_const.te_delta * 5,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -51,6 +51,7 @@ const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
 
     .feed = subghz_protocol_decoder_intertechno_v3_feed,
     .reset = subghz_protocol_decoder_intertechno_v3_reset,
+    .get_preamble = subghz_protocol_decoder_intertechno_v3_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_intertechno_v3_get_hash_data,
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
@@ -346,6 +347,19 @@ void subghz_protocol_decoder_intertechno_v3_feed(void* context, bool level, uint
     }
 }
 
+void subghz_protocol_decoder_intertechno_v3_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderIntertechno_V3* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_intertechno_v3_const.te_short * 37,
+        subghz_protocol_intertechno_v3_const.te_delta * 15,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -53,6 +53,7 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
 
     .feed = subghz_protocol_decoder_keeloq_feed,
     .reset = subghz_protocol_decoder_keeloq_reset,
+    .get_preamble = subghz_protocol_decoder_keeloq_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_keeloq_get_hash_data,
     .serialize = subghz_protocol_decoder_keeloq_serialize,
@@ -445,6 +446,19 @@ void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t dur
     }
 }
 
+void subghz_protocol_decoder_keeloq_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_keeloq_const.te_short,
+        subghz_protocol_keeloq_const.te_delta,
+        preamble);
+}
+
 /**
  * Validation of decrypt data.
  * @param instance Pointer to a SubGhzBlockGeneric instance
@@ -44,6 +44,7 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
 
     .feed = subghz_protocol_decoder_kia_feed,
     .reset = subghz_protocol_decoder_kia_reset,
+    .get_preamble = subghz_protocol_decoder_kia_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_kia_get_hash_data,
     .serialize = subghz_protocol_decoder_kia_serialize,
@@ -189,6 +190,19 @@ void subghz_protocol_decoder_kia_feed(void* context, bool level, uint32_t durati
     }
 }
 
+void subghz_protocol_decoder_kia_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKIA* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_kia_const.te_short,
+        subghz_protocol_kia_const.te_delta,
+        preamble);
+}
+
 uint8_t subghz_protocol_kia_crc8(uint8_t* data, size_t len) {
     uint8_t crc = 0x08;
     size_t i, j;
@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_kinggates_stylo_4k_decoder = {
 
     .feed = subghz_protocol_decoder_kinggates_stylo_4k_feed,
     .reset = subghz_protocol_decoder_kinggates_stylo_4k_reset,
+    .get_preamble = subghz_protocol_decoder_kinggates_stylo_4k_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_kinggates_stylo_4k_get_hash_data,
     .serialize = subghz_protocol_decoder_kinggates_stylo_4k_serialize,
@@ -196,6 +197,19 @@ void subghz_protocol_decoder_kinggates_stylo_4k_feed(void* context, bool level,
     }
 }
 
+void subghz_protocol_decoder_kinggates_stylo_4k_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKingGates_stylo_4k* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_kinggates_stylo_4k_const.te_short,
+        subghz_protocol_kinggates_stylo_4k_const.te_delta,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
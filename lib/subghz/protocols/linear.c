@@ -48,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
 
     .feed = subghz_protocol_decoder_linear_feed,
     .reset = subghz_protocol_decoder_linear_reset,
+    .get_preamble = subghz_protocol_decoder_linear_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_linear_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_serialize,
@@ -293,6 +294,19 @@ void subghz_protocol_decoder_linear_feed(void* context, bool level, uint32_t dur
     }
 }
 
+void subghz_protocol_decoder_linear_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinear* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_linear_const.te_short * 42,
+        subghz_protocol_linear_const.te_delta * 20,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_linear_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinear* instance = context;
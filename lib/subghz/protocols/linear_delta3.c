@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_linear_delta3_decoder = {
 
     .feed = subghz_protocol_decoder_linear_delta3_feed,
     .reset = subghz_protocol_decoder_linear_delta3_reset,
+    .get_preamble = subghz_protocol_decoder_linear_delta3_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_linear_delta3_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_delta3_serialize,
@@ -304,6 +305,19 @@ void subghz_protocol_decoder_linear_delta3_feed(void* context, bool level, uint3
     }
 }
 
+void subghz_protocol_decoder_linear_delta3_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderLinearDelta3* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_linear_delta3_const.te_short * 70,
+        subghz_protocol_linear_delta3_const.te_delta * 24,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_linear_delta3_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderLinearDelta3* instance = context;
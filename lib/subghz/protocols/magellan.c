@@ -44,6 +44,7 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
 
     .feed = subghz_protocol_decoder_magellan_feed,
     .reset = subghz_protocol_decoder_magellan_reset,
+    .get_preamble = subghz_protocol_decoder_magellan_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_magellan_get_hash_data,
     .serialize = subghz_protocol_decoder_magellan_serialize,
@@ -346,6 +347,19 @@ void subghz_protocol_decoder_magellan_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_magellan_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMagellan* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_magellan_const.te_short,
+        subghz_protocol_magellan_const.te_delta,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
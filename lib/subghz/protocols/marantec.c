@@ -44,6 +44,7 @@ const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
 
     .feed = subghz_protocol_decoder_marantec_feed,
     .reset = subghz_protocol_decoder_marantec_reset,
+    .get_preamble = subghz_protocol_decoder_marantec_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_marantec_get_hash_data,
     .serialize = subghz_protocol_decoder_marantec_serialize,
@@ -336,6 +337,19 @@ void subghz_protocol_decoder_marantec_feed(void* context, bool level, volatile u
     }
 }
 
+void subghz_protocol_decoder_marantec_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMarantec* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_marantec_const.te_long * 5,
+        subghz_protocol_marantec_const.te_delta * 8,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_marantec_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderMarantec* instance = context;
@@ -56,6 +56,7 @@ const SubGhzProtocolDecoder subghz_protocol_mastercode_decoder = {
 
     .feed = subghz_protocol_decoder_mastercode_feed,
     .reset = subghz_protocol_decoder_mastercode_reset,
+    .get_preamble = subghz_protocol_decoder_mastercode_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_mastercode_get_hash_data,
     .serialize = subghz_protocol_decoder_mastercode_serialize,
@@ -304,6 +305,19 @@ void subghz_protocol_decoder_mastercode_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_mastercode_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMastercode* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_mastercode_const.te_short * 15,
+        subghz_protocol_mastercode_const.te_delta * 15,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
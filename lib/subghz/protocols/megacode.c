@@ -54,6 +54,7 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
 
     .feed = subghz_protocol_decoder_megacode_feed,
     .reset = subghz_protocol_decoder_megacode_reset,
+    .get_preamble = subghz_protocol_decoder_megacode_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_megacode_get_hash_data,
     .serialize = subghz_protocol_decoder_megacode_serialize,
@@ -323,6 +324,19 @@ void subghz_protocol_decoder_megacode_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_megacode_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderMegaCode* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_megacode_const.te_short * 13,
+        subghz_protocol_megacode_const.te_delta * 17,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -44,6 +44,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
 
     .feed = subghz_protocol_decoder_nero_radio_feed,
     .reset = subghz_protocol_decoder_nero_radio_reset,
+    .get_preamble = subghz_protocol_decoder_nero_radio_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_nero_radio_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
@@ -336,6 +337,19 @@ void subghz_protocol_decoder_nero_radio_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_nero_radio_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroRadio* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_nero_radio_const.te_short,
+        subghz_protocol_nero_radio_const.te_delta,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_nero_radio_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroRadio* instance = context;
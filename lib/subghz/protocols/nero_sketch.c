@@ -43,6 +43,7 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
 
     .feed = subghz_protocol_decoder_nero_sketch_feed,
     .reset = subghz_protocol_decoder_nero_sketch_reset,
+    .get_preamble = subghz_protocol_decoder_nero_sketch_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_nero_sketch_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
@@ -321,6 +322,19 @@ void subghz_protocol_decoder_nero_sketch_feed(void* context, bool level, uint32_
     }
 }
 
+void subghz_protocol_decoder_nero_sketch_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNeroSketch* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_nero_sketch_const.te_short,
+        subghz_protocol_nero_sketch_const.te_delta,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_nero_sketch_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNeroSketch* instance = context;
@@ -41,6 +41,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flo_feed,
     .reset = subghz_protocol_decoder_nice_flo_reset,
+    .get_preamble = subghz_protocol_decoder_nice_flo_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_nice_flo_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
@@ -276,6 +277,19 @@ void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_nice_flo_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_nice_flo_const.te_short * 36,
+        subghz_protocol_nice_flo_const.te_delta * 36,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
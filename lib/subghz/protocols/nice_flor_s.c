@@ -55,6 +55,7 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
 
     .feed = subghz_protocol_decoder_nice_flor_s_feed,
     .reset = subghz_protocol_decoder_nice_flor_s_reset,
+    .get_preamble = subghz_protocol_decoder_nice_flor_s_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_nice_flor_s_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
@@ -349,6 +350,19 @@ void subghz_protocol_decoder_nice_flor_s_feed(void* context, bool level, uint32_
     }
 }
 
+void subghz_protocol_decoder_nice_flor_s_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlorS* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_nice_flor_s_const.te_short * 38,
+        subghz_protocol_nice_flor_s_const.te_delta * 38,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -44,6 +44,7 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
 
     .feed = subghz_protocol_decoder_phoenix_v2_feed,
     .reset = subghz_protocol_decoder_phoenix_v2_reset,
+    .get_preamble = subghz_protocol_decoder_phoenix_v2_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_phoenix_v2_get_hash_data,
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
@@ -274,6 +275,19 @@ void subghz_protocol_decoder_phoenix_v2_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_phoenix_v2_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPhoenix_V2* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_phoenix_v2_const.te_short * 60,
+        subghz_protocol_phoenix_v2_const.te_delta * 30,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -57,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
 
     .feed = subghz_protocol_decoder_princeton_feed,
     .reset = subghz_protocol_decoder_princeton_reset,
+    .get_preamble = subghz_protocol_decoder_princeton_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_princeton_get_hash_data,
     .serialize = subghz_protocol_decoder_princeton_serialize,
@@ -316,6 +317,19 @@ void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_princeton_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_princeton_const.te_short * 36,
+        subghz_protocol_princeton_const.te_delta * 36,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -1,6 +1,7 @@
 #include "raw.h"
 #include <lib/flipper_format/flipper_format.h>
 #include "../subghz_file_encoder_worker.h"
+#include "../subghz_raw_file.h"
 
 #include "../blocks/const.h"
 #include "../blocks/generic.h"
@@ -10,8 +11,6 @@
 
 #define TAG "SubGhzProtocolRaw"
 
-#define SUBGHZ_DOWNLOAD_MAX_SIZE 512
-
 static const SubGhzBlockConst subghz_protocol_raw_const = {
     .te_short = 50,
     .te_long = 32700,
@@ -22,8 +21,7 @@ static const SubGhzBlockConst subghz_protocol_raw_const = {
 struct SubGhzProtocolDecoderRAW {
     SubGhzProtocolDecoderBase base;
 
-    int32_t* upload_raw;
-    uint16_t ind_write;
+    SubGhzRawFileWriter* writer;
     Storage* storage;
     FlipperFormat* flipper_file;
     uint32_t file_is_open;
@@ -121,7 +119,9 @@ bool subghz_protocol_raw_save_to_file_init(
         }
 
         if(!flipper_format_write_header_cstr(
-               instance->flipper_file, SUBGHZ_RAW_FILE_TYPE, SUBGHZ_RAW_FILE_VERSION)) {
+               instance->flipper_file,
+               SUBGHZ_RAW_FILE_TYPE,
+               SUBGHZ_RAW_FILE_VERSION_BINARY)) {
             FURI_LOG_E(TAG, "Unable to add header");
             break;
         }
@@ -156,7 +156,9 @@ bool subghz_protocol_raw_save_to_file_init(
             break;
         }
 
-        instance->upload_raw = malloc(SUBGHZ_DOWNLOAD_MAX_SIZE * sizeof(int32_t));
+        // Samples are written in binary right after the Protocol line
+        instance->writer =
+            subghz_raw_file_writer_alloc(flipper_format_get_raw_stream(instance->flipper_file));
         instance->file_is_open = RAWFileIsOpenWrite;
         instance->sample_write = 0;
         instance->last_level = false;
@@ -169,31 +171,24 @@ bool subghz_protocol_raw_save_to_file_init(
     return init;
 }
 
-static bool subghz_protocol_raw_save_to_file_write(SubGhzProtocolDecoderRAW* instance) {
-    furi_assert(instance);
-
-    bool is_write = false;
-    if(instance->file_is_open == RAWFileIsOpenWrite) {
-        if(!flipper_format_write_int32(
-               instance->flipper_file, "RAW_Data", instance->upload_raw, instance->ind_write)) {
-            FURI_LOG_E(TAG, "Unable to add RAW_Data");
-        } else {
-            instance->sample_write += instance->ind_write;
-            instance->ind_write = 0;
-            is_write = true;
-        }
-    }
-    return is_write;
-}
-
 void subghz_protocol_raw_save_to_file_stop(SubGhzProtocolDecoderRAW* instance) {
     furi_check(instance);
 
-    if(instance->file_is_open == RAWFileIsOpenWrite && instance->ind_write)
-        subghz_protocol_raw_save_to_file_write(instance);
+    if(instance->writer) {
+        SubGhzRawFileWriter* writer = instance->writer;
+        // Feed stops adding samples once the writer is gone
+        instance->writer = NULL;
+        if(!subghz_raw_file_writer_stop(writer)) {
+            FURI_LOG_E(TAG, "Unable to write RAW data");
+        }
+        size_t dropped = subghz_raw_file_writer_get_dropped_count(writer);
+        if(dropped) {
+            FURI_LOG_W(TAG, "Storage is slow, %zu samples dropped", dropped);
+        }
+        instance->sample_write = subghz_raw_file_writer_get_sample_count(writer);
+        subghz_raw_file_writer_free(writer);
+    }
     if(instance->file_is_open != RAWFileIsOpenClose) {
-        free(instance->upload_raw);
-        instance->upload_raw = NULL;
         flipper_format_file_close(instance->flipper_file);
         flipper_format_free(instance->flipper_file);
         furi_record_close(RECORD_STORAGE);
@@ -212,15 +207,15 @@ void subghz_protocol_raw_save_to_file_pause(SubGhzProtocolDecoderRAW* instance,
 
 size_t subghz_protocol_raw_get_sample_write(SubGhzProtocolDecoderRAW* instance) {
     furi_check(instance);
-    return instance->sample_write + instance->ind_write;
+    return instance->writer ? subghz_raw_file_writer_get_sample_count(instance->writer) :
+                              instance->sample_write;
 }
 
 void* subghz_protocol_decoder_raw_alloc(SubGhzEnvironment* environment) {
     UNUSED(environment);
     SubGhzProtocolDecoderRAW* instance = malloc(sizeof(SubGhzProtocolDecoderRAW));
     instance->base.protocol = &subghz_protocol_raw;
-    instance->upload_raw = NULL;
-    instance->ind_write = 0;
+    instance->writer = NULL;
     instance->last_level = false;
     instance->file_is_open = RAWFileIsOpenClose;
     instance->file_name = furi_string_alloc();
@@ -238,7 +233,6 @@ void subghz_protocol_decoder_raw_free(void* context) {
 void subghz_protocol_decoder_raw_reset(void* context) {
     furi_check(context);
     SubGhzProtocolDecoderRAW* instance = context;
-    instance->ind_write = 0;
     instance->last_level = false;
 }
 
@@ -246,17 +240,14 @@ void subghz_protocol_decoder_raw_feed(void* context, bool level, uint32_t durati
     furi_check(context);
     SubGhzProtocolDecoderRAW* instance = context;
 
-    if(!instance->pause && (instance->upload_raw != NULL)) {
+    if(!instance->pause && (instance->writer != NULL)) {
         if(duration > subghz_protocol_raw_const.te_short) {
             if(instance->last_level != level) {
                 instance->last_level = (level ? true : false);
-                instance->upload_raw[instance->ind_write++] = (level ? duration : -duration);
+                subghz_raw_file_writer_add(
+                    instance->writer, (level ? (int32_t)duration : -(int32_t)duration));
             }
         }
-
-        if(instance->ind_write == SUBGHZ_DOWNLOAD_MAX_SIZE) {
-            subghz_protocol_raw_save_to_file_write(instance);
-        }
     }
 }
 
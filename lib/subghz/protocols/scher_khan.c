@@ -50,6 +50,7 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
 
     .feed = subghz_protocol_decoder_scher_khan_feed,
     .reset = subghz_protocol_decoder_scher_khan_reset,
+    .get_preamble = subghz_protocol_decoder_scher_khan_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_scher_khan_get_hash_data,
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
@@ -201,6 +202,19 @@ void subghz_protocol_decoder_scher_khan_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_scher_khan_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderScherKhan* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_scher_khan_const.te_short * 2,
+        subghz_protocol_scher_khan_const.te_delta,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -65,6 +65,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
 
     .feed = subghz_protocol_decoder_secplus_v1_feed,
     .reset = subghz_protocol_decoder_secplus_v1_reset,
+    .get_preamble = subghz_protocol_decoder_secplus_v1_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_secplus_v1_get_hash_data,
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
@@ -510,6 +511,19 @@ void subghz_protocol_decoder_secplus_v1_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_secplus_v1_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v1* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_secplus_v1_const.te_short * 120,
+        subghz_protocol_secplus_v1_const.te_delta * 120,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_secplus_v1_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderSecPlus_v1* instance = context;
@@ -57,6 +57,7 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
 
     .feed = subghz_protocol_decoder_secplus_v2_feed,
     .reset = subghz_protocol_decoder_secplus_v2_reset,
+    .get_preamble = subghz_protocol_decoder_secplus_v2_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_secplus_v2_get_hash_data,
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
@@ -748,6 +749,19 @@ void subghz_protocol_decoder_secplus_v2_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_secplus_v2_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSecPlus_v2* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_secplus_v2_const.te_long * 130,
+        subghz_protocol_secplus_v2_const.te_delta * 100,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_secplus_v2_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderSecPlus_v2* instance = context;
@@ -67,6 +67,7 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
 
     .feed = subghz_protocol_decoder_smc5326_feed,
     .reset = subghz_protocol_decoder_smc5326_reset,
+    .get_preamble = subghz_protocol_decoder_smc5326_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_smc5326_get_hash_data,
     .serialize = subghz_protocol_decoder_smc5326_serialize,
@@ -308,6 +309,19 @@ void subghz_protocol_decoder_smc5326_feed(void* context, bool level, uint32_t du
     }
 }
 
+void subghz_protocol_decoder_smc5326_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSMC5326* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        false,
+        subghz_protocol_smc5326_const.te_short * 24,
+        subghz_protocol_smc5326_const.te_delta * 12,
+        preamble);
+}
+
 uint8_t subghz_protocol_decoder_smc5326_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderSMC5326* instance = context;
@@ -48,6 +48,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_keytis_feed,
     .reset = subghz_protocol_decoder_somfy_keytis_reset,
+    .get_preamble = subghz_protocol_decoder_somfy_keytis_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_somfy_keytis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
@@ -237,6 +238,19 @@ void subghz_protocol_decoder_somfy_keytis_feed(void* context, bool level, uint32
     }
 }
 
+void subghz_protocol_decoder_somfy_keytis_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyKeytis* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_somfy_keytis_const.te_short * 4,
+        subghz_protocol_somfy_keytis_const.te_delta * 4,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -47,6 +47,7 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
 
     .feed = subghz_protocol_decoder_somfy_telis_feed,
     .reset = subghz_protocol_decoder_somfy_telis_reset,
+    .get_preamble = subghz_protocol_decoder_somfy_telis_get_preamble,
 
     .get_hash_data = subghz_protocol_decoder_somfy_telis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
@@ -231,6 +232,19 @@ void subghz_protocol_decoder_somfy_telis_feed(void* context, bool level, uint32_
     }
 }
 
+void subghz_protocol_decoder_somfy_telis_get_preamble(
+    void* context,
+    SubGhzProtocolDecoderPreamble* preamble) {
+    furi_assert(context);
+    SubGhzProtocolDecoderSomfyTelis* instance = context;
+    subghz_protocol_blocks_get_preamble(
+        &instance->decoder,
+        true,
+        subghz_protocol_somfy_telis_const.te_short * 4,
+        subghz_protocol_somfy_telis_const.te_delta * 4,
+        preamble);
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
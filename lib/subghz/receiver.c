@@ -6,6 +6,8 @@
 
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    // Preamble window, parser_step is NULL if the decoder must see every pulse
+    SubGhzProtocolDecoderPreamble preamble;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -32,6 +34,10 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+            slot->preamble.parser_step = NULL;
+            if(protocol->decoder->get_preamble) {
+                protocol->decoder->get_preamble(slot->base, &slot->preamble);
+            }
         }
     }
 
@@ -57,18 +63,49 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
     free(instance);
 }
 
+static inline bool subghz_receiver_slot_is_skipped(
+    const SubGhzReceiverSlot* slot,
+    bool level,
+    uint32_t duration) {
+    // Idle decoder ignores every pulse that can't start its preamble, skip the call
+    const SubGhzProtocolDecoderPreamble* preamble = &slot->preamble;
+    if(preamble->parser_step && *preamble->parser_step == 0) {
+        return preamble->level != level || duration < preamble->duration_min ||
+               duration > preamble->duration_max;
+    }
+    return false;
+}
+
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration) {
     furi_check(instance);
     furi_check(instance->slots);
 
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
-            }
+            if((slot->base->protocol->flag & instance->filter) == 0) continue;
+            if(subghz_receiver_slot_is_skipped(slot, level, duration)) continue;
+
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
         }
 }
 
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_durations,
+    size_t count) {
+    furi_check(instance);
+    furi_check(instance->slots);
+    furi_check(level_durations || !count);
+
+    // Pulse by pulse: rx callback may reset all decoders, they must not be ahead of it
+    for(size_t i = 0; i < count; i++) {
+        subghz_receiver_decode(
+            instance,
+            level_duration_get_level(level_durations[i]),
+            level_duration_get_duration(level_durations[i]));
+    }
+}
+
 void subghz_receiver_reset(SubGhzReceiver* instance) {
     furi_check(instance);
     furi_check(instance->slots);
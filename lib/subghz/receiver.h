@@ -29,12 +29,27 @@ void subghz_receiver_free(SubGhzReceiver* instance);
 
 /**
  * Parse a raw sequence of levels and durations received from the air.
+ * Decoders that provide a preamble window are not fed while they are idle
+ * and the pulse can't start their preamble.
  * @param instance Pointer to a SubGhzReceiver instance
  * @param level Signal level true-high false-low
  * @param duration Duration of this level in, us
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * Same as calling subghz_receiver_decode for every element, callbacks come in
+ * pulse order and may reset the receiver.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param level_durations Array of received levels and durations, us
+ * @param count Number of elements in level_durations
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_durations,
+    size_t count);
+
 /**
  * Reset decoder SubGhzReceiver.
  * @param instance Pointer to a SubGhzReceiver instance
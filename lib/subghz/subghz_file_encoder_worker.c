@@ -1,4 +1,6 @@
 #include "subghz_file_encoder_worker.h"
+#include "subghz_raw_file.h"
+#include "types.h"
 
 #include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
@@ -103,6 +105,9 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     bool res = false;
     instance->is_storage_slow = false;
     Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
+    SubGhzRawFileReader* reader = NULL;
+    int32_t* samples = NULL;
+    uint32_t version = 0;
     do {
         if(!flipper_format_file_open_existing(
                instance->flipper_format, furi_string_get_cstr(instance->file_path))) {
@@ -112,6 +117,10 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
                 furi_string_get_cstr(instance->file_path));
             break;
         }
+        if(!flipper_format_read_header(instance->flipper_format, instance->str_data, &version)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
         if(!flipper_format_read_string(instance->flipper_format, "Protocol", instance->str_data)) {
             FURI_LOG_E(TAG, "Missing Protocol");
             break;
@@ -119,6 +128,10 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
 
         //skip the end of the previous line "\n"
         stream_seek(stream, 1, StreamOffsetFromCurrent);
+        if(version == SUBGHZ_RAW_FILE_VERSION_BINARY) {
+            reader = subghz_raw_file_reader_alloc(stream);
+            samples = malloc(SUBGHZ_FILE_ENCODER_LOAD * sizeof(int32_t));
+        }
         res = true;
         instance->worker_stoping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -127,7 +140,17 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
+            if(reader) {
+                size_t count =
+                    subghz_raw_file_reader_read(reader, samples, SUBGHZ_FILE_ENCODER_LOAD);
+                if(count) {
+                    furi_stream_buffer_send(
+                        instance->stream, samples, count * sizeof(int32_t), 100);
+                } else {
+                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                    break;
+                }
+            } else if(stream_read_line(stream, instance->str_data)) {
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
@@ -142,6 +165,11 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
             furi_delay_ms(1);
         }
     }
+    if(reader) {
+        subghz_raw_file_reader_free(reader);
+        free(samples);
+    }
+
     //waiting for the end of the transfer
     if(instance->is_storage_slow) {
         FURI_LOG_E(TAG, "Storage is slow");
@@ -0,0 +1,652 @@
+#include "subghz_raw_file.h"
+#include "types.h"
+
+#include <furi.h>
+#include <flipper_format/flipper_format.h>
+#include <flipper_format/flipper_format_i.h>
+
+#define TAG "SubGhzRawFile"
+
+#define SUBGHZ_RAW_FILE_BLOCK_DATA_SIZE \
+    (SUBGHZ_RAW_FILE_BLOCK_SIZE - sizeof(SubGhzRawFileBlockHeader))
+/* Longest unary part of a Rice code, larger quotients are followed by the raw magnitude */
+#define SUBGHZ_RAW_FILE_RICE_LIMIT 24
+/* Number of recent samples of each level the Rice parameter is estimated from */
+#define SUBGHZ_RAW_FILE_RICE_WINDOW 4
+/* Level escape (33 bits), escape reason (1 bit) and magnitude (56 bits) */
+#define SUBGHZ_RAW_FILE_SAMPLE_MAX_SIZE 12
+#define SUBGHZ_RAW_FILE_WRITER_BLOCKS   4
+#define SUBGHZ_RAW_FILE_TEXT_LINE_SIZE  512
+
+typedef struct {
+    uint32_t first_sample; /**< Index of the first sample in the block */
+    uint16_t sample_count; /**< Number of samples in the block */
+    uint16_t data_size; /**< Number of used data bytes, the rest is zero */
+} SubGhzRawFileBlockHeader;
+
+typedef struct {
+    SubGhzRawFileBlockHeader header;
+    uint8_t data[SUBGHZ_RAW_FILE_BLOCK_DATA_SIZE];
+} SubGhzRawFileBlock;
+
+/** Coding state, restarted with every block so blocks decode on their own */
+typedef struct {
+    uint64_t sum[2]; /**< Sum of recent magnitudes, per level */
+    uint32_t count[2]; /**< Number of magnitudes in sum, per level */
+    bool negative; /**< Sign of the last sample */
+    uint16_t bit_index; /**< Position of the next bit in block data */
+} SubGhzRawFileCodec;
+
+static_assert(sizeof(SubGhzRawFileBlock) == SUBGHZ_RAW_FILE_BLOCK_SIZE);
+
+struct SubGhzRawFileWriter {
+    Stream* stream;
+    FuriThread* thread;
+    FuriMessageQueue* free_queue;
+    FuriMessageQueue* ready_queue;
+    SubGhzRawFileBlock* block;
+    SubGhzRawFileCodec codec;
+    size_t sample_count;
+    size_t dropped_count;
+    volatile bool error;
+    SubGhzRawFileBlock blocks[SUBGHZ_RAW_FILE_WRITER_BLOCKS];
+};
+
+struct SubGhzRawFileReader {
+    Stream* stream;
+    size_t data_offset;
+    uint32_t block_count;
+    uint32_t next_block;
+    bool block_loaded;
+    uint16_t sample_index;
+    SubGhzRawFileCodec codec;
+    SubGhzRawFileBlock block;
+};
+
+static void subghz_raw_file_codec_reset(SubGhzRawFileCodec* codec) {
+    for(size_t i = 0; i < COUNT_OF(codec->sum); i++) {
+        codec->sum[i] = 16;
+        codec->count[i] = 1;
+    }
+    // First sample is expected to be positive
+    codec->negative = true;
+    codec->bit_index = 0;
+}
+
+/* Smallest Rice parameter that covers the recent mean magnitude of the level */
+static uint8_t subghz_raw_file_codec_get_k(const SubGhzRawFileCodec* codec, bool negative) {
+    uint8_t k = 0;
+    while(k < 32 && ((uint64_t)codec->count[negative] << k) < codec->sum[negative]) {
+        k++;
+    }
+    return k;
+}
+
+static void
+    subghz_raw_file_codec_update(SubGhzRawFileCodec* codec, bool negative, uint32_t magnitude) {
+    codec->sum[negative] += magnitude;
+    codec->count[negative]++;
+    if(codec->count[negative] == SUBGHZ_RAW_FILE_RICE_WINDOW) {
+        codec->sum[negative] >>= 1;
+        codec->count[negative] >>= 1;
+    }
+    codec->negative = negative;
+}
+
+static void subghz_raw_file_block_reset(
+    SubGhzRawFileBlock* block,
+    SubGhzRawFileCodec* codec,
+    uint32_t first_sample) {
+    memset(block, 0, sizeof(SubGhzRawFileBlock));
+    block->header.first_sample = first_sample;
+    subghz_raw_file_codec_reset(codec);
+}
+
+static void subghz_raw_file_block_put_bits(
+    SubGhzRawFileBlock* block,
+    SubGhzRawFileCodec* codec,
+    uint64_t value,
+    uint8_t count) {
+    for(uint8_t i = 0; i < count; i++) {
+        if((value >> i) & 1) {
+            block->data[codec->bit_index / 8] |= 1 << (codec->bit_index % 8);
+        }
+        codec->bit_index++;
+    }
+}
+
+static void subghz_raw_file_block_put_rice(
+    SubGhzRawFileBlock* block,
+    SubGhzRawFileCodec* codec,
+    uint32_t value,
+    uint8_t k) {
+    const uint64_t quotient = (uint64_t)value >> k;
+
+    if(quotient >= SUBGHZ_RAW_FILE_RICE_LIMIT) {
+        subghz_raw_file_block_put_bits(
+            block, codec, (1UL << SUBGHZ_RAW_FILE_RICE_LIMIT) - 1, SUBGHZ_RAW_FILE_RICE_LIMIT);
+        subghz_raw_file_block_put_bits(block, codec, value, 32);
+    } else {
+        subghz_raw_file_block_put_bits(block, codec, (1UL << quotient) - 1, quotient + 1);
+        subghz_raw_file_block_put_bits(block, codec, value, k);
+    }
+}
+
+/* Durations of the same level are spread around their recent mean, so every
+ * magnitude is Rice coded with the parameter taken from the last few samples
+ * of its level. Levels nearly always alternate: a zero value is an escape,
+ * followed by a bit that is set for a level that doesn't alternate and clear
+ * for a zero duration. */
+static void subghz_raw_file_block_append(
+    SubGhzRawFileBlock* block,
+    SubGhzRawFileCodec* codec,
+    int32_t duration) {
+    const bool negative = duration < 0;
+    const uint32_t magnitude = negative ? -(uint32_t)duration : (uint32_t)duration;
+    const uint8_t k = subghz_raw_file_codec_get_k(codec, negative);
+
+    // Escape is coded as a sample of the level that was expected
+    if(negative == codec->negative) {
+        subghz_raw_file_block_put_rice(
+            block, codec, 0, subghz_raw_file_codec_get_k(codec, !negative));
+        subghz_raw_file_block_put_bits(block, codec, 1, 1);
+    }
+    subghz_raw_file_block_put_rice(block, codec, magnitude, k);
+    if(magnitude == 0) {
+        subghz_raw_file_block_put_bits(block, codec, 0, 1);
+    }
+
+    subghz_raw_file_codec_update(codec, negative, magnitude);
+
+    block->header.data_size = (codec->bit_index + 7) / 8;
+    block->header.sample_count++;
+}
+
+static bool subghz_raw_file_block_is_full(const SubGhzRawFileBlock* block) {
+    return ((size_t)block->header.data_size + SUBGHZ_RAW_FILE_SAMPLE_MAX_SIZE >
+            SUBGHZ_RAW_FILE_BLOCK_DATA_SIZE) ||
+           (block->header.sample_count == UINT16_MAX);
+}
+
+static int32_t subghz_raw_file_writer_thread(void* context) {
+    SubGhzRawFileWriter* writer = context;
+    SubGhzRawFileBlock* block;
+
+    while(true) {
+        furi_check(
+            furi_message_queue_get(writer->ready_queue, &block, FuriWaitForever) ==
+            FuriStatusOk);
+        if(block == NULL) break;
+
+        if(!writer->error &&
+           stream_write(writer->stream, (const uint8_t*)block, SUBGHZ_RAW_FILE_BLOCK_SIZE) !=
+               SUBGHZ_RAW_FILE_BLOCK_SIZE) {
+            FURI_LOG_E(TAG, "Block write failed");
+            writer->error = true;
+        }
+
+        furi_check(
+            furi_message_queue_put(writer->free_queue, &block, FuriWaitForever) ==
+            FuriStatusOk);
+    }
+
+    return 0;
+}
+
+SubGhzRawFileWriter* subghz_raw_file_writer_alloc(Stream* stream) {
+    furi_check(stream);
+
+    SubGhzRawFileWriter* writer = malloc(sizeof(SubGhzRawFileWriter));
+    writer->stream = stream;
+
+    writer->free_queue =
+        furi_message_queue_alloc(SUBGHZ_RAW_FILE_WRITER_BLOCKS, sizeof(SubGhzRawFileBlock*));
+    writer->ready_queue =
+        furi_message_queue_alloc(SUBGHZ_RAW_FILE_WRITER_BLOCKS + 1, sizeof(SubGhzRawFileBlock*));
+    for(size_t i = 0; i < SUBGHZ_RAW_FILE_WRITER_BLOCKS; i++) {
+        SubGhzRawFileBlock* block = &writer->blocks[i];
+        furi_check(furi_message_queue_put(writer->free_queue, &block, 0) == FuriStatusOk);
+    }
+
+    writer->thread =
+        furi_thread_alloc_ex("SubGhzRawWriter", 1024, subghz_raw_file_writer_thread, writer);
+    furi_thread_start(writer->thread);
+
+    return writer;
+}
+
+void subghz_raw_file_writer_free(SubGhzRawFileWriter* writer) {
+    furi_check(writer);
+    furi_check(writer->thread == NULL);
+
+    furi_message_queue_free(writer->free_queue);
+    furi_message_queue_free(writer->ready_queue);
+    free(writer);
+}
+
+bool subghz_raw_file_writer_add(SubGhzRawFileWriter* writer, int32_t duration) {
+    furi_check(writer);
+
+    if(writer->block == NULL) {
+        if(furi_message_queue_get(writer->free_queue, &writer->block, 0) != FuriStatusOk) {
+            writer->dropped_count++;
+            return false;
+        }
+        subghz_raw_file_block_reset(writer->block, &writer->codec, writer->sample_count);
+    }
+
+    subghz_raw_file_block_append(writer->block, &writer->codec, duration);
+    writer->sample_count++;
+
+    if(subghz_raw_file_block_is_full(writer->block)) {
+        // Ready queue has room for every block
+        furi_check(furi_message_queue_put(writer->ready_queue, &writer->block, 0) == FuriStatusOk);
+        writer->block = NULL;
+    }
+
+    return true;
+}
+
+bool subghz_raw_file_writer_stop(SubGhzRawFileWriter* writer) {
+    furi_check(writer);
+    furi_check(writer->thread);
+
+    if(writer->block) {
+        furi_check(
+            furi_message_queue_put(writer->ready_queue, &writer->block, FuriWaitForever) ==
+            FuriStatusOk);
+        writer->block = NULL;
+    }
+
+    SubGhzRawFileBlock* stop = NULL;
+    furi_check(
+        furi_message_queue_put(writer->ready_queue, &stop, FuriWaitForever) == FuriStatusOk);
+    furi_thread_join(writer->thread);
+    furi_thread_free(writer->thread);
+    writer->thread = NULL;
+
+    return !writer->error;
+}
+
+size_t subghz_raw_file_writer_get_sample_count(SubGhzRawFileWriter* writer) {
+    furi_check(writer);
+    return writer->sample_count;
+}
+
+size_t subghz_raw_file_writer_get_dropped_count(SubGhzRawFileWriter* writer) {
+    furi_check(writer);
+    return writer->dropped_count;
+}
+
+SubGhzRawFileReader* subghz_raw_file_reader_alloc(Stream* stream) {
+    furi_check(stream);
+
+    SubGhzRawFileReader* reader = malloc(sizeof(SubGhzRawFileReader));
+    reader->stream = stream;
+    reader->data_offset = stream_tell(stream);
+    reader->block_count = (stream_size(stream) - reader->data_offset) / SUBGHZ_RAW_FILE_BLOCK_SIZE;
+
+    return reader;
+}
+
+void subghz_raw_file_reader_free(SubGhzRawFileReader* reader) {
+    furi_check(reader);
+    free(reader);
+}
+
+static bool subghz_raw_file_reader_seek_block(SubGhzRawFileReader* reader, uint32_t index) {
+    return stream_seek(
+        reader->stream,
+        reader->data_offset + index * SUBGHZ_RAW_FILE_BLOCK_SIZE,
+        StreamOffsetFromStart);
+}
+
+static bool subghz_raw_file_reader_load_block(SubGhzRawFileReader* reader, uint32_t index) {
+    reader->block_loaded = false;
+    if(index >= reader->block_count) return false;
+
+    if(!subghz_raw_file_reader_seek_block(reader, index) ||
+       stream_read(reader->stream, (uint8_t*)&reader->block, SUBGHZ_RAW_FILE_BLOCK_SIZE) !=
+           SUBGHZ_RAW_FILE_BLOCK_SIZE) {
+        FURI_LOG_E(TAG, "Block %lu read failed", index);
+        return false;
+    }
+
+    if(reader->block.header.data_size > SUBGHZ_RAW_FILE_BLOCK_DATA_SIZE) {
+        FURI_LOG_E(TAG, "Block %lu is corrupted", index);
+        reader->block_count = index;
+        return false;
+    }
+
+    reader->next_block = index + 1;
+    reader->block_loaded = true;
+    reader->sample_index = 0;
+    subghz_raw_file_codec_reset(&reader->codec);
+
+    return true;
+}
+
+static bool
+    subghz_raw_file_reader_get_bits(SubGhzRawFileReader* reader, uint32_t* value, uint8_t count) {
+    SubGhzRawFileCodec* codec = &reader->codec;
+
+    if(codec->bit_index + count > reader->block.header.data_size * 8) return false;
+
+    *value = 0;
+    for(uint8_t i = 0; i < count; i++) {
+        const uint8_t byte = reader->block.data[codec->bit_index / 8];
+        *value |= (uint32_t)((byte >> (codec->bit_index % 8)) & 1) << i;
+        codec->bit_index++;
+    }
+
+    return true;
+}
+
+static bool
+    subghz_raw_file_reader_get_rice(SubGhzRawFileReader* reader, uint32_t* value, uint8_t k) {
+    uint32_t quotient = 0;
+    uint32_t bit = 1;
+
+    while(quotient < SUBGHZ_RAW_FILE_RICE_LIMIT) {
+        if(!subghz_raw_file_reader_get_bits(reader, &bit, 1)) return false;
+        if(!bit) break;
+        quotient++;
+    }
+
+    if(quotient == SUBGHZ_RAW_FILE_RICE_LIMIT) {
+        return subghz_raw_file_reader_get_bits(reader, value, 32);
+    }
+
+    uint32_t remainder = 0;
+    if(k && !subghz_raw_file_reader_get_bits(reader, &remainder, k)) return false;
+    *value = ((uint64_t)quotient << k) | remainder;
+
+    return true;
+}
+
+static bool subghz_raw_file_reader_decode_sample(SubGhzRawFileReader* reader, int32_t* duration) {
+    SubGhzRawFileCodec* codec = &reader->codec;
+    bool alternate = true;
+    uint32_t magnitude;
+
+    uint8_t k = subghz_raw_file_codec_get_k(codec, !codec->negative);
+    while(true) {
+        if(!subghz_raw_file_reader_get_rice(reader, &magnitude, k)) return false;
+        if(magnitude) break;
+
+        uint32_t repeat;
+        if(!subghz_raw_file_reader_get_bits(reader, &repeat, 1)) return false;
+        if(!repeat) break;
+        if(!alternate) return false;
+
+        alternate = false;
+        k = subghz_raw_file_codec_get_k(codec, codec->negative);
+    }
+
+    const bool negative = alternate ? !codec->negative : codec->negative;
+    subghz_raw_file_codec_update(codec, negative, magnitude);
+
+    *duration = negative ? -(int32_t)magnitude : (int32_t)magnitude;
+    return true;
+}
+
+static bool subghz_raw_file_reader_decode(SubGhzRawFileReader* reader, int32_t* duration) {
+    if(subghz_raw_file_reader_decode_sample(reader, duration)) {
+        reader->sample_index++;
+        return true;
+    }
+
+    // Sample count doesn't match data, the rest of the file can't be trusted
+    FURI_LOG_E(TAG, "Block %lu is corrupted", reader->next_block - 1);
+    reader->block_count = reader->next_block;
+    reader->block_loaded = false;
+    return false;
+}
+
+size_t subghz_raw_file_reader_read(SubGhzRawFileReader* reader, int32_t* data, size_t count) {
+    furi_check(reader);
+    furi_check(data);
+
+    size_t read = 0;
+    while(read < count) {
+        if(!reader->block_loaded ||
+           reader->sample_index == reader->block.header.sample_count) {
+            if(!subghz_raw_file_reader_load_block(reader, reader->next_block)) break;
+            continue;
+        }
+        if(!subghz_raw_file_reader_decode(reader, &data[read])) break;
+        read++;
+    }
+
+    return read;
+}
+
+bool subghz_raw_file_reader_seek(SubGhzRawFileReader* reader, uint32_t sample) {
+    furi_check(reader);
+
+    if(reader->block_count == 0) return false;
+
+    // Last block starting at or before the sample
+    uint32_t low = 0;
+    uint32_t high = reader->block_count;
+    while(high - low > 1) {
+        const uint32_t middle = low + (high - low) / 2;
+        SubGhzRawFileBlockHeader header;
+        if(!subghz_raw_file_reader_seek_block(reader, middle) ||
+           stream_read(reader->stream, (uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+            reader->block_loaded = false;
+            return false;
+        }
+        if(header.first_sample <= sample) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    if(!subghz_raw_file_reader_load_block(reader, low)) return false;
+
+    const SubGhzRawFileBlockHeader* header = &reader->block.header;
+    if(sample < header->first_sample || sample - header->first_sample >= header->sample_count) {
+        reader->block_loaded = false;
+        return false;
+    }
+
+    int32_t duration;
+    for(uint32_t i = header->first_sample; i < sample; i++) {
+        if(!subghz_raw_file_reader_decode(reader, &duration)) return false;
+    }
+
+    return true;
+}
+
+static bool subghz_raw_file_convert_header(
+    FlipperFormat* source,
+    FlipperFormat* destination,
+    uint32_t* source_version,
+    bool binary) {
+    FuriString* temp_str = furi_string_alloc();
+    uint8_t* custom_preset_data = NULL;
+    bool result = false;
+
+    do {
+        if(!flipper_format_read_header(source, temp_str, source_version)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
+        if(strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE) != 0 ||
+           (*source_version != SUBGHZ_RAW_FILE_VERSION &&
+            *source_version != SUBGHZ_RAW_FILE_VERSION_BINARY)) {
+            FURI_LOG_E(TAG, "Type or version mismatch");
+            break;
+        }
+        if(!flipper_format_write_header_cstr(
+               destination,
+               SUBGHZ_RAW_FILE_TYPE,
+               binary ? SUBGHZ_RAW_FILE_VERSION_BINARY : SUBGHZ_RAW_FILE_VERSION)) {
+            break;
+        }
+
+        uint32_t frequency;
+        if(!flipper_format_read_uint32(source, "Frequency", &frequency, 1) ||
+           !flipper_format_write_uint32(destination, "Frequency", &frequency, 1)) {
+            FURI_LOG_E(TAG, "Unable to copy Frequency");
+            break;
+        }
+
+        if(!flipper_format_read_string(source, "Preset", temp_str) ||
+           !flipper_format_write_string(destination, "Preset", temp_str)) {
+            FURI_LOG_E(TAG, "Unable to copy Preset");
+            break;
+        }
+
+        // Optional keys are not looked up in binary files, samples follow Protocol
+        if(!strcmp(furi_string_get_cstr(temp_str), "FuriHalSubGhzPresetCustom")) {
+            uint32_t custom_preset_data_size;
+            if(!flipper_format_read_string(source, "Custom_preset_module", temp_str) ||
+               !flipper_format_write_string(destination, "Custom_preset_module", temp_str) ||
+               !flipper_format_get_value_count(
+                   source, "Custom_preset_data", &custom_preset_data_size)) {
+                FURI_LOG_E(TAG, "Unable to copy Custom_preset_module");
+                break;
+            }
+            custom_preset_data = malloc(custom_preset_data_size);
+            if(!flipper_format_read_hex(
+                   source, "Custom_preset_data", custom_preset_data, custom_preset_data_size) ||
+               !flipper_format_write_hex(
+                   destination,
+                   "Custom_preset_data",
+                   custom_preset_data,
+                   custom_preset_data_size)) {
+                FURI_LOG_E(TAG, "Unable to copy Custom_preset_data");
+                break;
+            }
+        }
+
+        if(!flipper_format_read_string(source, "Protocol", temp_str) ||
+           strcmp(furi_string_get_cstr(temp_str), "RAW") != 0 ||
+           !flipper_format_write_string(destination, "Protocol", temp_str)) {
+            FURI_LOG_E(TAG, "Unable to copy Protocol");
+            break;
+        }
+
+        result = true;
+    } while(false);
+
+    free(custom_preset_data);
+    furi_string_free(temp_str);
+
+    return result;
+}
+
+static size_t
+    subghz_raw_file_convert_read_text(FlipperFormat* source, int32_t* data, size_t count) {
+    uint32_t value_count;
+    if(!flipper_format_get_value_count(source, "RAW_Data", &value_count)) return 0;
+
+    if(value_count > count) {
+        FURI_LOG_E(TAG, "RAW_Data line is too long");
+        return 0;
+    }
+    if(!flipper_format_read_int32(source, "RAW_Data", data, value_count)) return 0;
+
+    return value_count;
+}
+
+bool subghz_raw_file_convert(
+    Storage* storage,
+    const char* source,
+    const char* destination,
+    bool binary) {
+    furi_check(storage);
+    furi_check(source);
+    furi_check(destination);
+
+    FlipperFormat* source_file = flipper_format_file_alloc(storage);
+    FlipperFormat* destination_file = flipper_format_file_alloc(storage);
+    Stream* source_stream = flipper_format_get_raw_stream(source_file);
+    Stream* destination_stream = flipper_format_get_raw_stream(destination_file);
+    SubGhzRawFileReader* reader = NULL;
+    SubGhzRawFileBlock* block = NULL;
+    SubGhzRawFileCodec codec;
+    int32_t* samples = malloc(SUBGHZ_RAW_FILE_TEXT_LINE_SIZE * sizeof(int32_t));
+    uint32_t source_version = 0;
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_existing(source_file, source)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", source);
+            break;
+        }
+        if(!flipper_format_file_open_always(destination_file, destination)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", destination);
+            break;
+        }
+        if(!subghz_raw_file_convert_header(
+               source_file, destination_file, &source_version, binary)) {
+            break;
+        }
+
+        if(source_version == SUBGHZ_RAW_FILE_VERSION_BINARY) {
+            // Skip the end of the Protocol line
+            if(!stream_seek(source_stream, 1, StreamOffsetFromCurrent)) break;
+            reader = subghz_raw_file_reader_alloc(source_stream);
+        }
+        if(binary) {
+            block = malloc(sizeof(SubGhzRawFileBlock));
+        }
+
+        uint32_t sample_count = 0;
+        bool write_error = false;
+        while(!write_error) {
+            const size_t count =
+                reader ? subghz_raw_file_reader_read(
+                             reader, samples, SUBGHZ_RAW_FILE_TEXT_LINE_SIZE) :
+                         subghz_raw_file_convert_read_text(
+                             source_file, samples, SUBGHZ_RAW_FILE_TEXT_LINE_SIZE);
+            if(count == 0) break;
+
+            if(!binary) {
+                write_error = !flipper_format_write_int32(
+                    destination_file, "RAW_Data", samples, count);
+                continue;
+            }
+
+            for(size_t i = 0; i < count && !write_error; i++) {
+                if(block->header.sample_count == 0) {
+                    subghz_raw_file_block_reset(block, &codec, sample_count);
+                }
+                subghz_raw_file_block_append(block, &codec, samples[i]);
+                sample_count++;
+                if(subghz_raw_file_block_is_full(block)) {
+                    write_error = stream_write(
+                                      destination_stream,
+                                      (const uint8_t*)block,
+                                      SUBGHZ_RAW_FILE_BLOCK_SIZE) != SUBGHZ_RAW_FILE_BLOCK_SIZE;
+                    block->header.sample_count = 0;
+                }
+            }
+        }
+
+        if(block && block->header.sample_count && !write_error) {
+            write_error = stream_write(
+                              destination_stream,
+                              (const uint8_t*)block,
+                              SUBGHZ_RAW_FILE_BLOCK_SIZE) != SUBGHZ_RAW_FILE_BLOCK_SIZE;
+        }
+        if(write_error) {
+            FURI_LOG_E(TAG, "Unable to write samples");
+            break;
+        }
+
+        result = true;
+    } while(false);
+
+    if(reader) subghz_raw_file_reader_free(reader);
+    free(block);
+    free(samples);
+    flipper_format_free(destination_file);
+    flipper_format_free(source_file);
+
+    return result;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file subghz_raw_file.h
+ * @brief Binary container for SubGhz RAW captures.
+ *
+ * Binary RAW files share the text header with regular RAW files
+ * (Filetype, Version, Frequency, Preset, Protocol), but use
+ * SUBGHZ_RAW_FILE_VERSION_BINARY and store samples right after the
+ * "Protocol: RAW" line in fixed size blocks instead of RAW_Data lines.
+ *
+ * Every block starts with the index of its first sample, followed by
+ * Rice codes of sample durations, with the parameter adapted to recent
+ * durations of the same level. Adaptation restarts with every block, and
+ * fixed block size makes the block list
+ * an index on its own: any sample can be reached with a binary search
+ * over block headers, without reading the whole file.
+ */
+#pragma once
+
+#include <storage/storage.h>
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Size of a single block, in bytes */
+#define SUBGHZ_RAW_FILE_BLOCK_SIZE 512
+
+typedef struct SubGhzRawFileWriter SubGhzRawFileWriter;
+typedef struct SubGhzRawFileReader SubGhzRawFileReader;
+
+/**
+ * Allocate SubGhzRawFileWriter and start its worker thread.
+ * Blocks are appended to the stream at its current position.
+ * @param stream Pointer to a Stream instance, must outlive the writer
+ * @return SubGhzRawFileWriter* pointer to a SubGhzRawFileWriter instance
+ */
+SubGhzRawFileWriter* subghz_raw_file_writer_alloc(Stream* stream);
+
+/**
+ * Free SubGhzRawFileWriter, the writer must be stopped first.
+ * @param writer Pointer to a SubGhzRawFileWriter instance
+ */
+void subghz_raw_file_writer_free(SubGhzRawFileWriter* writer);
+
+/**
+ * Add a sample. Never blocks: filled blocks are written to the stream by
+ * the worker thread, the sample is dropped if all blocks are waiting for it.
+ * @param writer Pointer to a SubGhzRawFileWriter instance
+ * @param duration Signed duration in us, positive for high level
+ * @return true if sample was added, false if it was dropped
+ */
+bool subghz_raw_file_writer_add(SubGhzRawFileWriter* writer, int32_t duration);
+
+/**
+ * Write the pending block and stop the worker thread.
+ * @param writer Pointer to a SubGhzRawFileWriter instance
+ * @return true if all blocks were written successfully
+ */
+bool subghz_raw_file_writer_stop(SubGhzRawFileWriter* writer);
+
+/**
+ * Get the number of samples added to the writer.
+ * @param writer Pointer to a SubGhzRawFileWriter instance
+ * @return count of samples
+ */
+size_t subghz_raw_file_writer_get_sample_count(SubGhzRawFileWriter* writer);
+
+/**
+ * Get the number of samples dropped because storage was too slow.
+ * @param writer Pointer to a SubGhzRawFileWriter instance
+ * @return count of dropped samples
+ */
+size_t subghz_raw_file_writer_get_dropped_count(SubGhzRawFileWriter* writer);
+
+/**
+ * Allocate SubGhzRawFileReader.
+ * Blocks are read from the current position of the stream to its end.
+ * @param stream Pointer to a Stream instance, must outlive the reader
+ * @return SubGhzRawFileReader* pointer to a SubGhzRawFileReader instance
+ */
+SubGhzRawFileReader* subghz_raw_file_reader_alloc(Stream* stream);
+
+/**
+ * Free SubGhzRawFileReader.
+ * @param reader Pointer to a SubGhzRawFileReader instance
+ */
+void subghz_raw_file_reader_free(SubGhzRawFileReader* reader);
+
+/**
+ * Read samples.
+ * @param reader Pointer to a SubGhzRawFileReader instance
+ * @param data Buffer for signed durations
+ * @param count Buffer size, in samples
+ * @return number of samples read, 0 at the end of data
+ */
+size_t subghz_raw_file_reader_read(SubGhzRawFileReader* reader, int32_t* data, size_t count);
+
+/**
+ * Move to a sample by its index.
+ * @param reader Pointer to a SubGhzRawFileReader instance
+ * @param sample Sample index
+ * @return true on success, false if there is no such sample
+ */
+bool subghz_raw_file_reader_seek(SubGhzRawFileReader* reader, uint32_t sample);
+
+/**
+ * Convert RAW file between text and binary formats.
+ * @param storage Pointer to a Storage instance
+ * @param source Path to the source RAW file, text or binary
+ * @param destination Path to the destination file, overwritten if exists
+ * @param binary true to write binary file, false to write text file
+ * @return true on success
+ */
+bool subghz_raw_file_convert(
+    Storage* storage,
+    const char* source,
+    const char* destination,
+    bool binary);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,18 +4,40 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_RING_SIZE  4096 // LevelDuration pairs, must be a power of 2
+#define SUBGHZ_WORKER_RING_MASK  (SUBGHZ_WORKER_RING_SIZE - 1)
+#define SUBGHZ_WORKER_BLOCK_SIZE 64 // Pairs drained from the ring at once
+
+#define SUBGHZ_WORKER_DROPPED_MAX 0x3FFFFFFFUL // Fits LevelDuration duration field
+
+typedef enum {
+    SubGhzWorkerEventData = (1 << 0),
+} SubGhzWorkerEvent;
+
 struct SubGhzWorker {
     FuriThread* thread;
-    FuriStreamBuffer* stream;
+    volatile FuriThreadId thread_id;
+
+    // Single producer (rx ISR), single consumer (worker thread) ring
+    LevelDuration* ring;
+    volatile uint32_t ring_head; // Written by the ISR only
+    volatile uint32_t ring_tail; // Written by the worker thread only
+    uint32_t ring_dropped; // Pairs dropped since the last gap marker, ISR only
 
     volatile bool running;
-    volatile bool overrun;
 
     LevelDuration filter_level_duration;
     uint16_t filter_duration;
 
+    LevelDuration block[SUBGHZ_WORKER_BLOCK_SIZE];
+    size_t block_count;
+
+    uint32_t overrun_count;
+    uint32_t overrun_dropped;
+
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
 };
 
@@ -28,14 +50,81 @@ struct SubGhzWorker {
 void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration = level_duration_make(level, duration);
-    if(instance->overrun) {
-        instance->overrun = false;
-        level_duration = level_duration_reset();
+    uint32_t head = instance->ring_head;
+    uint32_t used = head - instance->ring_tail;
+    uint32_t needed = instance->ring_dropped ? 2 : 1;
+
+    if(SUBGHZ_WORKER_RING_SIZE - used < needed) {
+        if(instance->ring_dropped < SUBGHZ_WORKER_DROPPED_MAX) instance->ring_dropped++;
+        return;
+    }
+
+    if(instance->ring_dropped) {
+        // Mark the gap, duration of the reset pair carries the number of dropped pairs
+        LevelDuration gap = level_duration_reset();
+        gap.duration = instance->ring_dropped;
+        instance->ring[head++ & SUBGHZ_WORKER_RING_MASK] = gap;
+        instance->ring_dropped = 0;
+    }
+    instance->ring[head++ & SUBGHZ_WORKER_RING_MASK] = level_duration_make(level, duration);
+
+    // Publish pairs only after they are written
+    __DMB();
+    instance->ring_head = head;
+
+    // Wake the thread only when the ring was empty, it drains until empty otherwise
+    FuriThreadId thread_id = instance->thread_id;
+    if(used == 0 && thread_id) {
+        furi_thread_flags_set(thread_id, SubGhzWorkerEventData);
+    }
+}
+
+static void subghz_worker_flush_block(SubGhzWorker* instance) {
+    if(instance->block_count == 0) return;
+
+    if(instance->pair_batch_callback) {
+        instance->pair_batch_callback(instance->context, instance->block, instance->block_count);
+    } else if(instance->pair_callback) {
+        for(size_t i = 0; i < instance->block_count; i++) {
+            instance->pair_callback(
+                instance->context,
+                level_duration_get_level(instance->block[i]),
+                level_duration_get_duration(instance->block[i]));
+        }
+    }
+    instance->block_count = 0;
+}
+
+static void subghz_worker_process(SubGhzWorker* instance, LevelDuration level_duration) {
+    if(level_duration_is_reset(level_duration)) {
+        // Pairs received before the gap still belong to the decoders
+        subghz_worker_flush_block(instance);
+
+        instance->overrun_count++;
+        instance->overrun_dropped += level_duration.duration;
+        FURI_LOG_E(
+            TAG,
+            "Overrun buffer, %lu pairs dropped (%lu in %lu overruns)",
+            (uint32_t)level_duration.duration,
+            instance->overrun_dropped,
+            instance->overrun_count);
+        if(instance->overrun_callback) instance->overrun_callback(instance->context);
+    } else {
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+
+        if((duration < instance->filter_duration) ||
+           (instance->filter_level_duration.level == level)) {
+            instance->filter_level_duration.duration += duration;
+
+        } else if(instance->filter_level_duration.level != level) {
+            instance->block[instance->block_count++] = level_duration_make(
+                instance->filter_level_duration.level, instance->filter_level_duration.duration);
+
+            instance->filter_level_duration.duration = duration;
+            instance->filter_level_duration.level = level;
+        }
     }
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    if(sizeof(LevelDuration) != ret) instance->overrun = true;
 }
 
 /** Worker callback thread
@@ -46,34 +135,25 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
-            if(level_duration_is_reset(level_duration)) {
-                FURI_LOG_E(TAG, "Overrun buffer");
-                if(instance->overrun_callback) instance->overrun_callback(instance->context);
-            } else {
-                bool level = level_duration_get_level(level_duration);
-                uint32_t duration = level_duration_get_duration(level_duration);
-
-                if((duration < instance->filter_duration) ||
-                   (instance->filter_level_duration.level == level)) {
-                    instance->filter_level_duration.duration += duration;
-
-                } else if(instance->filter_level_duration.level != level) {
-                    if(instance->pair_callback)
-                        instance->pair_callback(
-                            instance->context,
-                            instance->filter_level_duration.level,
-                            instance->filter_level_duration.duration);
-
-                    instance->filter_level_duration.duration = duration;
-                    instance->filter_level_duration.level = level;
-                }
-            }
+        uint32_t tail = instance->ring_tail;
+        uint32_t available = instance->ring_head - tail;
+
+        if(available == 0) {
+            furi_thread_flags_wait(SubGhzWorkerEventData, FuriFlagWaitAny, 10);
+            continue;
+        }
+
+        size_t count = MIN(available, (uint32_t)SUBGHZ_WORKER_BLOCK_SIZE);
+        for(size_t i = 0; i < count; i++) {
+            subghz_worker_process(instance, instance->ring[(tail + i) & SUBGHZ_WORKER_RING_MASK]);
         }
+
+        // Give the slots back only after they are read
+        __DMB();
+        instance->ring_tail = tail + count;
+
+        subghz_worker_flush_block(instance);
     }
 
     return 0;
@@ -85,8 +165,7 @@ SubGhzWorker* subghz_worker_alloc(void) {
     instance->thread =
         furi_thread_alloc_ex("SubGhzWorker", 2048, subghz_worker_thread_callback, instance);
 
-    instance->stream =
-        furi_stream_buffer_alloc(sizeof(LevelDuration) * 4096, sizeof(LevelDuration));
+    instance->ring = malloc(sizeof(LevelDuration) * SUBGHZ_WORKER_RING_SIZE);
 
     //setting default filter in us
     instance->filter_duration = 30;
@@ -97,7 +176,7 @@ SubGhzWorker* subghz_worker_alloc(void) {
 void subghz_worker_free(SubGhzWorker* instance) {
     furi_check(instance);
 
-    furi_stream_buffer_free(instance->stream);
+    free(instance->ring);
     furi_thread_free(instance->thread);
 
     free(instance);
@@ -115,6 +194,13 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_check(instance);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_check(instance);
     instance->context = context;
@@ -124,9 +210,13 @@ void subghz_worker_start(SubGhzWorker* instance) {
     furi_check(instance);
     furi_check(!instance->running);
 
+    instance->ring_tail = instance->ring_head;
+    instance->ring_dropped = 0;
+    instance->block_count = 0;
     instance->running = true;
 
     furi_thread_start(instance->thread);
+    instance->thread_id = furi_thread_get_id(instance->thread);
 }
 
 void subghz_worker_stop(SubGhzWorker* instance) {
@@ -134,6 +224,7 @@ void subghz_worker_stop(SubGhzWorker* instance) {
     furi_check(instance->running);
 
     instance->running = false;
+    instance->thread_id = NULL;
 
     furi_thread_join(instance->thread);
 }
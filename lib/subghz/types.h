@@ -19,8 +19,9 @@
 #define SUBGHZ_KEY_FILE_VERSION 1
 #define SUBGHZ_KEY_FILE_TYPE    "Flipper SubGhz Key File"
 
-#define SUBGHZ_RAW_FILE_VERSION 1
-#define SUBGHZ_RAW_FILE_TYPE    "Flipper SubGhz RAW File"
+#define SUBGHZ_RAW_FILE_VERSION        1
+#define SUBGHZ_RAW_FILE_VERSION_BINARY 2
+#define SUBGHZ_RAW_FILE_TYPE           "Flipper SubGhz RAW File"
 
 #define SUBGHZ_KEYSTORE_DIR_NAME      EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define SUBGHZ_KEYSTORE_DIR_USER_NAME EXT_PATH("subghz/assets/keeloq_mfcodes_user")
@@ -77,6 +78,16 @@ typedef void (*SubGhzDecoderReset)(void* decoder);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
+/** Window of the first preamble pulse, lets SubGhzReceiver skip idle decoders */
+typedef struct {
+    const uint32_t* parser_step; ///< Decoder parser step, 0 while waiting for the preamble
+    bool level; ///< Level of the pulse that starts the preamble
+    uint32_t duration_min; ///< Shortest duration that starts the preamble, us
+    uint32_t duration_max; ///< Longest duration that starts the preamble, us
+} SubGhzProtocolDecoderPreamble;
+
+typedef void (*SubGhzGetPreamble)(void* decoder, SubGhzProtocolDecoderPreamble* preamble);
+
 // Encoder specific
 typedef void (*SubGhzEncoderStop)(void* encoder);
 typedef LevelDuration (*SubGhzEncoderYield)(void* context);
@@ -92,6 +103,8 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    SubGhzGetPreamble get_preamble; ///< Optional, NULL if the decoder must see every pulse
 } SubGhzProtocolDecoder;
 
 typedef struct {
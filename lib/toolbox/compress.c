@@ -4,6 +4,7 @@
 #include <lib/heatshrink/heatshrink_encoder.h>
 #include <lib/heatshrink/heatshrink_decoder.h>
 #include <stdint.h>
+#include <m-i-list.h>
 
 #define TAG "Compress"
 
@@ -15,6 +16,9 @@
 
 #define COMPRESS_ICON_ENCODED_BUFF_SIZE (256u)
 
+/** Icon cache never takes more than this share of free heap */
+#define COMPRESS_ICON_CACHE_HEAP_SHARE (8u)
+
 const CompressConfigHeatshrink compress_config_heatshrink_default = {
     .window_sz2 = COMPRESS_EXP_BUFF_SIZE_LOG,
     .lookahead_sz2 = COMPRESS_LOOKAHEAD_BUFF_SIZE_LOG,
@@ -38,12 +42,96 @@ typedef struct {
 
 _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
+typedef struct CompressIconCacheEntry {
+    ILIST_INTERFACE(CompressIconCacheList, struct CompressIconCacheEntry);
+    const uint8_t* icon_data;
+    size_t icon_data_size;
+    size_t size;
+    /* Copy of icon data followed by decoded data. Icon data is compared on lookup,
+     * so entries stay valid when the memory of dynamically loaded icons is reused. */
+    uint8_t data[];
+} CompressIconCacheEntry;
+
+ILIST_DEF(CompressIconCacheList, CompressIconCacheEntry, M_POD_OPLIST)
+
 struct CompressIcon {
     heatshrink_decoder* decoder;
     uint8_t* buffer;
     size_t buffer_size;
+
+    CompressIconCacheList_t cache;
+    size_t cache_size;
+    size_t cache_used;
+    CompressIconCacheStats cache_stats;
 };
 
+static void compress_icon_cache_remove(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    CompressIconCacheList_unlink(entry);
+    instance->cache_used -= entry->size;
+    free(entry);
+}
+
+static void compress_icon_cache_shrink(CompressIcon* instance, size_t size) {
+    while(instance->cache_used > size) {
+        compress_icon_cache_remove(instance, CompressIconCacheList_back(instance->cache));
+        instance->cache_stats.evictions++;
+    }
+}
+
+static size_t compress_icon_cache_limit(CompressIcon* instance) {
+    // Cache shrinks as free memory runs low, its own entries count as free
+    size_t heap_limit =
+        (memmgr_get_free_heap() + instance->cache_used) / COMPRESS_ICON_CACHE_HEAP_SHARE;
+    return MIN(instance->cache_size, heap_limit);
+}
+
+static CompressIconCacheEntry* compress_icon_cache_find(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    size_t icon_data_size) {
+    for
+        M_EACH(entry, instance->cache, CompressIconCacheList_t) {
+            if(entry->icon_data != icon_data) continue;
+
+            if(entry->icon_data_size == icon_data_size &&
+               memcmp(entry->data, icon_data, icon_data_size) == 0) {
+                return entry;
+            }
+
+            // Memory was reused by another icon
+            compress_icon_cache_remove(instance, entry);
+            break;
+        }
+
+    return NULL;
+}
+
+static void compress_icon_cache_insert(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    size_t icon_data_size,
+    size_t decoded_size) {
+    const size_t entry_size = sizeof(CompressIconCacheEntry) + icon_data_size + decoded_size;
+    const size_t limit = compress_icon_cache_limit(instance);
+
+    if(entry_size > limit) {
+        compress_icon_cache_shrink(instance, limit);
+        return;
+    }
+
+    compress_icon_cache_shrink(instance, limit - entry_size);
+
+    CompressIconCacheEntry* entry = malloc(entry_size);
+    entry->icon_data = icon_data;
+    entry->icon_data_size = icon_data_size;
+    entry->size = entry_size;
+    memcpy(entry->data, icon_data, icon_data_size);
+    memcpy(&entry->data[icon_data_size], instance->buffer, decoded_size);
+
+    CompressIconCacheList_push_front(instance->cache, entry);
+    instance->cache_used += entry_size;
+}
+
 CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
     CompressIcon* instance = malloc(sizeof(CompressIcon));
     instance->decoder = heatshrink_decoder_alloc(
@@ -55,11 +143,14 @@ CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
     instance->buffer_size = decode_buf_size + 4; /* To account for heatshrink's poller quirks */
     instance->buffer = malloc(instance->buffer_size);
 
+    CompressIconCacheList_init(instance->cache);
+
     return instance;
 }
 
 void compress_icon_free(CompressIcon* instance) {
     furi_check(instance);
+    compress_icon_cache_shrink(instance, 0);
     free(instance->buffer);
     heatshrink_decoder_free(instance->decoder);
     free(instance);
@@ -72,22 +163,57 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
 
     CompressHeader* header = (CompressHeader*)icon_data;
     if(header->is_compressed) {
+        /* Decoder will check/process headers again - need to pass them */
+        const size_t icon_data_size = sizeof(CompressHeader) + header->compressed_buff_size;
+
+        if(instance->cache_size) {
+            CompressIconCacheEntry* entry =
+                compress_icon_cache_find(instance, icon_data, icon_data_size);
+            if(entry) {
+                instance->cache_stats.hits++;
+                CompressIconCacheList_unlink(entry);
+                CompressIconCacheList_push_front(instance->cache, entry);
+                *output = &entry->data[icon_data_size];
+                return;
+            }
+            instance->cache_stats.misses++;
+        }
+
         size_t decoded_size = 0;
         /* If decompression fails - check that decode_buf_size is large enough */
         furi_check(compress_decode_internal(
             instance->decoder,
             icon_data,
-            /* Decoder will check/process headers again - need to pass them */
-            sizeof(CompressHeader) + header->compressed_buff_size,
+            icon_data_size,
             instance->buffer,
             instance->buffer_size,
             &decoded_size));
         *output = instance->buffer;
+
+        if(instance->cache_size) {
+            compress_icon_cache_insert(instance, icon_data, icon_data_size, decoded_size);
+        }
     } else {
         *output = (uint8_t*)&icon_data[1];
     }
 }
 
+void compress_icon_set_cache_size(CompressIcon* instance, size_t cache_size) {
+    furi_check(instance);
+
+    instance->cache_size = cache_size;
+    compress_icon_cache_shrink(instance, cache_size);
+}
+
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats) {
+    furi_check(instance);
+    furi_check(stats);
+
+    *stats = instance->cache_stats;
+    stats->size = instance->cache_used;
+    stats->entries = CompressIconCacheList_size(instance->cache);
+}
+
 struct Compress {
     const void* config;
     heatshrink_encoder* encoder;
@@ -34,7 +34,8 @@ void compress_icon_free(CompressIcon* instance);
 /** Decompress icon
  *
  * @warning    output pointer set by this function is valid till next
- *             `compress_icon_decode` or `compress_icon_free` call
+ *             `compress_icon_decode`, `compress_icon_set_cache_size` or
+ *             `compress_icon_free` call
  *
  * @param      instance   The Compress Icon instance
  * @param      icon_data  pointer to icon data.
@@ -44,6 +45,34 @@ void compress_icon_free(CompressIcon* instance);
  */
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** output);
 
+/** Icon cache statistics */
+typedef struct {
+    uint32_t hits; /**< Decodes served from cache */
+    uint32_t misses; /**< Decodes that ran the decompressor */
+    uint32_t evictions; /**< Entries dropped to stay within the budget */
+    size_t size; /**< Memory taken by cached entries */
+    size_t entries; /**< Number of cached entries */
+} CompressIconCacheStats;
+
+/** Set icon cache budget
+ *
+ * Decoded icons are kept in a LRU cache keyed by icon data pointer, so
+ * repeated draws of the same frame don't run the decompressor. The cache
+ * never takes more than a fraction of free heap and gives memory back as
+ * free heap runs low. Cache is disabled by default.
+ *
+ * @param      instance    The Compress Icon instance
+ * @param[in]  cache_size  Max memory taken by the cache, 0 disables and empties it
+ */
+void compress_icon_set_cache_size(CompressIcon* instance, size_t cache_size);
+
+/** Get icon cache statistics
+ *
+ * @param      instance  The Compress Icon instance
+ * @param[out] stats     Statistics to fill
+ */
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats);
+
 //////////////////////////////////////////////////////////////////////////
 
 /** Compress control structure */
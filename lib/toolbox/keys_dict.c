@@ -6,16 +6,69 @@
 #include <toolbox/stream/buffered_file_stream.h>
 #include <toolbox/args.h>
 
+#include <stdlib.h>
+#include <m-array.h>
+
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_MAGIC        (0x5844494BUL) // "KIDX"
+#define KEYS_DICT_INDEX_VERSION      (1U)
+#define KEYS_DICT_INDEX_KEY_SIZE_MAX (sizeof(uint64_t))
+#define KEYS_DICT_INDEX_KEYS_MAX     (4096U)
+#define KEYS_DICT_INDEX_BUCKETS      (256U)
+#define KEYS_DICT_INDEX_BUFFER_KEYS  (32U)
+
+/*
+ * Index file layout, integers are little endian, keys are big endian as in the API:
+ * - KeysDictIndexHeader
+ * - Bucket directory: KEYS_DICT_INDEX_BUCKETS + 1 uint16_t, first sorted key of every
+ *   bucket, keys are bucketed by their first byte
+ * - Sorted keys: total_keys * key_size bytes
+ * - Keys in the text file order: total_keys * key_size bytes
+ *
+ * The index is valid while size and timestamp of the text file match the header.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t total_keys;
+    uint32_t source_size;
+    uint32_t source_timestamp;
+} FURI_PACKED KeysDictIndexHeader;
+
+#define KEYS_DICT_INDEX_DIRECTORY_SIZE (sizeof(uint16_t) * (KEYS_DICT_INDEX_BUCKETS + 1))
+#define KEYS_DICT_INDEX_SORTED_OFFSET \
+    (sizeof(KeysDictIndexHeader) + KEYS_DICT_INDEX_DIRECTORY_SIZE)
+
+ARRAY_DEF(KeysDictKeyArray, uint64_t, M_POD_OPLIST); // NOLINT
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    FuriString* path;
+
+    // Binary sidecar index, index_file is NULL when the index is not used
+    File* index_file;
+    uint16_t* index_directory;
+    size_t index_total_keys;
+    size_t index_position;
+    bool index_iterable;
+    bool index_dirty;
+    KeysDictKeyArray_t index_added;
+    KeysDictKeyArray_t index_deleted;
+
+    uint8_t index_buffer[KEYS_DICT_INDEX_BUFFER_KEYS * KEYS_DICT_INDEX_KEY_SIZE_MAX];
+    size_t index_buffer_count;
+    size_t index_buffer_position;
 };
 
-static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
+static inline bool keys_dict_add_ending_new_line(KeysDict* instance) {
+    bool new_line_added = false;
+
     if(stream_seek(instance->stream, -1, StreamOffsetFromEnd)) {
         uint8_t last_char = 0;
 
@@ -23,10 +76,13 @@ static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
         if(stream_read(instance->stream, &last_char, 1) == 1 && last_char != '\n') {
             FURI_LOG_D(TAG, "Adding new line ending");
             stream_write_char(instance->stream, '\n');
+            new_line_added = true;
         }
 
         stream_rewind(instance->stream);
     }
+
+    return new_line_added;
 }
 
 static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool* is_endfile) {
@@ -52,6 +108,308 @@ static bool keys_dict_read_key_line(KeysDict* instance, FuriString* line, bool*
     return false;
 }
 
+static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, FuriString* key_str) {
+    furi_assert(instance);
+    furi_assert(key_str);
+    furi_assert(key_int);
+
+    furi_string_reset(key_str);
+
+    for(size_t i = 0; i < instance->key_size; i++)
+        furi_string_cat_printf(key_str, "%02X", key_int[i]);
+}
+
+static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
+    furi_assert(instance);
+    furi_assert(key_str);
+    furi_assert(key_int);
+
+    uint8_t key_byte_tmp;
+    char h, l;
+
+    *key_int = 0ULL;
+
+    for(size_t i = 0; i < instance->key_size_symbols - 1; i += 2) {
+        h = furi_string_get_char(key_str, i);
+        l = furi_string_get_char(key_str, i + 1);
+
+        args_char_to_hex(h, l, &key_byte_tmp);
+        *key_int |= (uint64_t)key_byte_tmp << (8 * (instance->key_size - 1 - i / 2));
+    }
+}
+
+static uint64_t keys_dict_key_to_int(const uint8_t* key, size_t key_size) {
+    uint64_t key_int = 0;
+    for(size_t i = 0; i < key_size; i++) {
+        key_int = (key_int << 8) | key[i];
+    }
+    return key_int;
+}
+
+static void keys_dict_int_to_key(uint64_t key_int, uint8_t* key, size_t key_size) {
+    while(key_size--) {
+        key[key_size] = (uint8_t)key_int;
+        key_int >>= 8;
+    }
+}
+
+static bool keys_dict_key_array_remove(KeysDictKeyArray_t array, uint64_t key_int) {
+    for(size_t i = 0; i < KeysDictKeyArray_size(array); i++) {
+        if(*KeysDictKeyArray_get(array, i) == key_int) {
+            KeysDictKeyArray_remove_v(array, i, i + 1);
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool keys_dict_key_array_contains(const KeysDictKeyArray_t array, uint64_t key_int) {
+    for(size_t i = 0; i < KeysDictKeyArray_size(array); i++) {
+        if(*KeysDictKeyArray_cget(array, i) == key_int) return true;
+    }
+    return false;
+}
+
+static int keys_dict_key_int_compare(const void* a, const void* b) {
+    uint64_t key_a = *(const uint64_t*)a;
+    uint64_t key_b = *(const uint64_t*)b;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+static inline size_t keys_dict_key_bucket(KeysDict* instance, uint64_t key_int) {
+    return (key_int >> (8 * (instance->key_size - 1))) & 0xFF;
+}
+
+static bool keys_dict_index_is_supported(KeysDict* instance) {
+    return instance->key_size <= KEYS_DICT_INDEX_KEY_SIZE_MAX;
+}
+
+static bool keys_dict_source_stat(
+    Storage* storage,
+    const char* path,
+    uint32_t* source_size,
+    uint32_t* source_timestamp) {
+    FileInfo file_info;
+    if(storage_common_stat(storage, path, &file_info) != FSE_OK) return false;
+    if(storage_common_timestamp(storage, path, source_timestamp) != FSE_OK) return false;
+    *source_size = file_info.size;
+    return true;
+}
+
+static void keys_dict_index_close(KeysDict* instance) {
+    if(instance->index_file) {
+        storage_file_close(instance->index_file);
+        storage_file_free(instance->index_file);
+        instance->index_file = NULL;
+    }
+    if(instance->index_directory) {
+        free(instance->index_directory);
+        instance->index_directory = NULL;
+    }
+}
+
+static bool keys_dict_index_open(KeysDict* instance, Storage* storage) {
+    uint32_t source_size = 0;
+    uint32_t source_timestamp = 0;
+    if(!keys_dict_source_stat(
+           storage, furi_string_get_cstr(instance->path), &source_size, &source_timestamp)) {
+        return false;
+    }
+
+    FuriString* index_path = furi_string_alloc_printf(
+        "%s%s", furi_string_get_cstr(instance->path), KEYS_DICT_INDEX_EXTENSION);
+    instance->index_file = storage_file_alloc(storage);
+    instance->index_directory = malloc(KEYS_DICT_INDEX_DIRECTORY_SIZE);
+
+    bool index_opened = false;
+    do {
+        if(!storage_file_open(
+               instance->index_file,
+               furi_string_get_cstr(index_path),
+               FSAM_READ,
+               FSOM_OPEN_EXISTING))
+            break;
+
+        KeysDictIndexHeader header;
+        if(storage_file_read(instance->index_file, &header, sizeof(header)) != sizeof(header))
+            break;
+        if(header.magic != KEYS_DICT_INDEX_MAGIC || header.version != KEYS_DICT_INDEX_VERSION ||
+           header.key_size != instance->key_size || header.source_size != source_size ||
+           header.source_timestamp != source_timestamp) {
+            FURI_LOG_D(TAG, "Index is outdated");
+            break;
+        }
+
+        if(storage_file_read(
+               instance->index_file, instance->index_directory, KEYS_DICT_INDEX_DIRECTORY_SIZE) !=
+           KEYS_DICT_INDEX_DIRECTORY_SIZE)
+            break;
+        if(instance->index_directory[KEYS_DICT_INDEX_BUCKETS] != header.total_keys) break;
+
+        instance->index_total_keys = header.total_keys;
+        index_opened = true;
+    } while(false);
+
+    furi_string_free(index_path);
+
+    if(!index_opened) keys_dict_index_close(instance);
+
+    return index_opened;
+}
+
+static bool keys_dict_index_save(KeysDict* instance, Storage* storage, KeysDictKeyArray_t keys) {
+    const size_t total_keys = KeysDictKeyArray_size(keys);
+    if(total_keys > KEYS_DICT_INDEX_KEYS_MAX) {
+        FURI_LOG_W(TAG, "Too many keys to index: %zu", total_keys);
+        return false;
+    }
+
+    KeysDictIndexHeader header = {
+        .magic = KEYS_DICT_INDEX_MAGIC,
+        .version = KEYS_DICT_INDEX_VERSION,
+        .key_size = instance->key_size,
+        .total_keys = total_keys,
+    };
+    if(!keys_dict_source_stat(
+           storage,
+           furi_string_get_cstr(instance->path),
+           &header.source_size,
+           &header.source_timestamp)) {
+        return false;
+    }
+
+    uint64_t* sorted = malloc(sizeof(uint64_t) * MAX(total_keys, 1U));
+    for(size_t i = 0; i < total_keys; i++) {
+        sorted[i] = *KeysDictKeyArray_get(keys, i);
+    }
+    qsort(sorted, total_keys, sizeof(uint64_t), keys_dict_key_int_compare);
+
+    uint16_t* directory = malloc(KEYS_DICT_INDEX_DIRECTORY_SIZE);
+    size_t key_idx = 0;
+    for(size_t bucket = 0; bucket <= KEYS_DICT_INDEX_BUCKETS; bucket++) {
+        while(key_idx < total_keys && keys_dict_key_bucket(instance, sorted[key_idx]) < bucket) {
+            key_idx++;
+        }
+        directory[bucket] = key_idx;
+    }
+
+    FuriString* index_path = furi_string_alloc_printf(
+        "%s%s", furi_string_get_cstr(instance->path), KEYS_DICT_INDEX_EXTENSION);
+    File* file = storage_file_alloc(storage);
+
+    bool index_saved = false;
+    do {
+        if(!storage_file_open(
+               file, furi_string_get_cstr(index_path), FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(storage_file_write(file, directory, KEYS_DICT_INDEX_DIRECTORY_SIZE) !=
+           KEYS_DICT_INDEX_DIRECTORY_SIZE)
+            break;
+
+        uint8_t key[KEYS_DICT_INDEX_KEY_SIZE_MAX];
+        bool keys_written = true;
+        for(size_t i = 0; keys_written && i < total_keys; i++) {
+            keys_dict_int_to_key(sorted[i], key, instance->key_size);
+            keys_written = storage_file_write(file, key, instance->key_size) ==
+                           instance->key_size;
+        }
+        for(size_t i = 0; keys_written && i < total_keys; i++) {
+            keys_dict_int_to_key(*KeysDictKeyArray_get(keys, i), key, instance->key_size);
+            keys_written = storage_file_write(file, key, instance->key_size) ==
+                           instance->key_size;
+        }
+        index_saved = keys_written;
+    } while(false);
+
+    storage_file_close(file);
+    if(!index_saved) {
+        FURI_LOG_W(TAG, "Failed to save index");
+        storage_simply_remove(storage, furi_string_get_cstr(index_path));
+    }
+
+    storage_file_free(file);
+    furi_string_free(index_path);
+    free(directory);
+    free(sorted);
+
+    return index_saved;
+}
+
+static bool keys_dict_index_contains(KeysDict* instance, uint64_t key_int) {
+    const size_t bucket = keys_dict_key_bucket(instance, key_int);
+    const size_t key_size = instance->key_size;
+    size_t key_idx = instance->index_directory[bucket];
+    const size_t bucket_end = instance->index_directory[bucket + 1];
+
+    uint8_t buffer[KEYS_DICT_INDEX_BUFFER_KEYS * KEYS_DICT_INDEX_KEY_SIZE_MAX];
+    bool key_found = false;
+
+    while(!key_found && key_idx < bucket_end) {
+        size_t keys_to_read = MIN(bucket_end - key_idx, (size_t)KEYS_DICT_INDEX_BUFFER_KEYS);
+        size_t bytes_to_read = keys_to_read * key_size;
+
+        if(!storage_file_seek(
+               instance->index_file, KEYS_DICT_INDEX_SORTED_OFFSET + key_idx * key_size, true))
+            break;
+        if(storage_file_read(instance->index_file, buffer, bytes_to_read) != bytes_to_read) break;
+
+        for(size_t i = 0; i < keys_to_read; i++) {
+            uint64_t index_key = keys_dict_key_to_int(&buffer[i * key_size], key_size);
+            if(index_key == key_int) {
+                key_found = true;
+                break;
+            } else if(index_key > key_int) {
+                // Bucket is sorted, the key can't be further
+                key_idx = bucket_end;
+                break;
+            }
+        }
+        if(key_idx < bucket_end) key_idx += keys_to_read;
+    }
+
+    // Iteration reads through its own buffer, it only needs a seek on the next refill
+    instance->index_buffer_position = instance->index_buffer_count;
+
+    return key_found;
+}
+
+static bool keys_dict_index_get_next_key(KeysDict* instance, uint8_t* key) {
+    const size_t key_size = instance->key_size;
+
+    if(instance->index_buffer_position >= instance->index_buffer_count) {
+        if(instance->index_position >= instance->index_total_keys) return false;
+
+        size_t keys_to_read = MIN(
+            instance->index_total_keys - instance->index_position,
+            (size_t)KEYS_DICT_INDEX_BUFFER_KEYS);
+        size_t bytes_to_read = keys_to_read * key_size;
+        size_t ordered_offset = KEYS_DICT_INDEX_SORTED_OFFSET +
+                                instance->index_total_keys * key_size +
+                                instance->index_position * key_size;
+
+        if(!storage_file_seek(instance->index_file, ordered_offset, true)) return false;
+        if(storage_file_read(instance->index_file, instance->index_buffer, bytes_to_read) !=
+           bytes_to_read)
+            return false;
+
+        instance->index_buffer_count = keys_to_read;
+        instance->index_buffer_position = 0;
+    }
+
+    memcpy(key, &instance->index_buffer[instance->index_buffer_position * key_size], key_size);
+    instance->index_buffer_position++;
+    instance->index_position++;
+
+    return true;
+}
+
+static void keys_dict_index_mark_modified(KeysDict* instance) {
+    instance->index_dirty = true;
+    // Iterate over the text from now on, it has keys the index doesn't know about
+    instance->index_iterable = false;
+}
+
 bool keys_dict_check_presence(const char* path) {
     furi_check(path);
 
@@ -82,75 +440,120 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     instance->total_keys = 0;
 
+    instance->path = furi_string_alloc_set(path);
+    KeysDictKeyArray_init(instance->index_added);
+    KeysDictKeyArray_init(instance->index_deleted);
+
     bool file_exists =
         buffered_file_stream_open(instance->stream, path, FSAM_READ_WRITE, open_mode);
 
     if(!file_exists) {
         buffered_file_stream_close(instance->stream);
-    } else {
-        // Eventually add new line character in the last line to avoid skipping keys
-        keys_dict_add_ending_new_line(instance);
+    } else if(keys_dict_add_ending_new_line(instance)) {
+        // The text is modified, its size and timestamp will change on close
+        instance->index_dirty = true;
     }
 
-    FuriString* line = furi_string_alloc();
-
-    bool is_endfile = false;
+    if(file_exists && keys_dict_index_is_supported(instance) && !instance->index_dirty &&
+       keys_dict_index_open(instance, storage)) {
+        instance->total_keys = instance->index_total_keys;
+        instance->index_iterable = true;
+    } else if(file_exists) {
+        KeysDictKeyArray_t keys;
+        KeysDictKeyArray_init(keys);
+
+        FuriString* line = furi_string_alloc();
+        bool is_endfile = false;
+        bool collect_keys = keys_dict_index_is_supported(instance);
+
+        // In this loop we only count the entries in the file and collect them for the index
+        // We prefer not to load the whole file in memory for space reasons
+        while(!is_endfile) {
+            bool read_key = keys_dict_read_key_line(instance, line, &is_endfile);
+            if(read_key) {
+                instance->total_keys++;
+
+                if(collect_keys && instance->total_keys > KEYS_DICT_INDEX_KEYS_MAX) {
+                    collect_keys = false;
+                    KeysDictKeyArray_reset(keys);
+                } else if(collect_keys) {
+                    uint64_t key_int = 0;
+                    keys_dict_str_to_int(instance, line, &key_int);
+                    KeysDictKeyArray_push_back(keys, key_int);
+                }
+            }
+        }
+        stream_rewind(instance->stream);
 
-    // In this loop we only count the entries in the file
-    // We prefer not to load the whole file in memory for space reasons
-    while(file_exists && !is_endfile) {
-        bool read_key = keys_dict_read_key_line(instance, line, &is_endfile);
-        if(read_key) {
-            instance->total_keys++;
+        if(collect_keys && !instance->index_dirty &&
+           keys_dict_index_save(instance, storage, keys) &&
+           keys_dict_index_open(instance, storage)) {
+            instance->index_iterable = true;
         }
+
+        furi_string_free(line);
+        KeysDictKeyArray_clear(keys);
     }
-    stream_rewind(instance->stream);
-    FURI_LOG_I(TAG, "Loaded dictionary with %zu keys", instance->total_keys);
 
-    furi_string_free(line);
+    FURI_LOG_I(
+        TAG,
+        "Loaded dictionary with %zu keys%s",
+        instance->total_keys,
+        instance->index_file ? " from index" : "");
 
     return instance;
 }
 
-void keys_dict_free(KeysDict* instance) {
-    furi_check(instance);
-    furi_check(instance->stream);
+static void keys_dict_index_rebuild(KeysDict* instance, Storage* storage) {
+    KeysDictKeyArray_t keys;
+    KeysDictKeyArray_init(keys);
 
-    buffered_file_stream_close(instance->stream);
-    stream_free(instance->stream);
-    free(instance);
+    FuriString* line = furi_string_alloc();
+    bool is_endfile = false;
+    bool keys_fit = true;
 
-    furi_record_close(RECORD_STORAGE);
-}
+    stream_rewind(instance->stream);
+    while(keys_fit && !is_endfile) {
+        if(keys_dict_read_key_line(instance, line, &is_endfile)) {
+            uint64_t key_int = 0;
+            keys_dict_str_to_int(instance, line, &key_int);
+            KeysDictKeyArray_push_back(keys, key_int);
+            keys_fit = KeysDictKeyArray_size(keys) <= KEYS_DICT_INDEX_KEYS_MAX;
+        }
+    }
+    furi_string_free(line);
 
-static void keys_dict_int_to_str(KeysDict* instance, const uint8_t* key_int, FuriString* key_str) {
-    furi_assert(instance);
-    furi_assert(key_str);
-    furi_assert(key_int);
+    // Index is validated against the size and timestamp of the closed file
+    buffered_file_stream_close(instance->stream);
 
-    furi_string_reset(key_str);
+    if(keys_fit) {
+        keys_dict_index_save(instance, storage, keys);
+    }
 
-    for(size_t i = 0; i < instance->key_size; i++)
-        furi_string_cat_printf(key_str, "%02X", key_int[i]);
+    KeysDictKeyArray_clear(keys);
 }
 
-static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int) {
-    furi_assert(instance);
-    furi_assert(key_str);
-    furi_assert(key_int);
+void keys_dict_free(KeysDict* instance) {
+    furi_check(instance);
+    furi_check(instance->stream);
 
-    uint8_t key_byte_tmp;
-    char h, l;
+    keys_dict_index_close(instance);
 
-    *key_int = 0ULL;
+    if(instance->index_dirty && keys_dict_index_is_supported(instance)) {
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        keys_dict_index_rebuild(instance, storage);
+        furi_record_close(RECORD_STORAGE);
+    } else {
+        buffered_file_stream_close(instance->stream);
+    }
 
-    for(size_t i = 0; i < instance->key_size_symbols - 1; i += 2) {
-        h = furi_string_get_char(key_str, i);
-        l = furi_string_get_char(key_str, i + 1);
+    stream_free(instance->stream);
+    KeysDictKeyArray_clear(instance->index_added);
+    KeysDictKeyArray_clear(instance->index_deleted);
+    furi_string_free(instance->path);
+    free(instance);
 
-        args_char_to_hex(h, l, &key_byte_tmp);
-        *key_int |= (uint64_t)key_byte_tmp << (8 * (instance->key_size - 1 - i / 2));
-    }
+    furi_record_close(RECORD_STORAGE);
 }
 
 size_t keys_dict_get_total_keys(KeysDict* instance) {
@@ -163,6 +566,10 @@ bool keys_dict_rewind(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
+    instance->index_position = 0;
+    instance->index_buffer_count = 0;
+    instance->index_buffer_position = 0;
+
     return stream_rewind(instance->stream);
 }
 
@@ -182,30 +589,85 @@ static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
     return key_read;
 }
 
+static bool keys_dict_get_next_text_key(KeysDict* instance, uint8_t* key, size_t key_size) {
+    FuriString* temp_key = furi_string_alloc();
+
+    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
+
+    if(key_read) {
+        uint64_t key_int = 0;
+        keys_dict_str_to_int(instance, temp_key, &key_int);
+        keys_dict_int_to_key(key_int, key, key_size);
+    }
+
+    furi_string_free(temp_key);
+    return key_read;
+}
+
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     furi_check(instance);
     furi_check(instance->stream);
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
-    FuriString* temp_key = furi_string_alloc();
+    if(instance->index_file && instance->index_iterable) {
+        return keys_dict_index_get_next_key(instance, key);
+    }
 
-    bool key_read = keys_dict_get_next_key_str(instance, temp_key);
+    return keys_dict_get_next_text_key(instance, key, key_size);
+}
 
-    if(key_read) {
-        size_t tmp_len = key_size;
-        uint64_t key_int = 0;
+size_t keys_dict_get_next_keys(
+    KeysDict* instance,
+    uint8_t* keys,
+    size_t key_size,
+    size_t keys_count) {
+    furi_check(instance);
+    furi_check(instance->stream);
+    furi_check(instance->key_size == key_size);
+    furi_check(keys);
 
-        keys_dict_str_to_int(instance, temp_key, &key_int);
+    size_t keys_read = 0;
+
+    if(instance->index_file && instance->index_iterable) {
+        // Drain the iteration buffer first, then read the rest straight into keys
+        while(keys_read < keys_count &&
+              instance->index_buffer_position < instance->index_buffer_count) {
+            keys_dict_index_get_next_key(instance, &keys[keys_read * key_size]);
+            keys_read++;
+        }
+
+        size_t keys_to_read =
+            MIN(keys_count - keys_read, instance->index_total_keys - instance->index_position);
+        if(keys_to_read) {
+            size_t bytes_to_read = keys_to_read * key_size;
+            size_t ordered_offset = KEYS_DICT_INDEX_SORTED_OFFSET +
+                                    instance->index_total_keys * key_size +
+                                    instance->index_position * key_size;
+
+            uint8_t* keys_left = &keys[keys_read * key_size];
+
+            if(storage_file_seek(instance->index_file, ordered_offset, true) &&
+               storage_file_read(instance->index_file, keys_left, bytes_to_read) ==
+                   bytes_to_read) {
+                instance->index_position += keys_to_read;
+                keys_read += keys_to_read;
+            }
+        }
+    } else {
+        FuriString* temp_key = furi_string_alloc();
 
-        while(tmp_len--) {
-            key[tmp_len] = (uint8_t)key_int;
-            key_int >>= 8;
+        while(keys_read < keys_count && keys_dict_get_next_key_str(instance, temp_key)) {
+            uint64_t key_int = 0;
+            keys_dict_str_to_int(instance, temp_key, &key_int);
+            keys_dict_int_to_key(key_int, &keys[keys_read * key_size], key_size);
+            keys_read++;
         }
+
+        furi_string_free(temp_key);
     }
 
-    furi_string_free(temp_key);
-    return key_read;
+    return keys_read;
 }
 
 static bool keys_dict_is_key_present_str(KeysDict* instance, FuriString* key) {
@@ -240,6 +702,13 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index_file) {
+        uint64_t key_int = keys_dict_key_to_int(key, key_size);
+        if(keys_dict_key_array_contains(instance->index_added, key_int)) return true;
+        if(keys_dict_key_array_contains(instance->index_deleted, key_int)) return false;
+        return keys_dict_index_contains(instance, key_int);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -271,6 +740,20 @@ static bool keys_dict_add_key_str(KeysDict* instance, FuriString* key) {
     return key_added;
 }
 
+// Index keeps keys in the text order, continue the text from the same key
+static void keys_dict_index_continue_in_text(KeysDict* instance) {
+    if(!instance->index_file || !instance->index_iterable) return;
+
+    FuriString* line = furi_string_alloc();
+
+    stream_rewind(instance->stream);
+    for(size_t i = 0; i < instance->index_position; i++) {
+        if(!keys_dict_get_next_key_str(instance, line)) break;
+    }
+
+    furi_string_free(line);
+}
+
 bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size) {
     furi_check(instance);
     furi_check(instance->stream);
@@ -282,6 +765,15 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     keys_dict_int_to_str(instance, key, temp_key);
     bool key_added = keys_dict_add_key_str(instance, temp_key);
 
+    if(key_added && keys_dict_index_is_supported(instance)) {
+        uint64_t key_int = keys_dict_key_to_int(key, key_size);
+        if(!keys_dict_key_array_remove(instance->index_deleted, key_int)) {
+            KeysDictKeyArray_push_back(instance->index_added, key_int);
+        }
+        keys_dict_index_continue_in_text(instance);
+        keys_dict_index_mark_modified(instance);
+    }
+
     FURI_LOG_I(TAG, "Added key %s", furi_string_get_cstr(temp_key));
 
     furi_string_free(temp_key);
@@ -302,7 +794,7 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
     stream_rewind(instance->stream);
 
     while(!key_removed) {
-        if(!keys_dict_get_next_key(instance, temp_key, key_size)) {
+        if(!keys_dict_get_next_text_key(instance, temp_key, key_size)) {
             break;
         }
 
@@ -320,6 +812,16 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     keys_dict_int_to_str(instance, key, tmp);
 
+    if(key_removed && keys_dict_index_is_supported(instance)) {
+        uint64_t key_int = keys_dict_key_to_int(key, key_size);
+        if(!keys_dict_key_array_remove(instance->index_added, key_int) &&
+           !keys_dict_is_key_present_str(instance, tmp)) {
+            // Duplicated keys stay present until their last copy is removed
+            KeysDictKeyArray_push_back(instance->index_deleted, key_int);
+        }
+        keys_dict_index_mark_modified(instance);
+    }
+
     FURI_LOG_I(TAG, "Removed key %s", furi_string_get_cstr(tmp));
 
     furi_string_free(tmp);
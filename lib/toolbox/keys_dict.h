@@ -8,6 +8,9 @@
 extern "C" {
 #endif
 
+/** Extension appended to the list path to get its binary index path */
+#define KEYS_DICT_INDEX_EXTENSION ".idx"
+
 typedef enum {
     KeysDictModeOpenExisting,
     KeysDictModeOpenAlways,
@@ -25,6 +28,8 @@ bool keys_dict_check_presence(const char* path);
 
 /** Open or create list
  * Depending on mode, list will be opened or created.
+ * Lists of keys up to 8 bytes get a binary index next to them, it is rebuilt when
+ * the list changes and makes presence checks independent of the list size.
  *
  * @param path      - Path of the file that contain the list
  * @param mode      - ListKeysMode value
@@ -78,7 +83,25 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
 */
 bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size);
 
+/** Get next block of keys from the list
+ * Same as keys_dict_get_next_key() for up to keys_count keys, without per key
+ * allocations. Keys are stored back to back, key_size bytes each.
+ *
+ * @param instance    - KeysDict list instance
+ * @param keys        - Array where to store keys, keys_count * key_size bytes
+ * @param key_size    - Size of key in bytes
+ * @param keys_count  - Maximum number of keys to read
+ *
+ * @return Returns number of keys read, less than keys_count at the end of the list
+*/
+size_t keys_dict_get_next_keys(
+    KeysDict* instance,
+    uint8_t* keys,
+    size_t key_size,
+    size_t keys_count);
+
 /** Add key to list
+ * Key is added to the end of the list, iteration continues from the current key.
  *
  * @param instance  - KeysDict list instance
  * @param key       - Key to add
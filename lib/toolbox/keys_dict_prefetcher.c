@@ -0,0 +1,173 @@
+#include "keys_dict_prefetcher.h"
+
+#include <furi.h>
+
+#define TAG "KeysDictPrefetcher"
+
+#define KEYS_DICT_PREFETCHER_STACK_SIZE (2048U)
+
+typedef enum {
+    KeysDictPrefetcherFlagFill = (1 << 0),
+    KeysDictPrefetcherFlagRewind = (1 << 1),
+    KeysDictPrefetcherFlagExit = (1 << 2),
+} KeysDictPrefetcherFlag;
+
+struct KeysDictPrefetcher {
+    KeysDict* dict;
+    size_t key_size;
+
+    FuriThread* thread;
+    FuriSemaphore* block_ready;
+
+    // Owned by the worker while fill_pending is set
+    uint8_t* blocks[2];
+    size_t blocks_count[2];
+    size_t fill_idx;
+    bool fill_pending;
+
+    uint8_t* first_block;
+    size_t first_count;
+
+    const uint8_t* current;
+    size_t current_count;
+    size_t current_position;
+};
+
+static int32_t keys_dict_prefetcher_worker(void* context) {
+    KeysDictPrefetcher* instance = context;
+    const uint32_t flags_all = KeysDictPrefetcherFlagFill | KeysDictPrefetcherFlagRewind |
+                               KeysDictPrefetcherFlagExit;
+
+    while(true) {
+        uint32_t flags = furi_thread_flags_wait(flags_all, FuriFlagWaitAny, FuriWaitForever);
+        furi_check((flags & FuriFlagError) == 0);
+
+        if(flags & KeysDictPrefetcherFlagExit) break;
+
+        uint8_t* block = instance->blocks[instance->fill_idx];
+
+        if(flags & KeysDictPrefetcherFlagRewind) {
+            keys_dict_rewind(instance->dict);
+            // The first block is served from memory, skip it
+            keys_dict_get_next_keys(
+                instance->dict, block, instance->key_size, instance->first_count);
+        }
+
+        instance->blocks_count[instance->fill_idx] = keys_dict_get_next_keys(
+            instance->dict, block, instance->key_size, KEYS_DICT_PREFETCHER_BLOCK_KEYS);
+
+        furi_semaphore_release(instance->block_ready);
+    }
+
+    return 0;
+}
+
+static void keys_dict_prefetcher_request(KeysDictPrefetcher* instance, uint32_t flags) {
+    instance->fill_pending = true;
+    furi_thread_flags_set(furi_thread_get_id(instance->thread), flags);
+}
+
+static void keys_dict_prefetcher_wait(KeysDictPrefetcher* instance) {
+    if(instance->fill_pending) {
+        furi_check(
+            furi_semaphore_acquire(instance->block_ready, FuriWaitForever) == FuriStatusOk);
+        instance->fill_pending = false;
+    }
+}
+
+KeysDictPrefetcher* keys_dict_prefetcher_alloc(KeysDict* dict, size_t key_size) {
+    furi_check(dict);
+    furi_check(key_size > 0);
+
+    KeysDictPrefetcher* instance = malloc(sizeof(KeysDictPrefetcher));
+
+    instance->dict = dict;
+    instance->key_size = key_size;
+
+    const size_t block_size = KEYS_DICT_PREFETCHER_BLOCK_KEYS * key_size;
+    instance->first_block = malloc(block_size);
+    instance->blocks[0] = malloc(block_size);
+    instance->blocks[1] = malloc(block_size);
+
+    keys_dict_rewind(dict);
+    instance->first_count = keys_dict_get_next_keys(
+        dict, instance->first_block, key_size, KEYS_DICT_PREFETCHER_BLOCK_KEYS);
+
+    instance->current = instance->first_block;
+    instance->current_count = instance->first_count;
+
+    instance->block_ready = furi_semaphore_alloc(1, 0);
+    instance->thread = furi_thread_alloc_ex(
+        TAG, KEYS_DICT_PREFETCHER_STACK_SIZE, keys_dict_prefetcher_worker, instance);
+    furi_thread_start(instance->thread);
+
+    if(instance->first_count == KEYS_DICT_PREFETCHER_BLOCK_KEYS) {
+        keys_dict_prefetcher_request(instance, KeysDictPrefetcherFlagFill);
+    }
+
+    return instance;
+}
+
+void keys_dict_prefetcher_free(KeysDictPrefetcher* instance) {
+    furi_check(instance);
+
+    furi_thread_flags_set(furi_thread_get_id(instance->thread), KeysDictPrefetcherFlagExit);
+    furi_thread_join(instance->thread);
+    furi_thread_free(instance->thread);
+    furi_semaphore_free(instance->block_ready);
+
+    free(instance->first_block);
+    free(instance->blocks[0]);
+    free(instance->blocks[1]);
+    free(instance);
+}
+
+bool keys_dict_prefetcher_get_next_key(
+    KeysDictPrefetcher* instance,
+    uint8_t* key,
+    size_t key_size) {
+    furi_check(instance);
+    furi_check(instance->key_size == key_size);
+    furi_check(key);
+
+    if(instance->current_position == instance->current_count) {
+        // A short block is the last one
+        if(instance->current_count < KEYS_DICT_PREFETCHER_BLOCK_KEYS) return false;
+        if(!instance->fill_pending) return false;
+
+        keys_dict_prefetcher_wait(instance);
+
+        instance->current = instance->blocks[instance->fill_idx];
+        instance->current_count = instance->blocks_count[instance->fill_idx];
+        instance->current_position = 0;
+        instance->fill_idx ^= 1;
+
+        if(instance->current_count == KEYS_DICT_PREFETCHER_BLOCK_KEYS) {
+            keys_dict_prefetcher_request(instance, KeysDictPrefetcherFlagFill);
+        }
+        if(instance->current_count == 0) return false;
+    }
+
+    memcpy(key, &instance->current[instance->current_position * key_size], key_size);
+    instance->current_position++;
+
+    return true;
+}
+
+void keys_dict_prefetcher_rewind(KeysDictPrefetcher* instance) {
+    furi_check(instance);
+
+    if(instance->current != instance->first_block) {
+        // Drop the block in flight and read the list again right after the first block
+        keys_dict_prefetcher_wait(instance);
+        instance->current = instance->first_block;
+        instance->current_count = instance->first_count;
+
+        if(instance->first_count == KEYS_DICT_PREFETCHER_BLOCK_KEYS) {
+            keys_dict_prefetcher_request(instance, KeysDictPrefetcherFlagRewind);
+        }
+    }
+
+    // Still in the first block, the block in flight is the second one anyway
+    instance->current_position = 0;
+}
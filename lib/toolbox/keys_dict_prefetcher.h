@@ -0,0 +1,55 @@
+#pragma once
+
+#include "keys_dict.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of keys decoded by the background thread at once */
+#define KEYS_DICT_PREFETCHER_BLOCK_KEYS (256U)
+
+typedef struct KeysDictPrefetcher KeysDictPrefetcher;
+
+/** Allocate prefetcher and start reading keys in background
+ * The first block is read synchronously and kept in memory, so rewinding
+ * never waits on storage until the first block is consumed. The list must not
+ * be accessed directly until the prefetcher is freed.
+ *
+ * @param dict      - KeysDict list instance
+ * @param key_size  - Size of key in bytes
+ *
+ * @return Returns KeysDictPrefetcher instance
+*/
+KeysDictPrefetcher* keys_dict_prefetcher_alloc(KeysDict* dict, size_t key_size);
+
+/** Stop background reading and free prefetcher
+ *
+ * @param instance  - KeysDictPrefetcher instance
+*/
+void keys_dict_prefetcher_free(KeysDictPrefetcher* instance);
+
+/** Get next key
+ * Returns keys in the list order. Only waits on storage when the keys are
+ * consumed faster than they can be read.
+ *
+ * @param instance  - KeysDictPrefetcher instance
+ * @param key       - Array where to store key
+ * @param key_size  - Size of key in bytes
+ *
+ * @return Returns true if key was retrieved, false at the end of the list
+*/
+bool keys_dict_prefetcher_get_next_key(
+    KeysDictPrefetcher* instance,
+    uint8_t* key,
+    size_t key_size);
+
+/** Start over from the first key
+ *
+ * @param instance  - KeysDictPrefetcher instance
+*/
+void keys_dict_prefetcher_rewind(KeysDictPrefetcher* instance);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+import re
+import struct
+import sys
+
+import serial
+from elftools.elf.elffile import ELFFile
+from flipper.app import App
+from flipper.utils.cdc import resolve_port
+
+# Must match FuriLogRecord in furi/core/log.c
+RECORD_HEADER = struct.Struct("<BBBBIII")
+RECORD_FLAG_RAW = 1 << 0
+
+LEVELS = {
+    2: ("E", "\033[0;31m"),
+    3: ("W", "\033[0;33m"),
+    4: ("I", "\033[0;32m"),
+    5: ("D", "\033[0;34m"),
+    6: ("T", "\033[0;35m"),
+}
+COLOR_RESET = "\033[0m"
+
+# Must match furi_log_parse_spec in furi/core/log.c
+SPEC_RE = re.compile(
+    rb"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|z|j|t)?([diuxXocpfFeEgGs%])"
+)
+
+
+class Firmware:
+    def __init__(self, elf_file):
+        self.segments = []
+        elf = ELFFile(elf_file)
+        for segment in elf.iter_segments():
+            if segment["p_type"] == "PT_LOAD" and segment["p_filesz"]:
+                self.segments.append((segment["p_vaddr"], segment.data()))
+        self.strings = {}
+
+    def string(self, address):
+        if address in self.strings:
+            return self.strings[address]
+        for start, data in self.segments:
+            if start <= address < start + len(data):
+                offset = address - start
+                end = data.index(b"\0", offset)
+                self.strings[address] = data[offset:end]
+                return self.strings[address]
+        return b"<0x%08x>" % address
+
+
+class Payload:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def unpack(self, fmt):
+        value = struct.unpack_from(fmt, self.data, self.offset)[0]
+        self.offset += struct.calcsize(fmt)
+        return value
+
+    def string(self):
+        end = self.data.index(b"\0", self.offset)
+        value = self.data[self.offset : end]
+        self.offset = end + 1
+        return value.decode("utf-8", errors="replace")
+
+
+def format_message(fmt, payload):
+    result = []
+    position = 0
+    for match in SPEC_RE.finditer(fmt):
+        result.append(fmt[position : match.start()].decode("utf-8", errors="replace"))
+        position = match.end()
+        flags, width, precision, length, conversion = (
+            group.decode() if group is not None else None for group in match.groups()
+        )
+        if conversion == "%":
+            result.append("%")
+            continue
+        if width == "*":
+            width = str(payload.unpack("<i"))
+        if precision == "*":
+            precision = str(payload.unpack("<i"))
+        spec = "%" + flags + (width or "")
+        if precision is not None:
+            spec += "." + precision
+
+        wide = length in ("ll", "j")
+        if conversion in "di":
+            value = payload.unpack("<q" if wide else "<i")
+            result.append((spec + "d") % value)
+        elif conversion in "uxXo":
+            value = payload.unpack("<Q" if wide else "<I")
+            result.append((spec + conversion.replace("u", "d")) % value)
+        elif conversion == "c":
+            result.append((spec + "c") % chr(payload.unpack("<I") & 0xFF))
+        elif conversion == "p":
+            result.append((spec + "s") % ("0x%x" % payload.unpack("<I")))
+        elif conversion == "s":
+            result.append((spec + "s") % payload.string())
+        else:
+            result.append((spec + conversion) % payload.unpack("<d"))
+    result.append(fmt[position:].decode("utf-8", errors="replace"))
+    return "".join(result)
+
+
+def format_record(firmware, record):
+    size, level, flags, _, tick, tag, fmt = RECORD_HEADER.unpack_from(record)
+    payload = Payload(record[RECORD_HEADER.size : size])
+    message = format_message(firmware.string(fmt), payload)
+    if flags & RECORD_FLAG_RAW:
+        return message
+    letter, color = LEVELS.get(level, (" ", COLOR_RESET))
+    tag = firmware.string(tag).decode("utf-8", errors="replace")
+    return f"{tick} {color}[{letter}][{tag}] {COLOR_RESET}{message}\r\n"
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("elf", help="Firmware ELF file")
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+        self.parser.add_argument("-l", "--level", help="Log level", default="default")
+        self.parser.add_argument(
+            "-i", "--input", help="Decode captured stream instead of the device"
+        )
+        self.parser.set_defaults(func=self.decode)
+
+    def _open_source(self):
+        if self.args.input:
+            return open(self.args.input, "rb")
+
+        if not (port := resolve_port(self.logger, self.args.port)):
+            self.logger.error("Is Flipper connected via USB and not in DFU mode?")
+            return None
+        source = serial.Serial(port, timeout=1)
+        source.write(f"\rlog {self.args.level} binary\r".encode())
+        return source
+
+    def decode(self):
+        with open(self.args.elf, "rb") as elf_file:
+            firmware = Firmware(elf_file)
+
+        source = self._open_source()
+        if source is None:
+            return 1
+
+        output = sys.stdout
+        try:
+            while True:
+                data = source.read(1)
+                if not data:
+                    if self.args.input:
+                        break
+                    continue
+                if data != b"\0":
+                    output.write(data.decode("utf-8", errors="replace"))
+                    continue
+                size = source.read(1)
+                record = size + source.read(size[0] - 1)
+                output.write(format_record(firmware, record))
+                output.flush()
+        except KeyboardInterrupt:
+            pass
+        finally:
+            if not self.args.input:
+                # Ctrl+C stops the log command
+                source.write(b"\x03")
+            source.close()
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
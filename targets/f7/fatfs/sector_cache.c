@@ -1,56 +1,249 @@
 #include "sector_cache.h"
 
 #include <stddef.h>
-#include <stdio.h>
 #include <string.h>
 #include <furi.h>
 #include <furi_hal_memory.h>
+#include <furi_hal_sd.h>
 
-#define SECTOR_SIZE 512
-#define N_SECTORS   8
+#define SECTOR_SIZE      512
+#define SECTOR_SIZE_U32  (SECTOR_SIZE / sizeof(uint32_t))
+#define SECTOR_SLOT_NONE SECTOR_CACHE_SECTORS
+#define SECTOR_NONE      UINT32_MAX
 
 typedef struct {
-    uint32_t itr;
-    uint32_t sectors[N_SECTORS];
-    uint8_t sector_data[N_SECTORS][SECTOR_SIZE];
+    uint32_t sector;
+    uint32_t last_used;
+    bool valid;
+    bool dirty;
+} SectorCacheSlot;
+
+typedef struct {
+    uint32_t tick;
+    uint32_t last_read;
+    uint32_t sector_count;
+    SectorCacheStats stats;
+    SectorCacheSlot slots[SECTOR_CACHE_SECTORS];
+    uint32_t sector_data[SECTOR_CACHE_SECTORS][SECTOR_SIZE_U32];
+    uint32_t batch_data[SECTOR_CACHE_BATCH_SECTORS][SECTOR_SIZE_U32];
 } SectorCache;
 
 static SectorCache* cache = NULL;
 
+static bool sector_cache_device_read(uint8_t* buff, uint32_t sector, uint32_t count) {
+    return furi_hal_sd_read_blocks((uint32_t*)buff, sector, count) == FuriStatusOk;
+}
+
+static bool sector_cache_device_write(const uint8_t* buff, uint32_t sector, uint32_t count) {
+    return furi_hal_sd_write_blocks((const uint32_t*)buff, sector, count) == FuriStatusOk;
+}
+
+static size_t sector_cache_find(uint32_t sector) {
+    for(size_t i = 0; i < SECTOR_CACHE_SECTORS; ++i) {
+        if(cache->slots[i].valid && cache->slots[i].sector == sector) {
+            return i;
+        }
+    }
+    return SECTOR_SLOT_NONE;
+}
+
+static void sector_cache_touch(size_t slot) {
+    cache->slots[slot].last_used = ++cache->tick;
+}
+
+/* Take the least recently used slot. A dirty victim is written back together with
+ * all other dirty sectors, unless flush is not allowed (batch buffer is in use). */
+static size_t sector_cache_allocate(uint32_t sector, bool flush) {
+    size_t victim = 0;
+    for(size_t i = 0; i < SECTOR_CACHE_SECTORS; ++i) {
+        if(!cache->slots[i].valid) {
+            victim = i;
+            break;
+        }
+        if(cache->slots[i].last_used < cache->slots[victim].last_used) {
+            victim = i;
+        }
+    }
+
+    if(cache->slots[victim].valid && cache->slots[victim].dirty) {
+        if(!flush || !sector_cache_flush()) {
+            return SECTOR_SLOT_NONE;
+        }
+    }
+
+    cache->slots[victim].sector = sector;
+    cache->slots[victim].valid = true;
+    cache->slots[victim].dirty = false;
+    sector_cache_touch(victim);
+
+    return victim;
+}
+
 void sector_cache_init(void) {
     if(cache == NULL) {
         cache = memmgr_alloc_from_pool(sizeof(SectorCache));
     }
 
-    if(cache != NULL) {
-        memset(cache, 0, sizeof(SectorCache));
+    memset(cache, 0, sizeof(SectorCache));
+    cache->last_read = SECTOR_NONE;
+
+    // Read-ahead must stay within the card, failed reads are retried with card reset
+    FuriHalSdInfo sd_info;
+    if(furi_hal_sd_info(&sd_info) == FuriStatusOk) {
+        cache->sector_count = sd_info.logical_block_count;
     }
 }
 
-uint8_t* sector_cache_get(uint32_t n_sector) {
-    if(cache != NULL && n_sector != 0) {
-        for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-            if(cache->sectors[sector_i] == n_sector) {
-                return cache->sector_data[sector_i];
+bool sector_cache_read(uint8_t* buff, uint32_t sector, uint32_t count) {
+    if(cache == NULL) return sector_cache_device_read(buff, sector, count);
+
+    if(count > 1) {
+        if(!sector_cache_device_read(buff, sector, count)) return false;
+
+        // Dirty sectors are newer than the card
+        for(size_t i = 0; i < SECTOR_CACHE_SECTORS; ++i) {
+            const SectorCacheSlot* slot = &cache->slots[i];
+            if(slot->valid && slot->dirty && slot->sector >= sector &&
+               slot->sector < sector + count) {
+                memcpy(
+                    &buff[(slot->sector - sector) * SECTOR_SIZE],
+                    cache->sector_data[i],
+                    SECTOR_SIZE);
             }
         }
+        return true;
+    }
+
+    const bool sequential = (cache->last_read != SECTOR_NONE) &&
+                            (sector == cache->last_read + 1);
+    cache->last_read = sector;
+
+    size_t slot = sector_cache_find(sector);
+    if(slot != SECTOR_SLOT_NONE) {
+        cache->stats.hits++;
+        sector_cache_touch(slot);
+        memcpy(buff, cache->sector_data[slot], SECTOR_SIZE);
+        return true;
+    }
+
+    cache->stats.misses++;
+
+    if(sequential && sector + SECTOR_CACHE_BATCH_SECTORS <= cache->sector_count) {
+        uint8_t* batch = (uint8_t*)cache->batch_data;
+        if(!sector_cache_device_read(batch, sector, SECTOR_CACHE_BATCH_SECTORS)) return false;
+
+        memcpy(buff, batch, SECTOR_SIZE);
+
+        for(uint32_t i = 0; i < SECTOR_CACHE_BATCH_SECTORS; ++i) {
+            // Cached sectors may be dirty, keep them as they are
+            if(sector_cache_find(sector + i) != SECTOR_SLOT_NONE) continue;
+
+            slot = sector_cache_allocate(sector + i, false);
+            if(slot == SECTOR_SLOT_NONE) break;
+
+            memcpy(cache->sector_data[slot], cache->batch_data[i], SECTOR_SIZE);
+            if(i > 0) cache->stats.read_ahead++;
+        }
+    } else {
+        if(!sector_cache_device_read(buff, sector, 1)) return false;
+
+        slot = sector_cache_allocate(sector, true);
+        if(slot != SECTOR_SLOT_NONE) {
+            memcpy(cache->sector_data[slot], buff, SECTOR_SIZE);
+        }
     }
-    return NULL;
+
+    return true;
 }
 
-void sector_cache_put(uint32_t n_sector, uint8_t* data) {
-    if(cache == NULL) return;
-    cache->sectors[cache->itr % N_SECTORS] = n_sector;
-    memcpy(cache->sector_data[cache->itr % N_SECTORS], data, SECTOR_SIZE);
-    cache->itr++;
+bool sector_cache_write(const uint8_t* buff, uint32_t sector, uint32_t count) {
+    if(cache == NULL) return sector_cache_device_write(buff, sector, count);
+
+    if(count > 1) {
+        // Written data supersedes cached sectors, dirty ones included
+        for(size_t i = 0; i < SECTOR_CACHE_SECTORS; ++i) {
+            SectorCacheSlot* slot = &cache->slots[i];
+            if(slot->valid && slot->sector >= sector && slot->sector < sector + count) {
+                slot->valid = false;
+                slot->dirty = false;
+            }
+        }
+        return sector_cache_device_write(buff, sector, count);
+    }
+
+    size_t slot = sector_cache_find(sector);
+    if(slot == SECTOR_SLOT_NONE) {
+        slot = sector_cache_allocate(sector, true);
+        // Write back failed, try to write through
+        if(slot == SECTOR_SLOT_NONE) return sector_cache_device_write(buff, sector, 1);
+    }
+
+    memcpy(cache->sector_data[slot], buff, SECTOR_SIZE);
+    cache->slots[slot].dirty = true;
+    sector_cache_touch(slot);
+
+    return true;
 }
 
-void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
-    if(cache == NULL) return;
-    for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-        if((cache->sectors[sector_i] >= start_sector) &&
-           (cache->sectors[sector_i] <= end_sector)) {
-            cache->sectors[sector_i] = 0;
+bool sector_cache_flush(void) {
+    if(cache == NULL) return true;
+
+    // Dirty slots sorted by sector number
+    size_t order[SECTOR_CACHE_SECTORS];
+    size_t dirty_count = 0;
+
+    for(size_t i = 0; i < SECTOR_CACHE_SECTORS; ++i) {
+        if(!cache->slots[i].valid || !cache->slots[i].dirty) continue;
+
+        size_t j = dirty_count++;
+        while(j > 0 && cache->slots[order[j - 1]].sector > cache->slots[i].sector) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    bool result = true;
+
+    for(size_t i = 0; i < dirty_count;) {
+        const uint32_t sector = cache->slots[order[i]].sector;
+
+        size_t run = 1;
+        while(i + run < dirty_count && run < SECTOR_CACHE_BATCH_SECTORS &&
+              cache->slots[order[i + run]].sector == sector + run) {
+            run++;
         }
+
+        const uint8_t* data = (const uint8_t*)cache->sector_data[order[i]];
+        if(run > 1) {
+            for(size_t j = 0; j < run; ++j) {
+                memcpy(cache->batch_data[j], cache->sector_data[order[i + j]], SECTOR_SIZE);
+            }
+            data = (const uint8_t*)cache->batch_data;
+        }
+
+        if(sector_cache_device_write(data, sector, run)) {
+            for(size_t j = 0; j < run; ++j) {
+                cache->slots[order[i + j]].dirty = false;
+            }
+            cache->stats.write_back += run;
+            cache->stats.write_back_transfers++;
+        } else {
+            result = false;
+        }
+
+        i += run;
+    }
+
+    return result;
+}
+
+void sector_cache_get_stats(SectorCacheStats* stats) {
+    furi_check(stats);
+
+    if(cache == NULL) {
+        memset(stats, 0, sizeof(SectorCacheStats));
+    } else {
+        *stats = cache->stats;
     }
 }
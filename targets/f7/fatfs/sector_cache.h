@@ -1,35 +1,69 @@
 #pragma once
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Number of sectors kept in cache */
+#ifndef SECTOR_CACHE_SECTORS
+#define SECTOR_CACHE_SECTORS 16
+#endif
+
+/** Max number of sectors moved by a single read-ahead or write-back transfer */
+#ifndef SECTOR_CACHE_BATCH_SECTORS
+#define SECTOR_CACHE_BATCH_SECTORS 4
+#endif
+
+typedef struct {
+    uint32_t hits; /**< Single sector reads served from cache */
+    uint32_t misses; /**< Single sector reads that went to the card */
+    uint32_t read_ahead; /**< Sectors read ahead of a sequential access */
+    uint32_t write_back; /**< Dirty sectors written to the card */
+    uint32_t write_back_transfers; /**< Card writes used to write dirty sectors */
+} SectorCacheStats;
+
 /**
- * @brief Init sector cache system
+ * @brief Init sector cache system, drops cached data and resets statistics
+ * Must be called every time a card is (re)mounted.
  */
 void sector_cache_init(void);
 
 /**
- * @brief Get sector data from cache
- * @param n_sector Sector number
- * @return Pointer to sector data or NULL if not found
+ * @brief Read sectors through the cache
+ * Single sector reads are cached, sequential ones trigger read-ahead.
+ * Multi sector reads go straight to the card.
+ * @param buff Data buffer
+ * @param sector Start sector number
+ * @param count Number of sectors
+ * @return true on success
+ */
+bool sector_cache_read(uint8_t* buff, uint32_t sector, uint32_t count);
+
+/**
+ * @brief Write sectors through the cache
+ * Single sector writes are kept in cache until flushed or evicted.
+ * Multi sector writes go straight to the card.
+ * @param buff Data buffer
+ * @param sector Start sector number
+ * @param count Number of sectors
+ * @return true on success
  */
-uint8_t* sector_cache_get(uint32_t n_sector);
+bool sector_cache_write(const uint8_t* buff, uint32_t sector, uint32_t count);
 
 /**
- * @brief Put sector data to cache
- * @param n_sector Sector number
- * @param data Pointer to sector data
+ * @brief Write all dirty sectors to the card
+ * Consecutive sectors are written with a single transfer.
+ * @return true on success
  */
-void sector_cache_put(uint32_t n_sector, uint8_t* data);
+bool sector_cache_flush(void);
 
 /**
- * @brief Invalidate sector cache for given range
- * @param start_sector Start sector number
- * @param end_sector End sector number
+ * @brief Get cache statistics
+ * @param stats Pointer to statistics to fill
  */
-void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector);
+void sector_cache_get_stats(SectorCacheStats* stats);
 
 #ifdef __cplusplus
 }
@@ -52,8 +52,8 @@ static DSTATUS driver_status(BYTE pdrv) {
   */
 static DRESULT driver_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
     UNUSED(pdrv);
-    FuriStatus status = furi_hal_sd_read_blocks((uint32_t*)buff, (uint32_t)(sector), count);
-    return status == FuriStatusOk ? RES_OK : RES_ERROR;
+    bool result = sector_cache_read(buff, (uint32_t)(sector), count);
+    return result ? RES_OK : RES_ERROR;
 }
 
 /**
@@ -66,8 +66,8 @@ static DRESULT driver_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
   */
 static DRESULT driver_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) {
     UNUSED(pdrv);
-    FuriStatus status = furi_hal_sd_write_blocks((uint32_t*)buff, (uint32_t)(sector), count);
-    return status == FuriStatusOk ? RES_OK : RES_ERROR;
+    bool result = sector_cache_write(buff, (uint32_t)(sector), count);
+    return result ? RES_OK : RES_ERROR;
 }
 
 /**
@@ -87,7 +87,7 @@ static DRESULT driver_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
     switch(cmd) {
     /* Make sure that no pending write process */
     case CTRL_SYNC:
-        res = RES_OK;
+        res = sector_cache_flush() ? RES_OK : RES_ERROR;
         break;
 
     /* Get number of sectors on the disk (DWORD) */
@@ -2,7 +2,6 @@
 #include <stm32wbxx_ll_gpio.h>
 #include <furi.h>
 #include <furi_hal.h>
-#include "../fatfs/sector_cache.h"
 #define TAG "SdSpi"
 
 #ifdef FURI_HAL_SD_SPI_DEBUG
@@ -67,6 +66,7 @@ typedef enum {
     SD_CMD17_READ_SINGLE_BLOCK = 17,
     SD_CMD18_READ_MULT_BLOCK = 18,
     SD_CMD23_SET_BLOCK_COUNT = 23,
+    SD_ACMD23_SET_WR_BLK_ERASE_COUNT = 23,
     SD_CMD24_WRITE_SINGLE_BLOCK = 24,
     SD_CMD25_WRITE_MULT_BLOCK = 25,
     SD_CMD27_PROG_CSD = 27,
@@ -685,17 +685,38 @@ static FuriStatus sd_spi_get_cid(SD_CID* Cid) {
     return ret;
 }
 
-static FuriStatus
-    sd_spi_cmd_read_blocks(uint32_t* data, uint32_t address, uint32_t blocks, uint32_t timeout_ms) {
-    uint32_t block_address = address;
-    uint32_t offset = 0;
+static FuriStatus sd_spi_stop_transmission(uint32_t timeout_ms) {
+    uint8_t frame[SD_CMD_LENGTH] = {SD_CMD12_STOP_TRANSMISSION | 0x40, 0, 0, 0, 0, 0xFF};
+
+    // CMD12 (STOP_TRANSMISSION): stuff byte, then R1b response
+    sd_spi_write_bytes(frame, sizeof(frame));
+    sd_spi_read_byte();
+    uint8_t r1 = sd_spi_wait_for_data_and_read();
 
+    // Card holds the line low while busy
+    FuriStatus status = sd_spi_wait_for_data(SD_DUMMY_BYTE, timeout_ms);
+    if(r1 != SdSpi_R1_NO_ERROR) {
+        status = FuriStatusError;
+    }
+
+    return status;
+}
+
+static FuriStatus sd_spi_set_block_length(void) {
     // CMD16 (SET_BLOCKLEN): R1 response (0x00: no errors)
     SdSpiCmdAnswer response =
         sd_spi_send_cmd(SD_CMD16_SET_BLOCKLEN, SD_BLOCK_SIZE, 0xFF, SdSpiCmdAnswerTypeR1);
     sd_spi_deselect_card_and_purge();
 
-    if(response.r1 != SdSpi_R1_NO_ERROR) {
+    return response.r1 == SdSpi_R1_NO_ERROR ? FuriStatusOk : FuriStatusError;
+}
+
+static FuriStatus
+    sd_spi_cmd_read_blocks(uint32_t* data, uint32_t address, uint32_t blocks, uint32_t timeout_ms) {
+    uint32_t block_address = address;
+    uint32_t offset = 0;
+
+    if(sd_spi_set_block_length() != FuriStatusOk) {
         return FuriStatusError;
     }
 
@@ -703,40 +724,43 @@ static FuriStatus
         block_address = address * SD_BLOCK_SIZE;
     }
 
-    while(blocks--) {
-        // CMD17 (READ_SINGLE_BLOCK): R1 response (0x00: no errors)
-        response =
-            sd_spi_send_cmd(SD_CMD17_READ_SINGLE_BLOCK, block_address, 0xFF, SdSpiCmdAnswerTypeR1);
-        if(response.r1 != SdSpi_R1_NO_ERROR) {
-            sd_spi_deselect_card_and_purge();
-            return FuriStatusError;
-        }
+    const bool multiple_blocks = blocks > 1;
 
-        // Wait for the data start token
-        if(sd_spi_wait_for_data(SD_TOKEN_START_DATA_SINGLE_BLOCK_READ, timeout_ms) ==
+    // CMD17 (READ_SINGLE_BLOCK) or CMD18 (READ_MULT_BLOCK): R1 response (0x00: no errors)
+    SdSpiCmdAnswer response = sd_spi_send_cmd(
+        multiple_blocks ? SD_CMD18_READ_MULT_BLOCK : SD_CMD17_READ_SINGLE_BLOCK,
+        block_address,
+        0xFF,
+        SdSpiCmdAnswerTypeR1);
+    if(response.r1 != SdSpi_R1_NO_ERROR) {
+        sd_spi_deselect_card_and_purge();
+        return FuriStatusError;
+    }
+
+    FuriStatus status = FuriStatusOk;
+    while(blocks--) {
+        // Wait for the data start token, every block has its own
+        if(sd_spi_wait_for_data(SD_TOKEN_START_DATA_MULTIPLE_BLOCK_READ, timeout_ms) !=
            FuriStatusOk) {
-            // Read the data block
-            sd_spi_read_bytes_dma((uint8_t*)data + offset, SD_BLOCK_SIZE);
-            sd_spi_purge_crc();
+            status = FuriStatusError;
+            break;
+        }
 
-            // increase offset
-            offset += SD_BLOCK_SIZE;
+        // Read the data block
+        sd_spi_read_bytes_dma((uint8_t*)data + offset, SD_BLOCK_SIZE);
+        sd_spi_purge_crc();
 
-            // increase block address
-            if(sd_high_capacity) {
-                block_address += 1;
-            } else {
-                block_address += SD_BLOCK_SIZE;
-            }
-        } else {
-            sd_spi_deselect_card_and_purge();
-            return FuriStatusError;
-        }
+        // increase offset
+        offset += SD_BLOCK_SIZE;
+    }
 
-        sd_spi_deselect_card_and_purge();
+    if(multiple_blocks && sd_spi_stop_transmission(timeout_ms) != FuriStatusOk) {
+        status = FuriStatusError;
     }
 
-    return FuriStatusOk;
+    sd_spi_deselect_card_and_purge();
+
+    return status;
 }
 
 static FuriStatus sd_spi_cmd_write_blocks(
@@ -747,12 +771,7 @@ static FuriStatus sd_spi_cmd_write_blocks(
     uint32_t block_address = address;
     uint32_t offset = 0;
 
-    // CMD16 (SET_BLOCKLEN): R1 response (0x00: no errors)
-    SdSpiCmdAnswer response =
-        sd_spi_send_cmd(SD_CMD16_SET_BLOCKLEN, SD_BLOCK_SIZE, 0xFF, SdSpiCmdAnswerTypeR1);
-    sd_spi_deselect_card_and_purge();
-
-    if(response.r1 != SdSpi_R1_NO_ERROR) {
+    if(sd_spi_set_block_length() != FuriStatusOk) {
         return FuriStatusError;
     }
 
@@ -760,45 +779,68 @@ static FuriStatus sd_spi_cmd_write_blocks(
         block_address = address * SD_BLOCK_SIZE;
     }
 
-    while(blocks--) {
-        // CMD24 (WRITE_SINGLE_BLOCK): R1 response (0x00: no errors)
-        response = sd_spi_send_cmd(
-            SD_CMD24_WRITE_SINGLE_BLOCK, block_address, 0xFF, SdSpiCmdAnswerTypeR1);
-        if(response.r1 != SdSpi_R1_NO_ERROR) {
-            sd_spi_deselect_card_and_purge();
-            return FuriStatusError;
-        }
+    const bool multiple_blocks = blocks > 1;
 
-        // Send dummy byte for NWR timing : one byte between CMD_WRITE and TOKEN
-        // TODO FL-3509: check bytes count
-        sd_spi_write_byte(SD_DUMMY_BYTE);
+    if(multiple_blocks) {
+        // ACMD23 (SET_WR_BLK_ERASE_COUNT): pre-erase hint, failure is not fatal
+        sd_spi_send_cmd(SD_CMD55_APP_CMD, 0, 0xFF, SdSpiCmdAnswerTypeR1);
+        sd_spi_deselect_card_and_purge();
+        sd_spi_send_cmd(SD_ACMD23_SET_WR_BLK_ERASE_COUNT, blocks, 0xFF, SdSpiCmdAnswerTypeR1);
+        sd_spi_deselect_card_and_purge();
+    }
+
+    // CMD24 (WRITE_SINGLE_BLOCK) or CMD25 (WRITE_MULT_BLOCK): R1 response (0x00: no errors)
+    SdSpiCmdAnswer response = sd_spi_send_cmd(
+        multiple_blocks ? SD_CMD25_WRITE_MULT_BLOCK : SD_CMD24_WRITE_SINGLE_BLOCK,
+        block_address,
+        0xFF,
+        SdSpiCmdAnswerTypeR1);
+    if(response.r1 != SdSpi_R1_NO_ERROR) {
+        sd_spi_deselect_card_and_purge();
+        return FuriStatusError;
+    }
+
+    // Send dummy byte for NWR timing : one byte between CMD_WRITE and TOKEN
+    // TODO FL-3509: check bytes count
+    sd_spi_write_byte(SD_DUMMY_BYTE);
+
+    FuriStatus status = FuriStatusOk;
+    while(blocks--) {
         sd_spi_write_byte(SD_DUMMY_BYTE);
 
         // Send the data start token
-        sd_spi_write_byte(SD_TOKEN_START_DATA_SINGLE_BLOCK_WRITE);
+        sd_spi_write_byte(
+            multiple_blocks ? SD_TOKEN_START_DATA_MULTIPLE_BLOCK_WRITE :
+                              SD_TOKEN_START_DATA_SINGLE_BLOCK_WRITE);
         sd_spi_write_bytes_dma((uint8_t*)data + offset, SD_BLOCK_SIZE);
         sd_spi_purge_crc();
 
-        // Read data response
-        SdSpiDataResponce data_responce = sd_spi_get_data_response(timeout_ms);
-        sd_spi_deselect_card_and_purge();
-
-        if(data_responce != SdSpiDataResponceOK) {
-            return FuriStatusError;
+        // Read data response, waits while the card is busy programming the block
+        if(sd_spi_get_data_response(timeout_ms) != SdSpiDataResponceOK) {
+            status = FuriStatusError;
+            break;
         }
 
         // increase offset
         offset += SD_BLOCK_SIZE;
+    }
 
-        // increase block address
-        if(sd_high_capacity) {
-            block_address += 1;
+    if(multiple_blocks) {
+        if(status == FuriStatusOk) {
+            // Stop token, then the card is busy until the last block is written
+            sd_spi_write_byte(SD_TOKEN_STOP_DATA_MULTIPLE_BLOCK_WRITE);
+            sd_spi_read_byte();
+            if(sd_spi_wait_for_data(SD_DUMMY_BYTE, timeout_ms) != FuriStatusOk) {
+                status = FuriStatusError;
+            }
         } else {
-            block_address += SD_BLOCK_SIZE;
+            sd_spi_stop_transmission(timeout_ms);
         }
     }
 
-    return FuriStatusOk;
+    sd_spi_deselect_card_and_purge();
+
+    return status;
 }
 
 static FuriStatus sd_spi_get_card_state(void) {
@@ -816,27 +858,6 @@ static FuriStatus sd_spi_get_card_state(void) {
     return FuriStatusError;
 }
 
-static inline bool sd_cache_get(uint32_t address, uint32_t* data) {
-    uint8_t* cached_data = sector_cache_get(address);
-    if(cached_data) {
-        memcpy(data, cached_data, SD_BLOCK_SIZE);
-        return true;
-    }
-    return false;
-}
-
-static inline void sd_cache_put(uint32_t address, uint32_t* data) {
-    sector_cache_put(address, (uint8_t*)data);
-}
-
-static inline void sd_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
-    sector_cache_invalidate_range(start_sector, end_sector);
-}
-
-static inline void sd_cache_invalidate_all(void) {
-    sector_cache_init();
-}
-
 static FuriStatus sd_device_read(uint32_t* buff, uint32_t sector, uint32_t count) {
     FuriStatus status = FuriStatusError;
 
@@ -877,8 +898,6 @@ static FuriStatus sd_device_write(const uint32_t* buff, uint32_t sector, uint32_
             status = sd_spi_get_card_state();
 
             if(furi_hal_cortex_timer_is_expired(timer)) {
-                sd_cache_invalidate_all();
-
                 status = FuriStatusErrorTimeout;
                 break;
             }
@@ -953,9 +972,6 @@ FuriStatus furi_hal_sd_init(bool power_reset) {
     furi_hal_sd_spi_handle = NULL;
     furi_hal_spi_release(&furi_hal_spi_bus_handle_sd_slow);
 
-    // Init sector cache
-    sector_cache_init();
-
     return status;
 }
 
@@ -975,13 +991,6 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
     furi_check(buff);
 
     FuriStatus status;
-    bool single_sector = count == 1;
-
-    if(single_sector) {
-        if(sd_cache_get(sector, buff)) {
-            return FuriStatusOk;
-        }
-    }
 
     status = sd_device_read(buff, sector, count);
 
@@ -1003,10 +1012,6 @@ FuriStatus furi_hal_sd_read_blocks(uint32_t* buff, uint32_t sector, uint32_t cou
         }
     }
 
-    if(single_sector && status == FuriStatusOk) {
-        sd_cache_put(sector, buff);
-    }
-
     return status;
 }
 
@@ -1015,8 +1020,6 @@ FuriStatus furi_hal_sd_write_blocks(const uint32_t* buff, uint32_t sector, uint3
 
     FuriStatus status;
 
-    sd_cache_invalidate_range(sector, sector + count);
-
     status = sd_device_write(buff, sector, count);
 
     if(status != FuriStatusOk) {
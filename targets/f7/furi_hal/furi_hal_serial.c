@@ -2,6 +2,7 @@
 #include "furi_hal_serial_types_i.h"
 
 #include <stdbool.h>
+#include <string.h>
 #include <stm32wbxx_ll_lpuart.h>
 #include <stm32wbxx_ll_usart.h>
 #include <stm32wbxx_ll_rcc.h>
@@ -20,6 +21,10 @@
 #define FURI_HAL_SERIAL_LPUART_DMA_INSTANCE (DMA1)
 #define FURI_HAL_SERIAL_LPUART_DMA_CHANNEL  (LL_DMA_CHANNEL_7)
 
+// TX channel of USART. No DMA channel is left for LPUART, its queue is sent from the interrupt
+#define FURI_HAL_SERIAL_USART_DMA_TX_INSTANCE (DMA1)
+#define FURI_HAL_SERIAL_USART_DMA_TX_CHANNEL  (LL_DMA_CHANNEL_3)
+
 typedef struct {
     uint8_t* buffer_rx_ptr;
     size_t buffer_rx_index_write;
@@ -29,16 +34,34 @@ typedef struct {
     FuriHalSerialAsyncRxCallback rx_byte_callback;
     FuriHalSerialDmaRxCallback rx_dma_callback;
     void* context;
+    uint8_t* buffer_tx_ptr;
+    size_t buffer_tx_size[2];
+    size_t buffer_tx_index;
+    size_t buffer_tx_sent;
+    volatile bool tx_dma_busy;
+    bool irq_rx;
+    bool irq_installed;
+    FuriHalSerialHandle* tx_handle;
+    FuriHalSerialAsyncTxCallback tx_callback;
+    void* tx_context;
 } FuriHalSerial;
 
 typedef void (*FuriHalSerialControlFunc)(USART_TypeDef*);
 
+typedef struct {
+    DMA_TypeDef* instance;
+    uint32_t channel;
+    uint32_t request;
+    FuriHalInterruptId irq;
+} FuriHalSerialDmaConfig;
+
 typedef struct {
     USART_TypeDef* periph;
     GpioAltFn alt_fn;
     const GpioPin* gpio[FuriHalSerialDirectionMax];
     FuriHalSerialControlFunc enable[FuriHalSerialDirectionMax];
     FuriHalSerialControlFunc disable[FuriHalSerialDirectionMax];
+    FuriHalSerialDmaConfig dma_tx;
 } FuriHalSerialConfig;
 
 static const FuriHalSerialConfig furi_hal_serial_config[FuriHalSerialIdMax] = {
@@ -61,6 +84,13 @@ static const FuriHalSerialConfig furi_hal_serial_config[FuriHalSerialIdMax] = {
                     [FuriHalSerialDirectionTx] = LL_USART_DisableDirectionTx,
                     [FuriHalSerialDirectionRx] = LL_USART_DisableDirectionRx,
                 },
+            .dma_tx =
+                {
+                    .instance = FURI_HAL_SERIAL_USART_DMA_TX_INSTANCE,
+                    .channel = FURI_HAL_SERIAL_USART_DMA_TX_CHANNEL,
+                    .request = LL_DMAMUX_REQ_USART1_TX,
+                    .irq = FuriHalInterruptIdDma1Ch3,
+                },
         },
     [FuriHalSerialIdLpuart] =
         {
@@ -93,6 +123,10 @@ static void furi_hal_serial_async_rx_configure(
     FuriHalSerialAsyncRxCallback callback,
     void* context);
 
+static void furi_hal_serial_dma_tx_flush(FuriHalSerialHandle* handle);
+
+static void furi_hal_serial_dma_tx_poll(FuriHalSerial* serial);
+
 static void furi_hal_serial_usart_irq_callback(void* context) {
     UNUSED(context);
 
@@ -297,6 +331,11 @@ static void furi_hal_serial_usart_init(FuriHalSerialHandle* handle, uint32_t bau
 static void furi_hal_serial_lpuart_irq_callback(void* context) {
     UNUSED(context);
 
+    if(furi_hal_serial[FuriHalSerialIdLpuart].buffer_tx_ptr) {
+        furi_hal_serial_dma_tx_poll(&furi_hal_serial[FuriHalSerialIdLpuart]);
+    }
+    if(!furi_hal_serial[FuriHalSerialIdLpuart].irq_rx) return;
+
     FuriHalSerialRxEvent event = 0;
     // Notification flags
     if(LPUART1->ISR & USART_ISR_RXNE_RXFNE) {
@@ -323,6 +362,8 @@ static void furi_hal_serial_lpuart_irq_callback(void* context) {
         LPUART1->ICR = USART_ICR_PECF;
         event |= FuriHalSerialRxEventFrameError;
     }
+    // Interrupt is shared with transmission, nothing to report
+    if(!event) return;
 
     if(furi_hal_serial[FuriHalSerialIdLpuart].buffer_rx_ptr == NULL) {
         if(furi_hal_serial[FuriHalSerialIdLpuart].rx_byte_callback) {
@@ -342,6 +383,21 @@ static void furi_hal_serial_lpuart_irq_callback(void* context) {
     }
 }
 
+/* LPUART interrupt serves both async RX and TX, it is installed while any of them needs it */
+static void furi_hal_serial_lpuart_irq_update(void) {
+    FuriHalSerial* serial = &furi_hal_serial[FuriHalSerialIdLpuart];
+    const bool needed = serial->irq_rx || serial->buffer_tx_ptr;
+
+    if(needed && !serial->irq_installed) {
+        furi_hal_interrupt_set_isr(
+            FuriHalInterruptIdLpUart1, furi_hal_serial_lpuart_irq_callback, NULL);
+    } else if(!needed && serial->irq_installed) {
+        furi_hal_interrupt_set_isr(FuriHalInterruptIdLpUart1, NULL, NULL);
+    }
+
+    serial->irq_installed = needed;
+}
+
 static void furi_hal_serial_lpuart_dma_rx_isr(void* context) {
     UNUSED(context);
 #if FURI_HAL_SERIAL_LPUART_DMA_CHANNEL == LL_DMA_CHANNEL_7
@@ -579,6 +635,7 @@ static uint32_t furi_hal_serial_get_prescaler(FuriHalSerialHandle* handle, uint3
 void furi_hal_serial_set_br(FuriHalSerialHandle* handle, uint32_t baud) {
     furi_check(handle);
     uint32_t prescaler = furi_hal_serial_get_prescaler(handle, baud);
+    furi_hal_serial_dma_tx_flush(handle);
     if(handle->id == FuriHalSerialIdUsart) {
         if(LL_USART_IsEnabled(USART1)) {
             // Wait for transfer complete flag
@@ -608,6 +665,9 @@ void furi_hal_serial_set_br(FuriHalSerialHandle* handle, uint32_t baud) {
 void furi_hal_serial_deinit(FuriHalSerialHandle* handle) {
     furi_check(handle);
     furi_hal_serial_async_rx_configure(handle, NULL, NULL);
+    if(furi_hal_serial[handle->id].buffer_tx_ptr) {
+        furi_hal_serial_dma_tx_stop(handle);
+    }
     if(handle->id == FuriHalSerialIdUsart) {
         if(furi_hal_bus_is_enabled(FuriHalBusUSART1)) {
             furi_hal_bus_disable(FuriHalBusUSART1);
@@ -659,6 +719,16 @@ void furi_hal_serial_resume(FuriHalSerialHandle* handle) {
 void furi_hal_serial_tx(FuriHalSerialHandle* handle, const uint8_t* buffer, size_t buffer_size) {
     furi_check(handle);
 
+    if(furi_hal_serial[handle->id].buffer_tx_ptr) {
+        // Keep the order with data queued earlier
+        while(buffer_size > 0) {
+            const size_t sent = furi_hal_serial_tx_async(handle, buffer, buffer_size);
+            buffer += sent;
+            buffer_size -= sent;
+        }
+        return;
+    }
+
     if(handle->id == FuriHalSerialIdUsart) {
         if(LL_USART_IsEnabled(USART1) == 0) return;
 
@@ -688,6 +758,7 @@ void furi_hal_serial_tx(FuriHalSerialHandle* handle, const uint8_t* buffer, size
 
 void furi_hal_serial_tx_wait_complete(FuriHalSerialHandle* handle) {
     furi_check(handle);
+    furi_hal_serial_dma_tx_flush(handle);
     if(handle->id == FuriHalSerialIdUsart) {
         if(LL_USART_IsEnabled(USART1) == 0) return;
 
@@ -701,6 +772,219 @@ void furi_hal_serial_tx_wait_complete(FuriHalSerialHandle* handle) {
     }
 }
 
+#define FURI_HAL_SERIAL_DMA_FLAG(flag, channel) ((flag) << ((channel) * 4U))
+
+/* Start the queued buffer if transmission is idle. Must be called with TX interrupts masked */
+static void furi_hal_serial_dma_tx_kick(FuriHalSerialId id) {
+    FuriHalSerial* serial = &furi_hal_serial[id];
+    const FuriHalSerialDmaConfig* dma = &furi_hal_serial_config[id].dma_tx;
+    const size_t index = serial->buffer_tx_index;
+
+    if(serial->tx_dma_busy || serial->buffer_tx_size[index] == 0) return;
+
+    if(dma->instance) {
+        LL_DMA_DisableChannel(dma->instance, dma->channel);
+        LL_DMA_SetMemoryAddress(
+            dma->instance,
+            dma->channel,
+            (uint32_t)&serial->buffer_tx_ptr[index * FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE]);
+        LL_DMA_SetDataLength(dma->instance, dma->channel, serial->buffer_tx_size[index]);
+    }
+
+    serial->tx_dma_busy = true;
+    serial->buffer_tx_index = index ^ 1;
+    serial->buffer_tx_size[index ^ 1] = 0;
+
+    if(dma->instance) {
+        LL_DMA_EnableChannel(dma->instance, dma->channel);
+    } else {
+        serial->buffer_tx_sent = 0;
+        LL_USART_EnableIT_TXE_TXFNF(furi_hal_serial_config[id].periph);
+    }
+}
+
+/* Feed TX FIFO from the buffer in flight, returns true once all of it is in the FIFO */
+static bool furi_hal_serial_irq_tx_fill(FuriHalSerialId id) {
+    FuriHalSerial* serial = &furi_hal_serial[id];
+    USART_TypeDef* periph = furi_hal_serial_config[id].periph;
+    const size_t index = serial->buffer_tx_index ^ 1;
+    const uint8_t* buffer = &serial->buffer_tx_ptr[index * FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE];
+
+    while(serial->buffer_tx_sent < serial->buffer_tx_size[index] &&
+          LL_USART_IsActiveFlag_TXE_TXFNF(periph)) {
+        LL_USART_TransmitData8(periph, buffer[serial->buffer_tx_sent++]);
+    }
+
+    if(serial->buffer_tx_sent < serial->buffer_tx_size[index]) return false;
+
+    LL_USART_DisableIT_TXE_TXFNF(periph);
+    return true;
+}
+
+/* Release finished buffer and start the next one, returns true if buffer was released */
+static bool furi_hal_serial_dma_tx_complete(FuriHalSerialId id) {
+    const FuriHalSerialDmaConfig* dma = &furi_hal_serial_config[id].dma_tx;
+
+    if(!furi_hal_serial[id].tx_dma_busy) return false;
+
+    if(dma->instance) {
+        if(!(dma->instance->ISR & FURI_HAL_SERIAL_DMA_FLAG(DMA_ISR_TCIF1, dma->channel))) {
+            return false;
+        }
+        dma->instance->IFCR = FURI_HAL_SERIAL_DMA_FLAG(DMA_IFCR_CTCIF1, dma->channel);
+    } else if(!furi_hal_serial_irq_tx_fill(id)) {
+        return false;
+    }
+
+    furi_hal_serial[id].tx_dma_busy = false;
+    furi_hal_serial_dma_tx_kick(id);
+
+    return true;
+}
+
+static void furi_hal_serial_dma_tx_poll(FuriHalSerial* serial) {
+    FURI_CRITICAL_ENTER();
+    const bool released = furi_hal_serial_dma_tx_complete(serial->tx_handle->id);
+    FURI_CRITICAL_EXIT();
+
+    if(released && serial->tx_callback) {
+        serial->tx_callback(serial->tx_handle, serial->tx_context);
+    }
+}
+
+static void furi_hal_serial_dma_tx_isr(void* context) {
+    furi_hal_serial_dma_tx_poll(context);
+}
+
+static void furi_hal_serial_dma_tx_flush(FuriHalSerialHandle* handle) {
+    FuriHalSerial* serial = &furi_hal_serial[handle->id];
+    if(serial->buffer_tx_ptr == NULL) return;
+
+    USART_TypeDef* periph = furi_hal_serial_config[handle->id].periph;
+    if(LL_USART_IsEnabled(periph)) {
+        while(serial->tx_dma_busy) {
+            // TX interrupt can't preempt us in interrupt or with interrupts masked
+            if(FURI_IS_ISR()) furi_hal_serial_dma_tx_poll(serial);
+        }
+    } else {
+        // Nothing moves while transceiver is disabled, drop queued data
+        const FuriHalSerialDmaConfig* dma = &furi_hal_serial_config[handle->id].dma_tx;
+        FURI_CRITICAL_ENTER();
+        if(dma->instance) {
+            LL_DMA_DisableChannel(dma->instance, dma->channel);
+            dma->instance->IFCR = FURI_HAL_SERIAL_DMA_FLAG(DMA_IFCR_CGIF1, dma->channel);
+        } else {
+            LL_USART_DisableIT_TXE_TXFNF(periph);
+        }
+        serial->tx_dma_busy = false;
+        serial->buffer_tx_size[0] = 0;
+        serial->buffer_tx_size[1] = 0;
+        FURI_CRITICAL_EXIT();
+    }
+}
+
+void furi_hal_serial_dma_tx_start(
+    FuriHalSerialHandle* handle,
+    FuriHalSerialAsyncTxCallback callback,
+    void* context) {
+    furi_check(handle);
+    furi_check(handle->id < FuriHalSerialIdMax);
+
+    FuriHalSerial* serial = &furi_hal_serial[handle->id];
+    USART_TypeDef* periph = furi_hal_serial_config[handle->id].periph;
+    const FuriHalSerialDmaConfig* dma = &furi_hal_serial_config[handle->id].dma_tx;
+
+    furi_check(serial->buffer_tx_ptr == NULL);
+    serial->buffer_tx_ptr = malloc(FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE * 2);
+    serial->buffer_tx_size[0] = 0;
+    serial->buffer_tx_size[1] = 0;
+    serial->buffer_tx_index = 0;
+    serial->tx_dma_busy = false;
+    serial->tx_handle = handle;
+    serial->tx_callback = callback;
+    serial->tx_context = context;
+
+    if(!dma->instance) {
+        furi_hal_serial_lpuart_irq_update();
+        return;
+    }
+
+    LL_DMA_SetPeriphAddress(dma->instance, dma->channel, (uint32_t) & (periph->TDR));
+    LL_DMA_ConfigTransfer(
+        dma->instance,
+        dma->channel,
+        LL_DMA_DIRECTION_MEMORY_TO_PERIPH | LL_DMA_MODE_NORMAL | LL_DMA_PERIPH_NOINCREMENT |
+            LL_DMA_MEMORY_INCREMENT | LL_DMA_PDATAALIGN_BYTE | LL_DMA_MDATAALIGN_BYTE |
+            LL_DMA_PRIORITY_LOW);
+    LL_DMA_SetPeriphRequest(dma->instance, dma->channel, dma->request);
+    dma->instance->IFCR = FURI_HAL_SERIAL_DMA_FLAG(DMA_IFCR_CGIF1, dma->channel);
+
+    furi_hal_interrupt_set_isr(dma->irq, furi_hal_serial_dma_tx_isr, serial);
+    LL_DMA_EnableIT_TC(dma->instance, dma->channel);
+    LL_USART_EnableDMAReq_TX(periph);
+}
+
+void furi_hal_serial_dma_tx_stop(FuriHalSerialHandle* handle) {
+    furi_check(handle);
+    furi_check(handle->id < FuriHalSerialIdMax);
+
+    FuriHalSerial* serial = &furi_hal_serial[handle->id];
+    USART_TypeDef* periph = furi_hal_serial_config[handle->id].periph;
+    const FuriHalSerialDmaConfig* dma = &furi_hal_serial_config[handle->id].dma_tx;
+
+    furi_check(serial->buffer_tx_ptr);
+    furi_hal_serial_dma_tx_flush(handle);
+
+    if(dma->instance) {
+        LL_USART_DisableDMAReq_TX(periph);
+        LL_DMA_DisableIT_TC(dma->instance, dma->channel);
+        LL_DMA_DisableChannel(dma->instance, dma->channel);
+        dma->instance->IFCR = FURI_HAL_SERIAL_DMA_FLAG(DMA_IFCR_CGIF1, dma->channel);
+        LL_DMA_DeInit(dma->instance, dma->channel);
+        furi_hal_interrupt_set_isr(dma->irq, NULL, NULL);
+    }
+
+    FURI_CRITICAL_ENTER();
+    free(serial->buffer_tx_ptr);
+    serial->buffer_tx_ptr = NULL;
+    serial->tx_callback = NULL;
+    serial->tx_context = NULL;
+    FURI_CRITICAL_EXIT();
+
+    if(!dma->instance) {
+        furi_hal_serial_lpuart_irq_update();
+    }
+}
+
+size_t furi_hal_serial_tx_async(
+    FuriHalSerialHandle* handle,
+    const uint8_t* buffer,
+    size_t buffer_size) {
+    furi_check(handle);
+    furi_check(handle->id < FuriHalSerialIdMax);
+    furi_check(buffer);
+
+    FuriHalSerial* serial = &furi_hal_serial[handle->id];
+    furi_check(serial->buffer_tx_ptr);
+
+    // Same as blocking transmission: data is discarded while transceiver is disabled
+    if(!LL_USART_IsEnabled(furi_hal_serial_config[handle->id].periph)) return buffer_size;
+
+    if(FURI_IS_ISR()) furi_hal_serial_dma_tx_poll(serial);
+
+    FURI_CRITICAL_ENTER();
+    const size_t index = serial->buffer_tx_index;
+    const size_t queued = serial->buffer_tx_size[index];
+    const size_t size = MIN(buffer_size, FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE - queued);
+    uint8_t* tx_buffer = &serial->buffer_tx_ptr[index * FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE];
+    memcpy(&tx_buffer[queued], buffer, size);
+    serial->buffer_tx_size[index] = queued + size;
+    furi_hal_serial_dma_tx_kick(handle->id);
+    FURI_CRITICAL_EXIT();
+
+    return size;
+}
+
 static void furi_hal_serial_event_init(FuriHalSerialHandle* handle, bool report_errors) {
     if(handle->id == FuriHalSerialIdUsart) {
         LL_USART_EnableIT_IDLE(USART1);
@@ -752,11 +1036,12 @@ static void furi_hal_serial_async_rx_configure(
     } else if(handle->id == FuriHalSerialIdLpuart) {
         if(callback) {
             furi_hal_serial_lpuart_deinit_dma_rx();
-            furi_hal_interrupt_set_isr(
-                FuriHalInterruptIdLpUart1, furi_hal_serial_lpuart_irq_callback, NULL);
+            furi_hal_serial[FuriHalSerialIdLpuart].irq_rx = true;
+            furi_hal_serial_lpuart_irq_update();
             LL_LPUART_EnableIT_RXNE_RXFNE(LPUART1);
         } else {
-            furi_hal_interrupt_set_isr(FuriHalInterruptIdLpUart1, NULL, NULL);
+            furi_hal_serial[FuriHalSerialIdLpuart].irq_rx = false;
+            furi_hal_serial_lpuart_irq_update();
             furi_hal_serial_lpuart_deinit_dma_rx();
             LL_LPUART_DisableIT_RXNE_RXFNE(LPUART1);
         }
@@ -873,11 +1158,12 @@ static void furi_hal_serial_dma_configure(
     } else if(handle->id == FuriHalSerialIdLpuart) {
         if(callback) {
             furi_hal_serial_lpuart_init_dma_rx();
-            furi_hal_interrupt_set_isr(
-                FuriHalInterruptIdLpUart1, furi_hal_serial_lpuart_irq_callback, NULL);
+            furi_hal_serial[FuriHalSerialIdLpuart].irq_rx = true;
+            furi_hal_serial_lpuart_irq_update();
         } else {
             LL_LPUART_DisableIT_RXNE_RXFNE(LPUART1);
-            furi_hal_interrupt_set_isr(FuriHalInterruptIdLpUart1, NULL, NULL);
+            furi_hal_serial[FuriHalSerialIdLpuart].irq_rx = false;
+            furi_hal_serial_lpuart_irq_update();
             furi_hal_serial_lpuart_deinit_dma_rx();
         }
     }
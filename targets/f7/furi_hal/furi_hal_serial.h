@@ -80,7 +80,8 @@ void furi_hal_serial_tx(FuriHalSerialHandle* handle, const uint8_t* buffer, size
 
 /** Wait until transmission is completed
  *
- * Ensures that all data has been sent.
+ * Ensures that all data has been sent, including data queued for DMA
+ * transmission.
  *
  * @param      handle  Serial handle
  */
@@ -239,6 +240,65 @@ void furi_hal_serial_dma_rx_stop(FuriHalSerialHandle* handle);
  */
 size_t furi_hal_serial_dma_rx(FuriHalSerialHandle* handle, uint8_t* data, size_t len);
 
+/** Transmit DMA buffer size, up to two buffers can be queued */
+#define FURI_HAL_SERIAL_DMA_TX_BUFFER_SIZE (256u)
+
+/** Transmit DMA callback
+ *
+ * Called every time a queued buffer has been handed over to the transceiver,
+ * so there is free space for `furi_hal_serial_tx_async`.
+ *
+ * @warning    Callback will be called in interrupt context or from
+ *             `furi_hal_serial_tx_async` called in interrupt context, ensure
+ *             thread safety on your side.
+ *
+ * @param      handle   Serial handle
+ * @param      context  Callback context provided earlier
+ */
+typedef void (*FuriHalSerialAsyncTxCallback)(FuriHalSerialHandle* handle, void* context);
+
+/** Start DMA transmission
+ *
+ * Allocates two transmit buffers and takes over the TX DMA channel. While
+ * started, `furi_hal_serial_tx` goes through the same queue.
+ *
+ * @note       LPUART has no free DMA channel, its queue is fed to the
+ *             transceiver from the LPUART interrupt instead.
+ *
+ * @param      handle    Serial handle
+ * @param      callback  callback pointer, can be NULL
+ * @param      context   callback context
+ */
+void furi_hal_serial_dma_tx_start(
+    FuriHalSerialHandle* handle,
+    FuriHalSerialAsyncTxCallback callback,
+    void* context);
+
+/** Stop DMA transmission
+ *
+ * Waits for queued data to be sent and releases resources.
+ *
+ * @param      handle  Serial handle
+ */
+void furi_hal_serial_dma_tx_stop(FuriHalSerialHandle* handle);
+
+/** Queue data for DMA transmission
+ *
+ * Copies as much data as fits into the transmit buffers and returns
+ * immediately, transmission runs in background. Use
+ * `furi_hal_serial_tx_wait_complete` to wait for completion.
+ *
+ * @param      handle       Serial handle
+ * @param      buffer       data
+ * @param      buffer_size  data size (in bytes)
+ *
+ * @return     amount of queued data (in bytes), 0 if buffers are full
+ */
+size_t furi_hal_serial_tx_async(
+    FuriHalSerialHandle* handle,
+    const uint8_t* buffer,
+    size_t buffer_size);
+
 #ifdef __cplusplus
 }
 #endif
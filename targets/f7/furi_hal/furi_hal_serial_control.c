@@ -45,6 +45,7 @@ typedef struct {
     uint32_t log_config_serial_baud_rate;
     FuriLogHandler log_handler;
     FuriHalSerialHandle* log_serial;
+    FuriSemaphore* log_tx_semaphore;
 
     // Expansion detection
     FuriHalSerialHandle* expansion_serial;
@@ -54,9 +55,30 @@ typedef struct {
 
 FuriHalSerialControl* furi_hal_serial_control = NULL;
 
+static void furi_hal_serial_control_log_tx_callback(FuriHalSerialHandle* handle, void* context) {
+    UNUSED(handle);
+    UNUSED(context);
+    furi_semaphore_release(furi_hal_serial_control->log_tx_semaphore);
+}
+
 static void furi_hal_serial_control_log_callback(const uint8_t* data, size_t size, void* context) {
     FuriHalSerialHandle* handle = context;
-    furi_hal_serial_tx(handle, data, size);
+
+    // Interrupts and crash reports can't wait, poll DMA instead
+    if(FURI_IS_ISR()) {
+        furi_hal_serial_tx(handle, data, size);
+        return;
+    }
+
+    // Block only when both DMA buffers are in use
+    while(size > 0) {
+        const size_t sent = furi_hal_serial_tx_async(handle, data, size);
+        data += sent;
+        size -= sent;
+        if(size > 0) {
+            furi_semaphore_acquire(furi_hal_serial_control->log_tx_semaphore, FuriWaitForever);
+        }
+    }
 }
 
 static void furi_hal_serial_control_expansion_irq_callback(void* context) {
@@ -100,6 +122,8 @@ static void furi_hal_serial_control_log_set_handle(FuriHalSerialHandle* handle)
         furi_hal_serial_init(
             furi_hal_serial_control->log_serial,
             furi_hal_serial_control->log_config_serial_baud_rate);
+        furi_hal_serial_dma_tx_start(
+            furi_hal_serial_control->log_serial, furi_hal_serial_control_log_tx_callback, NULL);
         furi_hal_serial_control->log_handler.callback = furi_hal_serial_control_log_callback;
         furi_hal_serial_control->log_handler.context = furi_hal_serial_control->log_serial;
         furi_log_add_handler(furi_hal_serial_control->log_handler);
@@ -268,6 +292,7 @@ void furi_hal_serial_control_init(void) {
     furi_hal_serial_control->handles[FuriHalSerialIdLpuart].id = FuriHalSerialIdLpuart;
     furi_hal_serial_control->queue =
         furi_message_queue_alloc(8, sizeof(FuriHalSerialControlMessage));
+    furi_hal_serial_control->log_tx_semaphore = furi_semaphore_alloc(1, 0);
     furi_hal_serial_control->thread = furi_thread_alloc_service(
         "SerialControlDriver", 512, furi_hal_serial_control_thread, NULL);
     furi_thread_set_priority(furi_hal_serial_control->thread, FuriThreadPriorityHighest);
@@ -287,6 +312,7 @@ void furi_hal_serial_control_deinit(void) {
     // Release resources
     furi_thread_free(furi_hal_serial_control->thread);
     furi_message_queue_free(furi_hal_serial_control->queue);
+    furi_semaphore_free(furi_hal_serial_control->log_tx_semaphore);
     free(furi_hal_serial_control);
 }
 
@@ -4,6 +4,7 @@
 #include <alt_boot.h>
 
 #include <fatfs.h>
+#include <sector_cache.h>
 #include <flipper_format/flipper_format.h>
 
 #include <update_util/update_manifest.h>
@@ -30,6 +31,7 @@ static bool flipper_update_mount_sd(void) {
             continue;
         }
 
+        sector_cache_init();
         if(f_mount(pfs, "/", 1) == FR_OK) {
             return true;
         }